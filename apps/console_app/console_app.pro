@@ -100,13 +100,17 @@ else:unix:!macx: DEPENDPATH += /usr/lib/i386-linux-gnu
 
 HEADERS += \
 		include/Receiver.h \
-		include/ConsoleReader.h
+		include/ConsoleReader.h \
+		include/BatchOperation.h \
+		include/BatchRunner.h
 
 ###########################SOURCES######################################################
 SOURCES += \
 		   src/main.cpp \
 		   src/Receiver.cpp \
-		   src/ConsoleReader.cpp
+		   src/ConsoleReader.cpp \
+		   src/BatchOperation.cpp \
+		   src/BatchRunner.cpp
 
 #if pacp is used
 SOURCES += $$PWD/../../../apps/common/src/pcap-console.c
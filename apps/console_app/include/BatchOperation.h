@@ -0,0 +1,186 @@
+/**
+********************************************************************************
+\file   BatchOperation.h
+
+\brief  A single SDO operation of a batch file.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _BATCH_OPERATION_H_
+#define _BATCH_OPERATION_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include <QString>
+#include <QStringList>
+
+#include <oplk/oplk.h>
+
+#include "user/SdoBatchRequest.h"
+
+/**
+ * \brief Class describes one SDO operation of a batch file.
+ *
+ * A batch file is either a CSV file with the columns
+ *
+ *     node,index,subindex,access,type,value,expected[,sdo]
+ *
+ * or a JSON array of objects with the same keys. Empty lines and lines
+ * starting with '#' are ignored in CSV files, as is a header line starting
+ * with 'node'.
+ *
+ * - access:   'read' or 'write'.
+ * - type:     BOOLEAN, INTEGER8/16/32/64 or UNSIGNED8/16/32/64.
+ * - value:    The value to be written. Ignored for read operations.
+ * - expected: The value a read operation has to return. Optional.
+ * - sdo:      'asnd' (default) or 'udp'.
+ *
+ * Numbers may be given decimal or hexadecimal with a '0x' prefix.
+ */
+class BatchOperation
+{
+public:
+	/**
+	 * \brief   Loads the operations of a batch file.
+	 *
+	 * Files ending with '.json' are read as JSON, all others as CSV.
+	 *
+	 * \param[in] fileName  Name of the batch file.
+	 * \return The operations in the order of the file.
+	 * \throws std::runtime_error If the file cannot be read or an entry is invalid.
+	 */
+	static std::vector<BatchOperation> Load(const QString& fileName);
+
+	/**
+	 * \return The request to be run by the SdoBatch.
+	 */
+	SdoBatchRequest GetRequest() const;
+
+	/**
+	 * \param[in] data  The data read from the node.
+	 * \param[in] size  Number of valid bytes.
+	 * \return The value as text. Empty if size does not match the type.
+	 */
+	QString Decode(const std::vector<BYTE>& data, const UINT size) const;
+
+	/**
+	 * \param[in] data  The data read from the node.
+	 * \param[in] size  Number of valid bytes.
+	 * \retval true  If no value is expected or the data equals the expected value.
+	 * \retval false Otherwise.
+	 */
+	bool Matches(const std::vector<BYTE>& data, const UINT size) const;
+
+	/**
+	 * \return Node id of the node.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return Index of the object.
+	 */
+	UINT GetIndex() const;
+
+	/**
+	 * \return Subindex of the object.
+	 */
+	UINT GetSubIndex() const;
+
+	/**
+	 * \return AccessType of the operation.
+	 */
+	tSdoAccessType GetSdoAccessType() const;
+
+	/**
+	 * \return Name of the data type.
+	 */
+	const QString& GetDataType() const;
+
+	/**
+	 * \return The value as given in the batch file.
+	 */
+	const QString& GetValue() const;
+
+	/**
+	 * \return The expected value as given in the batch file. Empty if none.
+	 */
+	const QString& GetExpectedValue() const;
+
+private:
+	UINT nodeId;
+	UINT index;
+	UINT subIndex;
+	tSdoAccessType sdoAccessType;
+	tSdoType sdoType;
+	QString dataType;
+	UINT dataSize;
+	bool isSigned;
+	QString value;
+	QString expectedValue;
+	quint64 rawValue;          ///< Value to be written, two's complement.
+	quint64 rawExpectedValue;  ///< Expected value, two's complement.
+
+	BatchOperation();
+
+	/**
+	 * \brief   Validates the fields of one entry and converts the values.
+	 *
+	 * \param[in] fields    node, index, subindex, access, type, value,
+	 *                      expected and sdo. Missing trailing fields are empty.
+	 * \param[in] location  Position of the entry for error messages.
+	 * \throws std::runtime_error If a field is invalid.
+	 */
+	static BatchOperation Create(const QStringList& fields,
+								const QString& location);
+
+	static std::vector<BatchOperation> LoadCsv(const QString& fileName);
+	static std::vector<BatchOperation> LoadJson(const QString& fileName);
+
+	/**
+	 * \brief   Converts a value of the data type of the operation.
+	 *
+	 * \param[in] text  The value as text.
+	 * \param[out] raw  The value, two's complement in dataSize bytes.
+	 * \retval true  On success.
+	 * \retval false If the text is no number or out of range.
+	 */
+	bool ParseValue(const QString& text, quint64& raw) const;
+
+	/**
+	 * \param[in] data  The data, little endian.
+	 * \param[in] size  Number of valid bytes.
+	 * \return The first size bytes of the data as number.
+	 */
+	quint64 ToRaw(const std::vector<BYTE>& data, const UINT size) const;
+};
+
+#endif // _BATCH_OPERATION_H_
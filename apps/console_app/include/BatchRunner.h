@@ -0,0 +1,178 @@
+/**
+********************************************************************************
+\file   BatchRunner.h
+
+\brief  Runs the SDO operations of a batch file unattended.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _BATCH_RUNNER_H_
+#define _BATCH_RUNNER_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <string>
+#include <vector>
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include <oplk/oplk.h>
+
+#include "api/SdoBatch.h"
+
+#include "../include/BatchOperation.h"
+
+/**
+ * \brief Exit codes of the console application in batch mode.
+ */
+namespace BatchExitCode
+{
+	enum BatchExitCode
+	{
+		PASSED = 0,         ///< All operations have passed.
+		FAILED,             ///< An operation has failed or did not match.
+		INVALID_INPUT,      ///< Invalid arguments or batch file.
+		STACK_ERROR         ///< The stack could not be started or did not
+							///  become operational in time.
+	};
+
+} // namespace BatchExitCode
+
+/**
+ * \brief Class starts the stack, runs all operations of a batch file as one
+ * SdoBatch once the MN is operational, and writes the results file.
+ *
+ * The application exits with a BatchExitCode once the results are written.
+ *
+ * The results file is a CSV file with one line per operation:
+ *
+ *     node,index,subindex,access,type,value,expected,actual,state,abortcode,time_ms,result
+ *
+ * time_ms is the time from the start of the batch to the end of the operation.
+ * result is PASS, FAIL (the transfer has not finished) or MISMATCH (the
+ * value read differs from the expected value).
+ */
+class BatchRunner : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \param[in] operations      The operations to be run.
+	 * \param[in] resultFileName  Name of the results file.
+	 */
+	BatchRunner(const std::vector<BatchOperation>& operations,
+				const QString& resultFileName);
+
+	virtual ~BatchRunner();
+
+	/**
+	 * \param[in] deadline  Time in ms after which the outstanding operations
+	 *                      fail. 0 for no deadline.
+	 */
+	void SetDeadline(const int deadline);
+
+	/**
+	 * \param[in] timeout  Time in ms the MN has to become operational.
+	 */
+	void SetStartupTimeout(const int timeout);
+
+	/**
+	 * \brief   Starts the stack. The batch is run once the MN is operational.
+	 *
+	 * \param[in] nodeId            Node id of the MN.
+	 * \param[in] networkInterface  Network interface.
+	 * \param[in] xapFileName       The xap.xml of the configuration.
+	 * \param[in] cdcFileName       The CDC of the configuration.
+	 * \return kErrorOk or the error of the failed start-up phase.
+	 */
+	tOplkError Start(const UINT nodeId,
+					const std::string& networkInterface,
+					const std::string& xapFileName,
+					const std::string& cdcFileName);
+
+	/**
+	 * \brief   Runs the batch once the MN has become operational.
+	 *
+	 * \param[in] nmtState  New state of the local node.
+	 */
+	Q_INVOKABLE void HandleLocalNodeStateChanged(tNmtState nmtState);
+
+private slots:
+	/**
+	 * \brief   Records the time of a finished operation.
+	 *
+	 * \param[in] item  Position of the operation.
+	 */
+	void HandleItemFinished(const UINT item);
+
+	/**
+	 * \brief   Writes the results and exits the application.
+	 */
+	void HandleBatchFinished();
+
+	/**
+	 * \brief   Exits the application if the MN has not become operational.
+	 */
+	void HandleStartupTimeout();
+
+private:
+	std::vector<BatchOperation> operations;
+	QString resultFileName;
+	SdoBatch* batch;
+	std::vector<qint64> finishedTimes;  ///< Per operation, in ms since the start of the batch.
+	QElapsedTimer batchTimer;
+	QTimer startupTimer;
+	int deadline;
+	bool stackStarted;
+
+	BatchRunner(const BatchRunner& runner);
+	BatchRunner& operator=(const BatchRunner& runner);
+
+	/**
+	 * \brief   Writes the results file.
+	 *
+	 * \param[out] passed  Whether all operations have passed.
+	 * \retval true  If the file has been written.
+	 * \retval false Otherwise.
+	 */
+	bool WriteResults(bool& passed) const;
+
+	/**
+	 * \brief   Stops the stack and exits the application.
+	 *
+	 * \param[in] exitCode  The exit code of the application.
+	 */
+	void Exit(const BatchExitCode::BatchExitCode exitCode);
+};
+
+#endif // _BATCH_RUNNER_H_
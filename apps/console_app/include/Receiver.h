@@ -90,6 +90,15 @@ public:
 	 * \param[in] nodeid  Id of the node found.
 	 */
 	Q_INVOKABLE void HandleNodeFound(const int nodeid);
+
+	/**
+	 * \brief   Handles the end of an event journal replay and exits the application.
+	 *
+	 * \param[in] eventCount    Number of replayed events.
+	 * \param[in] errorMessage  Reason of the failure. Empty on success.
+	 */
+	Q_INVOKABLE void HandleReplayFinished(const ulong eventCount,
+										  const QString errorMessage);
 };
 
 #endif // _RECEIVER_H_
@@ -0,0 +1,394 @@
+/**
+********************************************************************************
+\file   BatchOperation.cpp
+
+\brief  Loading, encoding and verification of the SDO operations of a batch file.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <stdexcept>
+
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+
+#include "../include/BatchOperation.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Number of fields of an operation.
+	 */
+	const int kFieldCount = 8;
+
+	/**
+	 * \brief Names of the fields in the order of the CSV columns.
+	 */
+	const char* const kFieldNames[kFieldCount] =
+	{
+		"node", "index", "subindex", "access", "type", "value", "expected", "sdo"
+	};
+
+	/**
+	 * \param[in] dataType  Name of the data type.
+	 * \param[out] isSigned Whether the data type is signed.
+	 * \return Size of the data type in bytes. 0 if not supported.
+	 */
+	UINT GetDataTypeSize(const QString& dataType, bool& isSigned)
+	{
+		isSigned = dataType.startsWith("INTEGER");
+		if ((dataType == "BOOLEAN") || (dataType == "INTEGER8") || (dataType == "UNSIGNED8"))
+			return 1;
+		if ((dataType == "INTEGER16") || (dataType == "UNSIGNED16"))
+			return 2;
+		if ((dataType == "INTEGER32") || (dataType == "UNSIGNED32"))
+			return 4;
+		if ((dataType == "INTEGER64") || (dataType == "UNSIGNED64"))
+			return 8;
+		return 0;
+	}
+
+	/**
+	 * \return The mask of a value with the given size in bytes.
+	 */
+	quint64 GetMask(const UINT size)
+	{
+		return (size >= 8) ? ~((quint64) 0) : ((((quint64) 1) << (size * 8)) - 1);
+	}
+
+	/**
+	 * \return The JSON value as text. Numbers are converted without fraction.
+	 */
+	QString ToString(const QJsonValue& value)
+	{
+		if (value.isDouble())
+			return QString::number((qlonglong) value.toDouble());
+		return value.toString();
+	}
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+std::vector<BatchOperation> BatchOperation::Load(const QString& fileName)
+{
+	if (fileName.endsWith(".json", Qt::CaseInsensitive))
+		return BatchOperation::LoadJson(fileName);
+
+	return BatchOperation::LoadCsv(fileName);
+}
+
+SdoBatchRequest BatchOperation::GetRequest() const
+{
+	if (this->sdoAccessType == kSdoAccessTypeWrite)
+	{
+		std::vector<BYTE> writeData;
+		writeData.reserve(this->dataSize);
+		for (UINT i = 0; i < this->dataSize; ++i)
+		{
+			writeData.push_back((BYTE) (this->rawValue >> (i * 8)));
+		}
+		return SdoBatchRequest(this->nodeId, this->index, this->subIndex,
+							writeData, this->sdoType);
+	}
+
+	return SdoBatchRequest(this->nodeId, this->index, this->subIndex,
+						this->dataSize, this->sdoType);
+}
+
+QString BatchOperation::Decode(const std::vector<BYTE>& data, const UINT size) const
+{
+	if ((size != this->dataSize) || (data.size() < size))
+		return QString();
+
+	const quint64 raw = this->ToRaw(data, size);
+	if (this->isSigned && (raw & (((quint64) 1) << ((size * 8) - 1))))
+	{
+		// Sign extension
+		return QString::number((qlonglong) (raw | ~GetMask(size)));
+	}
+
+	return this->isSigned ? QString::number((qlonglong) raw) : QString::number(raw);
+}
+
+bool BatchOperation::Matches(const std::vector<BYTE>& data, const UINT size) const
+{
+	if (this->expectedValue.isEmpty())
+		return true;
+
+	if ((size != this->dataSize) || (data.size() < size))
+		return false;
+
+	return (this->ToRaw(data, size) == this->rawExpectedValue);
+}
+
+UINT BatchOperation::GetNodeId() const
+{
+	return this->nodeId;
+}
+
+UINT BatchOperation::GetIndex() const
+{
+	return this->index;
+}
+
+UINT BatchOperation::GetSubIndex() const
+{
+	return this->subIndex;
+}
+
+tSdoAccessType BatchOperation::GetSdoAccessType() const
+{
+	return this->sdoAccessType;
+}
+
+const QString& BatchOperation::GetDataType() const
+{
+	return this->dataType;
+}
+
+const QString& BatchOperation::GetValue() const
+{
+	return this->value;
+}
+
+const QString& BatchOperation::GetExpectedValue() const
+{
+	return this->expectedValue;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+BatchOperation::BatchOperation() :
+	nodeId(0),
+	index(0),
+	subIndex(0),
+	sdoAccessType(kSdoAccessTypeRead),
+	sdoType(kSdoTypeAsnd),
+	dataType(),
+	dataSize(0),
+	isSigned(false),
+	value(),
+	expectedValue(),
+	rawValue(0),
+	rawExpectedValue(0)
+{
+
+}
+
+BatchOperation BatchOperation::Create(const QStringList& fields,
+							const QString& location)
+{
+	BatchOperation operation;
+	bool ok = false;
+
+	operation.nodeId = fields.at(0).toUInt(&ok, 0);
+	if (!ok || (operation.nodeId == 0) || (operation.nodeId > 254))
+		throw std::runtime_error(QString("%1: Invalid node '%2'")
+						.arg(location).arg(fields.at(0)).toStdString());
+
+	operation.index = fields.at(1).toUInt(&ok, 0);
+	if (!ok || (operation.index > 0xFFFF))
+		throw std::runtime_error(QString("%1: Invalid index '%2'")
+						.arg(location).arg(fields.at(1)).toStdString());
+
+	operation.subIndex = fields.at(2).toUInt(&ok, 0);
+	if (!ok || (operation.subIndex > 0xFF))
+		throw std::runtime_error(QString("%1: Invalid subindex '%2'")
+						.arg(location).arg(fields.at(2)).toStdString());
+
+	const QString access = fields.at(3).toLower();
+	if (access == "read")
+		operation.sdoAccessType = kSdoAccessTypeRead;
+	else if (access == "write")
+		operation.sdoAccessType = kSdoAccessTypeWrite;
+	else
+		throw std::runtime_error(QString("%1: Invalid access '%2'")
+						.arg(location).arg(fields.at(3)).toStdString());
+
+	operation.dataType = fields.at(4).toUpper();
+	operation.dataSize = GetDataTypeSize(operation.dataType, operation.isSigned);
+	if (operation.dataSize == 0)
+		throw std::runtime_error(QString("%1: Unsupported type '%2'")
+						.arg(location).arg(fields.at(4)).toStdString());
+
+	if (operation.sdoAccessType == kSdoAccessTypeWrite)
+	{
+		operation.value = fields.at(5);
+		if (!operation.ParseValue(operation.value, operation.rawValue))
+			throw std::runtime_error(QString("%1: Invalid value '%2' for %3")
+							.arg(location).arg(fields.at(5))
+							.arg(operation.dataType).toStdString());
+	}
+
+	operation.expectedValue = fields.at(6);
+	if (!operation.expectedValue.isEmpty()
+		&& !operation.ParseValue(operation.expectedValue, operation.rawExpectedValue))
+		throw std::runtime_error(QString("%1: Invalid expected value '%2' for %3")
+						.arg(location).arg(fields.at(6))
+						.arg(operation.dataType).toStdString());
+
+	const QString sdo = fields.at(7).toLower();
+	if (sdo.isEmpty() || (sdo == "asnd"))
+		operation.sdoType = kSdoTypeAsnd;
+	else if (sdo == "udp")
+		operation.sdoType = kSdoTypeUdp;
+	else
+		throw std::runtime_error(QString("%1: Invalid sdo '%2'")
+						.arg(location).arg(fields.at(7)).toStdString());
+
+	return operation;
+}
+
+std::vector<BatchOperation> BatchOperation::LoadCsv(const QString& fileName)
+{
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+		throw std::runtime_error(QString("%1: %2").arg(fileName)
+						.arg(file.errorString()).toStdString());
+
+	std::vector<BatchOperation> operations;
+	QTextStream stream(&file);
+	for (UINT lineNumber = 1; !stream.atEnd(); ++lineNumber)
+	{
+		const QString line = stream.readLine().trimmed();
+		if (line.isEmpty()
+			|| line.startsWith("#")
+			|| line.startsWith("node", Qt::CaseInsensitive))
+			continue;
+
+		QStringList fields = line.split(',');
+		if ((fields.size() < 5) || (fields.size() > kFieldCount))
+			throw std::runtime_error(QString("%1:%2: Expected 5 to %3 columns")
+							.arg(fileName).arg(lineNumber)
+							.arg(kFieldCount).toStdString());
+
+		for (int field = 0; field < fields.size(); ++field)
+		{
+			fields[field] = fields.at(field).trimmed();
+		}
+		while (fields.size() < kFieldCount)
+		{
+			fields.append(QString());
+		}
+
+		operations.push_back(BatchOperation::Create(fields,
+						QString("%1:%2").arg(fileName).arg(lineNumber)));
+	}
+
+	return operations;
+}
+
+std::vector<BatchOperation> BatchOperation::LoadJson(const QString& fileName)
+{
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly))
+		throw std::runtime_error(QString("%1: %2").arg(fileName)
+						.arg(file.errorString()).toStdString());
+
+	QJsonParseError parseError;
+	const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+	if (parseError.error != QJsonParseError::NoError)
+		throw std::runtime_error(QString("%1:@%2: %3").arg(fileName)
+						.arg(parseError.offset)
+						.arg(parseError.errorString()).toStdString());
+
+	if (!document.isArray())
+		throw std::runtime_error(QString("%1: Expected an array of operations")
+						.arg(fileName).toStdString());
+
+	std::vector<BatchOperation> operations;
+	const QJsonArray entries = document.array();
+	for (int entry = 0; entry < entries.size(); ++entry)
+	{
+		const QString location = QString("%1[%2]").arg(fileName).arg(entry);
+		if (!entries.at(entry).isObject())
+			throw std::runtime_error(QString("%1: Expected an object")
+							.arg(location).toStdString());
+
+		const QJsonObject object = entries.at(entry).toObject();
+		QStringList fields;
+		for (int field = 0; field < kFieldCount; ++field)
+		{
+			fields.append(ToString(object.value(kFieldNames[field])).trimmed());
+		}
+
+		operations.push_back(BatchOperation::Create(fields, location));
+	}
+
+	return operations;
+}
+
+bool BatchOperation::ParseValue(const QString& text, quint64& raw) const
+{
+	bool ok = false;
+	const quint64 mask = GetMask(this->dataSize);
+
+	// Hexadecimal values are taken as the bit pattern, also for signed types.
+	if (!this->isSigned || text.startsWith("0x", Qt::CaseInsensitive))
+	{
+		raw = text.toULongLong(&ok, 0);
+		return (ok && ((raw & ~mask) == 0));
+	}
+
+	const qlonglong signedValue = text.toLongLong(&ok, 0);
+	if (!ok)
+		return false;
+
+	if (this->dataSize < 8)
+	{
+		const qlonglong limit = ((qlonglong) 1) << ((this->dataSize * 8) - 1);
+		if ((signedValue < -limit) || (signedValue >= limit))
+			return false;
+	}
+
+	raw = ((quint64) signedValue) & mask;
+	return true;
+}
+
+quint64 BatchOperation::ToRaw(const std::vector<BYTE>& data, const UINT size) const
+{
+	quint64 raw = 0;
+	for (UINT i = 0; (i < size) && (i < data.size()); ++i)
+	{
+		raw |= ((quint64) data.at(i)) << (i * 8);
+	}
+	return (raw & GetMask(size));
+}
@@ -0,0 +1,303 @@
+/**
+********************************************************************************
+\file   BatchRunner.cpp
+
+\brief  Implementation of the batch mode of the console application.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+#include <QMetaObject>
+
+#include <oplk/debugstr.h>
+
+#include "api/OplkQtApi.h"
+#include "api/StartupOrchestrator.h"
+
+#include "../include/BatchRunner.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	const int kDefaultStartupTimeout = 60000;
+
+	/**
+	 * \brief Outcome of a batch operation.
+	 */
+	enum Verdict
+	{
+		PASS = 0,
+		FAIL,
+		MISMATCH
+	};
+
+	const char* const kVerdictString[] = { "PASS", "FAIL", "MISMATCH" };
+
+	/**
+	 * \return The name of the state of a batch item.
+	 */
+	const char* GetItemStateString(SdoBatchItemState::SdoBatchItemState state)
+	{
+		switch (state)
+		{
+			case SdoBatchItemState::PENDING:
+				return "PENDING";
+			case SdoBatchItemState::FINISHED:
+				return "FINISHED";
+			case SdoBatchItemState::ABORTED:
+				return "ABORTED";
+			case SdoBatchItemState::CANCELLED:
+				return "CANCELLED";
+			case SdoBatchItemState::TIMED_OUT:
+				return "TIMED_OUT";
+			default:
+				return "UNDEFINED";
+		}
+	}
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+BatchRunner::BatchRunner(const std::vector<BatchOperation>& operations,
+				const QString& resultFileName) :
+	QObject(),
+	operations(operations),
+	resultFileName(resultFileName),
+	batch(NULL),
+	finishedTimes(operations.size(), -1),
+	batchTimer(),
+	startupTimer(),
+	deadline(0),
+	stackStarted(false)
+{
+	this->startupTimer.setSingleShot(true);
+	this->startupTimer.setInterval(kDefaultStartupTimeout);
+
+	bool ret = connect(&(this->startupTimer), SIGNAL(timeout()),
+				this, SLOT(HandleStartupTimeout()));
+	Q_ASSERT(ret != false);
+}
+
+BatchRunner::~BatchRunner()
+{
+	delete this->batch;
+}
+
+void BatchRunner::SetDeadline(const int deadline)
+{
+	this->deadline = deadline;
+}
+
+void BatchRunner::SetStartupTimeout(const int timeout)
+{
+	this->startupTimer.setInterval(timeout);
+}
+
+tOplkError BatchRunner::Start(const UINT nodeId,
+				const std::string& networkInterface,
+				const std::string& xapFileName,
+				const std::string& cdcFileName)
+{
+	int index = this->metaObject()->indexOfMethod(
+					QMetaObject::normalizedSignature(
+					"HandleLocalNodeStateChanged(tNmtState)").constData());
+	Q_ASSERT(index != -1);
+	// If asserted check for the Function name
+
+	bool ret = OplkQtApi::RegisterLocalNodeStateChangedEventHandler(*(this),
+							this->metaObject()->method(index));
+	Q_ASSERT(ret != false);
+
+	StartupOrchestrator startup(ProcessImageParserType::QT_XML_PARSER);
+	tOplkError oplkRet = startup.Run(nodeId, networkInterface, xapFileName, cdcFileName);
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("Batch: Start-up failed in phase %s: %s %s",
+			   StartupPhase::GetStartupPhaseString(startup.GetFailedPhase()).c_str(),
+			   debugstr_getRetValStr(oplkRet),
+			   startup.GetParseErrorMessage().c_str());
+		return oplkRet;
+	}
+
+	this->stackStarted = true;
+	this->startupTimer.start();
+	qDebug("Batch: Waiting for the MN to become operational");
+	return kErrorOk;
+}
+
+void BatchRunner::HandleLocalNodeStateChanged(tNmtState nmtState)
+{
+	if ((nmtState != kNmtMsOperational) || (this->batch != NULL))
+		return;
+
+	this->startupTimer.stop();
+
+	std::vector<SdoBatchRequest> requests;
+	requests.reserve(this->operations.size());
+	for (std::vector<BatchOperation>::const_iterator it = this->operations.begin();
+		 it != this->operations.end(); ++it)
+	{
+		requests.push_back(it->GetRequest());
+	}
+
+	this->batch = new SdoBatch(requests, this);
+
+	bool ret = connect(this->batch, SIGNAL(SignalItemFinished(UINT)),
+				this, SLOT(HandleItemFinished(UINT)));
+	Q_ASSERT(ret != false);
+
+	ret = connect(this->batch, SIGNAL(SignalFinished()),
+				this, SLOT(HandleBatchFinished()));
+	Q_ASSERT(ret != false);
+
+	qDebug("Batch: Running %u operations", (UINT) requests.size());
+	this->batchTimer.start();
+	// An empty batch reports SignalFinished from Start().
+	this->batch->Start(this->deadline);
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void BatchRunner::HandleItemFinished(const UINT item)
+{
+	if (item < this->finishedTimes.size())
+		this->finishedTimes[item] = this->batchTimer.elapsed();
+}
+
+void BatchRunner::HandleBatchFinished()
+{
+	qDebug("Batch: Finished in %lld ms", this->batchTimer.elapsed());
+
+	bool passed = false;
+	if (!this->WriteResults(passed))
+	{
+		this->Exit(BatchExitCode::INVALID_INPUT);
+		return;
+	}
+
+	this->Exit(passed ? BatchExitCode::PASSED : BatchExitCode::FAILED);
+}
+
+void BatchRunner::HandleStartupTimeout()
+{
+	qDebug("Batch: The MN has not become operational within %d ms",
+		   this->startupTimer.interval());
+	this->Exit(BatchExitCode::STACK_ERROR);
+}
+
+bool BatchRunner::WriteResults(bool& passed) const
+{
+	QFile file(this->resultFileName);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+	{
+		qDebug("Batch: Cannot write %s: %s",
+			   this->resultFileName.toStdString().c_str(),
+			   file.errorString().toStdString().c_str());
+		return false;
+	}
+
+	QTextStream stream(&file);
+	stream << "node,index,subindex,access,type,value,expected,actual,state,abortcode,time_ms,result\n";
+
+	UINT failedCount = 0;
+	for (UINT item = 0; item < this->operations.size(); ++item)
+	{
+		const BatchOperation& operation = this->operations.at(item);
+		const SdoBatchItemState::SdoBatchItemState state = this->batch->GetItemState(item);
+		const SdoTransferResult& result = this->batch->GetResult(item);
+		const bool isRead = (operation.GetSdoAccessType() == kSdoAccessTypeRead);
+
+		QString actual;
+		Verdict verdict = PASS;
+		if (state != SdoBatchItemState::FINISHED)
+		{
+			verdict = FAIL;
+		}
+		else if (isRead)
+		{
+			const std::vector<BYTE>& data = this->batch->GetData(item);
+			actual = operation.Decode(data, result.GetTransferredBytes());
+			if (!operation.Matches(data, result.GetTransferredBytes()))
+				verdict = MISMATCH;
+		}
+
+		if (verdict != PASS)
+		{
+			++failedCount;
+			qDebug("Batch: %s node %u 0x%04X/%u", kVerdictString[verdict], operation.GetNodeId(),
+				   operation.GetIndex(), operation.GetSubIndex());
+		}
+
+		stream << operation.GetNodeId()
+			   << QString(",0x%1").arg(operation.GetIndex(), 4, 16, QLatin1Char('0'))
+			   << "," << operation.GetSubIndex()
+			   << "," << (isRead ? "read" : "write")
+			   << "," << operation.GetDataType()
+			   << "," << operation.GetValue()
+			   << "," << operation.GetExpectedValue()
+			   << "," << actual
+			   << "," << GetItemStateString(state)
+			   << QString(",0x%1").arg(result.GetAbortCode(), 8, 16, QLatin1Char('0'))
+			   << "," << this->finishedTimes.at(item)
+			   << "," << kVerdictString[verdict]
+			   << "\n";
+	}
+	stream.flush();
+
+	qDebug("Batch: %u of %u operations failed. Results written to %s",
+		   failedCount, (UINT) this->operations.size(),
+		   this->resultFileName.toStdString().c_str());
+
+	passed = (failedCount == 0);
+	return true;
+}
+
+void BatchRunner::Exit(const BatchExitCode::BatchExitCode exitCode)
+{
+	if (this->stackStarted)
+	{
+		tOplkError oplkRet = OplkQtApi::StopStack();
+		if (oplkRet != kErrorOk)
+		{
+			qDebug("Batch: StopStack retCode %x", oplkRet);
+		}
+		this->stackStarted = false;
+	}
+
+	QCoreApplication::exit(exitCode);
+}
@@ -316,6 +316,20 @@ void ConsoleReader::run()
 					}
 					break;
 				}
+				case 'x':
+				case 'X':
+				{
+					// Restart the network, reusing the running stack.
+					if (stackStarted)
+					{
+						oplkRet = OplkQtApi::RestartStack();
+						if (oplkRet != kErrorOk)
+						{
+							qDebug("RestartStack retCode %x", oplkRet);
+						}
+					}
+					break;
+				}
 				case 's':
 				case 'S':
 				{
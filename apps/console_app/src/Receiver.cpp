@@ -35,6 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*******************************************************************************
 * INCLUDES
 *******************************************************************************/
+#include <QCoreApplication>
+
 #include <oplk/debugstr.h>
 #include "../include/Receiver.h"
 
@@ -68,3 +70,18 @@ void Receiver::HandleNodeFound(const int nodeId)
 {
 	qDebug("Node %d found.", nodeId);
 }
+
+void Receiver::HandleReplayFinished(const ulong eventCount,
+									const QString errorMessage)
+{
+	if (errorMessage.isEmpty())
+	{
+		qDebug("Replay: %lu events replayed", eventCount);
+		QCoreApplication::exit(0);
+	}
+	else
+	{
+		qDebug("Replay: %s after %lu events", qPrintable(errorMessage), eventCount);
+		QCoreApplication::exit(1);
+	}
+}
@@ -37,7 +37,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 * INCLUDES
 *******************************************************************************/
 
+#include <stdexcept>
+
 #include <QCoreApplication>
+#include <QStringList>
 
 #include <oplk/oplk.h>
 #ifdef __unix__
@@ -45,9 +48,178 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include "api/OplkQtApi.h"
+#include "api/EventJournalReplay.h"
+#include "api/SignalLatencyMonitor.h"
 
 #include "../include/Receiver.h"
 #include "../include/ConsoleReader.h"
+#include "../include/BatchRunner.h"
+
+namespace
+{
+	const UINT kDefaultNodeId = 240;
+
+	/**
+	 * \return The value following the option name in the arguments.
+	 * defaultValue if the option is not given.
+	 */
+	QString GetOption(const QStringList& arguments,
+					const QString& name,
+					const QString& defaultValue = QString())
+	{
+		const int position = arguments.indexOf(name);
+		if ((position == -1) || ((position + 1) >= arguments.size()))
+			return defaultValue;
+		return arguments.at(position + 1);
+	}
+
+	/**
+	 * \brief Runs the SDO operations of a batch file without user interaction.
+	 *
+	 * \return The BatchExitCode.
+	 */
+	int RunBatch(QCoreApplication& application)
+	{
+		const QStringList arguments = application.arguments();
+		const QString batchFileName = GetOption(arguments, "--batch");
+		const QString networkInterface = GetOption(arguments, "--interface");
+		if (batchFileName.isEmpty() || networkInterface.isEmpty())
+		{
+			qDebug("Usage: console_app --batch <operations.csv|.json> --interface <device>\n"
+				   "                   [--results <file>] [--node <id>] [--xap <file>]\n"
+				   "                   [--cdc <file>] [--deadline <ms>] [--startup-timeout <ms>]\n"
+				   "                   [--journal <file>]");
+			return BatchExitCode::INVALID_INPUT;
+		}
+
+		std::vector<BatchOperation> operations;
+		try
+		{
+			operations = BatchOperation::Load(batchFileName);
+		}
+		catch(const std::exception& ex)
+		{
+			qDebug("Batch: %s", ex.what());
+			return BatchExitCode::INVALID_INPUT;
+		}
+
+		bool ok = false;
+		const UINT nodeId = GetOption(arguments, "--node",
+								QString::number(kDefaultNodeId)).toUInt(&ok, 0);
+		if (!ok)
+		{
+			qDebug("Batch: Invalid node id");
+			return BatchExitCode::INVALID_INPUT;
+		}
+
+		BatchRunner runner(operations,
+				GetOption(arguments, "--results", batchFileName + ".results.csv"));
+		runner.SetDeadline(GetOption(arguments, "--deadline", "0").toInt());
+		runner.SetStartupTimeout(GetOption(arguments, "--startup-timeout", "60000").toInt());
+
+		const QString journalFileName = GetOption(arguments, "--journal");
+		if (!journalFileName.isEmpty()
+			&& !OplkQtApi::StartEventJournal(journalFileName))
+		{
+			qDebug("Batch: Cannot create the event journal %s",
+				   qPrintable(journalFileName));
+			return BatchExitCode::INVALID_INPUT;
+		}
+
+		tOplkError oplkRet = runner.Start(nodeId,
+								networkInterface.toStdString(),
+								GetOption(arguments, "--xap", "xap.xml").toStdString(),
+								GetOption(arguments, "--cdc", "mnobd.cdc").toStdString());
+		if (oplkRet != kErrorOk)
+		{
+			OplkQtApi::StopEventJournal();
+			return BatchExitCode::STACK_ERROR;
+		}
+
+		const int exitCode = application.exec();
+		const ULONG droppedEvents = OplkQtApi::StopEventJournal();
+		if (droppedEvents > 0)
+			qDebug("Batch: %lu events missing in the journal", droppedEvents);
+
+		return exitCode;
+	}
+
+	/**
+	 * \brief Prints the delivery latencies of all signals which have been emitted.
+	 */
+	void PrintSignalLatencies()
+	{
+		const std::vector<SignalLatencyStatistics> statistics =
+				SignalLatencyMonitor::GetInstance().GetStatistics();
+
+		qDebug("Signal                  Count   Avg[us]   P99[us]   Max[us]  MaxQueue");
+		for (std::vector<SignalLatencyStatistics>::const_iterator it = statistics.begin();
+			 it != statistics.end(); ++it)
+		{
+			if (it->GetCount() == 0)
+				continue;
+
+			qDebug("%-22s %6lu %9lu %9lu %9lu %9u",
+				   qPrintable(it->GetSignalName()),
+				   it->GetCount(),
+				   (ULONG) it->GetAverageLatency(),
+				   (ULONG) it->GetLatencyPercentile(99),
+				   (ULONG) it->GetMaxLatency(),
+				   it->GetMaxQueueDepth());
+		}
+	}
+
+	/**
+	 * \brief Replays an event journal without a network and prints the events.
+	 *
+	 * \return 0 if the journal has been replayed completely.
+	 */
+	int RunReplay(QCoreApplication& application)
+	{
+		const QStringList arguments = application.arguments();
+		const QString journalFileName = GetOption(arguments, "--replay");
+		bool ok = false;
+		const double speed = GetOption(arguments, "--speed", "1").toDouble(&ok);
+		if (journalFileName.isEmpty() || !ok)
+		{
+			qDebug("Usage: console_app --replay <journal> [--speed <factor, 0 for no delays>]\n"
+				   "                   [--latency]");
+			return 1;
+		}
+
+		Receiver receiver;
+		const QMetaObject* metaObject = receiver.metaObject();
+		OplkQtApi::RegisterEventLogger(receiver, metaObject->method(
+			metaObject->indexOfMethod(QMetaObject::normalizedSignature(
+				"HandleLogEvent(const QString&)").constData())));
+
+		EventJournalReplay replay(journalFileName, speed);
+		QObject::connect(&replay,
+			QMetaMethod::fromSignal(&EventJournalReplay::SignalReplayFinished),
+			&receiver,
+			metaObject->method(metaObject->indexOfMethod(
+				QMetaObject::normalizedSignature(
+					"HandleReplayFinished(const ulong, const QString)").constData())),
+			Qt::QueuedConnection);
+
+		const bool measureLatency = arguments.contains("--latency");
+		if (measureLatency)
+			SignalLatencyMonitor::GetInstance().Enable();
+
+		replay.start();
+		const int exitCode = application.exec();
+		replay.Stop();
+		replay.wait();
+
+		if (measureLatency)
+		{
+			SignalLatencyMonitor::GetInstance().Disable();
+			PrintSignalLatencies();
+		}
+
+		return exitCode;
+	}
+}
 
 int main(int argc, char *argv[])
 {
@@ -57,6 +229,12 @@ int main(int argc, char *argv[])
 
 	QCoreApplication application(argc, argv);
 
+	if (application.arguments().contains("--batch"))
+		return RunBatch(application);
+
+	if (application.arguments().contains("--replay"))
+		return RunReplay(application);
+
 	qDebug("------------------------------------------------------\n");
 	qDebug("  WELCOME TO OPEN POWERLINK VERSION 2.0 console demo  \n");
 	qDebug("------------------------------------------------------\n");
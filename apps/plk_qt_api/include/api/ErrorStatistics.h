@@ -0,0 +1,179 @@
+/**
+********************************************************************************
+\file   ErrorStatistics.h
+
+\brief  Aggregates the error events of the nodes.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _ERROR_STATISTICS_H_
+#define _ERROR_STATISTICS_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include <QtCore/QMutex>
+#include <QtCore/QElapsedTimer>
+
+#include "user/ErrorStatisticsEntry.h"
+
+/**
+ * \brief Counts the error events per node and error code in a table of
+ * fixed size.
+ *
+ * Each entry keeps the number of occurrences, the time of the first and
+ * the last occurrence and the occurrences within a sliding window of
+ * kWindowSlots slots of kSlotLength ms. Errors of a new node and error code
+ * are only counted as overflow when the table is full.
+ *
+ * The statistics also limit the logging of repeated errors: only the first
+ * kLogBurst occurrences of an entry within a window are logged.
+ *
+ * \note The errors are added from the event callback of the stack.
+ * \note This class is intended to _only_ be used by OplkEventHandler and OplkQtApi.
+ */
+class ErrorStatistics
+{
+public:
+	/**
+	 * \brief Number of entries of the table.
+	 */
+	static const UINT kCapacity = 512;
+
+	/**
+	 * \brief Number of slots of the sliding window.
+	 */
+	static const UINT kWindowSlots = 10;
+
+	/**
+	 * \brief Length of a slot of the sliding window in ms.
+	 */
+	static const UINT kSlotLength = 1000;
+
+	/**
+	 * \brief Number of occurrences of an entry which are logged per window.
+	 */
+	static const UINT kLogBurst = 5;
+
+	ErrorStatistics();
+
+	/**
+	 * \brief Counts an occurrence of an error.
+	 *
+	 * \param[in] nodeId       Node id of the node. 0 for the local node.
+	 * \param[in] errorCode    The error code.
+	 * \param[out] suppressed  Number of occurrences which have not been
+	 *                         logged since the last logged one. Only set
+	 *                         if the occurrence is to be logged.
+	 * \retval true  If the occurrence is to be logged.
+	 * \retval false If the occurrence exceeds the rate limit of the logger.
+	 */
+	bool AddError(const UINT nodeId, const UINT16 errorCode, ULONG& suppressed);
+
+	/**
+	 * \brief Clears all entries and the overflow count.
+	 */
+	void Reset();
+
+	/**
+	 * \return All entries, ordered by node id and error code.
+	 */
+	std::vector<ErrorStatisticsEntry> GetEntries() const;
+
+	/**
+	 * \param[in] nodeId  Node id of the node. 0 for the local node.
+	 * \return The entries of the node, ordered by error code.
+	 */
+	std::vector<ErrorStatisticsEntry> GetEntries(const UINT nodeId) const;
+
+	/**
+	 * \param[in] count  Maximum number of entries.
+	 * \return The entries with the highest rate in the sliding window,
+	 *         then with the highest number of occurrences.
+	 */
+	std::vector<ErrorStatisticsEntry> GetTopOffenders(const UINT count) const;
+
+	/**
+	 * \return Number of errors which have not been counted because the
+	 *         table was full.
+	 */
+	ULONG GetOverflowCount() const;
+
+private:
+	ErrorStatistics(const ErrorStatistics& statistics);
+	ErrorStatistics& operator=(const ErrorStatistics& statistics);
+
+	/**
+	 * \brief The occurrences of an error code of a node.
+	 */
+	struct Entry
+	{
+		bool used;
+		UINT nodeId;
+		UINT16 errorCode;
+		ULONG count;
+		qint64 firstOccurrence;
+		qint64 lastOccurrence;
+		qint64 newestSlot;                  ///< Slot of the last occurrence.
+		ULONG slotCounts[kWindowSlots];     ///< Occurrences per slot of the window.
+		qint64 logWindowStart;              ///< Start of the current log window in ms.
+		UINT loggedInWindow;
+		ULONG suppressedCount;
+		ULONG pendingSuppressed;            ///< Suppressed since the last logged occurrence.
+	};
+
+	/**
+	 * \brief Finds the entry of an error. An unused entry is taken if the
+	 * error has no entry yet. Must be called with the mutex locked.
+	 *
+	 * \param[in] nodeId     Node id of the node.
+	 * \param[in] errorCode  The error code.
+	 * \return The entry or NULL if the table is full.
+	 */
+	Entry* FindEntry(const UINT nodeId, const UINT16 errorCode);
+
+	/**
+	 * \brief Converts an entry. Must be called with the mutex locked.
+	 *
+	 * \param[in] entry    The entry.
+	 * \param[in] nowSlot  The current slot of the sliding window.
+	 * \return The snapshot of the entry.
+	 */
+	static ErrorStatisticsEntry ToStatisticsEntry(const Entry& entry,
+											const qint64 nowSlot);
+
+	mutable QMutex mutex;
+	QElapsedTimer clock;
+	Entry entries[kCapacity];
+	ULONG overflowCount;
+};
+
+#endif // _ERROR_STATISTICS_H_
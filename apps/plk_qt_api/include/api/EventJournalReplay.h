@@ -0,0 +1,113 @@
+/**
+********************************************************************************
+\file   EventJournalReplay.h
+
+\brief  Replays a journal of stack events recorded by the EventJournalWriter.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _EVENT_JOURNAL_REPLAY_H_
+#define _EVENT_JOURNAL_REPLAY_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QThread>
+#include <QtCore/QString>
+#include <QtCore/QAtomicInt>
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Thread which feeds the events of a journal file through the event
+ * callback of OplkEventHandler, as if they were generated by the stack.
+ *
+ * All signals of OplkQtApi, the loggers and the node tables behave as
+ * during the recording. The events are replayed with their original timing,
+ * scaled by the speed factor, or as fast as possible.
+ *
+ * The replayed events only reach the application: they are not recorded
+ * again, SDO channels are not freed and PDO mappings are not read.
+ *
+ * The replay fails if the stack is initialised, and OplkQtApi::InitStack
+ * fails while a replay is running.
+ * \see OplkQtApi::StartEventJournal
+ */
+class PLKQTAPI_EXPORT EventJournalReplay : public QThread
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \param[in] fileName  Path of the journal file.
+	 * \param[in] speed     Speed factor of the replay, e.g. 1.0 for the
+	 *                      original timing or 10.0 for ten times faster.
+	 *                      0 to replay without delays.
+	 */
+	EventJournalReplay(const QString& fileName, const double speed);
+
+	/**
+	 * \brief Stops the replay after the current event.
+	 */
+	void Stop();
+
+signals:
+	/**
+	 * \brief This signal is emitted when the replay has finished or failed.
+	 *
+	 * \param[in] eventCount    Number of replayed events.
+	 * \param[in] errorMessage  Reason of the failure. Empty if the journal
+	 *                          has been replayed completely or the replay was stopped.
+	 */
+	void SignalReplayFinished(const ulong eventCount, const QString errorMessage);
+
+protected:
+	/**
+	 * \brief Replays the journal.
+	 */
+	virtual void run();
+
+private:
+	EventJournalReplay(const EventJournalReplay& replay);
+	EventJournalReplay& operator=(const EventJournalReplay& replay);
+
+	/**
+	 * \brief Waits until the event is due.
+	 *
+	 * \param[in] timestamp  Time of the event in us since the start of the journal.
+	 * \param[in] elapsed    Time in us since the start of the replay.
+	 */
+	void WaitUntilDue(const qint64 timestamp, const qint64 elapsed);
+
+	QString fileName;
+	double speed;
+	QAtomicInt stopRequested;
+};
+
+#endif // _EVENT_JOURNAL_REPLAY_H_
@@ -0,0 +1,176 @@
+/**
+********************************************************************************
+\file   EventJournalWriter.h
+
+\brief  Records the events of the stack to a binary journal file.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _EVENT_JOURNAL_WRITER_H_
+#define _EVENT_JOURNAL_WRITER_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include <QtCore/QThread>
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include <oplk/oplk.h>
+
+/**
+ * \brief Thread which appends the raw events of the stack to a journal file.
+ *
+ * The event callback copies each event into a bounded queue. The thread
+ * writes the queued events to the file, so that the callback is not delayed
+ * by the file system. Events are dropped if the queue is full.
+ *
+ * The journal starts with a header of the magic "OPLKJRNL", the format
+ * version and the size of tOplkApiEventArg. Each event is stored as the
+ * time since the start of the recording in us (qint64), the event type
+ * (UINT32), the size of the payload (UINT32) and the payload. All values
+ * are in host byte order. Journals can only be replayed by a build of the
+ * same stack version on the same platform.
+ *
+ * Only events which are processed by OplkEventHandler are recorded. The
+ * user argument of SDO events is not recorded.
+ *
+ * \see EventJournalReplay
+ * \note This class is intended to _only_ be used by OplkEventHandler and OplkQtApi.
+ */
+class EventJournalWriter : public QThread
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \brief Magic at the start of a journal file.
+	 */
+	static const char kMagic[8];
+
+	/**
+	 * \brief Version of the journal format.
+	 */
+	static const UINT32 kVersion = 1;
+
+	EventJournalWriter();
+
+	/**
+	 * \brief Stops the recording.
+	 */
+	virtual ~EventJournalWriter();
+
+	/**
+	 * \brief Creates the journal file and starts the recording.
+	 *
+	 * \param[in] fileName  Path of the journal file. An existing file is overwritten.
+	 * \retval true  If the recording has been started.
+	 * \retval false If the file could not be created or a recording is running.
+	 */
+	bool Open(const QString& fileName);
+
+	/**
+	 * \brief Stops the recording. The queued events are written before the
+	 * file is closed.
+	 */
+	void Close();
+
+	/**
+	 * \retval true  If events are recorded.
+	 * \retval false Otherwise.
+	 */
+	bool IsOpen() const;
+
+	/**
+	 * \brief Queues an event for the journal. Ignored if no recording is running.
+	 *
+	 * \param[in] eventType  Type of the event.
+	 * \param[in] eventArg   The event.
+	 */
+	void Record(const tOplkApiEventType eventType, const tOplkApiEventArg& eventArg);
+
+	/**
+	 * \return Number of events dropped since the recording has been started.
+	 */
+	ULONG GetDroppedEvents() const;
+
+	/**
+	 * \param[in] eventType  Type of the event.
+	 * \return The size of the member of tOplkApiEventArg which describes the
+	 * event. 0 if events of the type are not recorded.
+	 */
+	static UINT GetPayloadSize(const tOplkApiEventType eventType);
+
+protected:
+	/**
+	 * \brief Writes the queued events until the recording is stopped.
+	 */
+	virtual void run();
+
+private:
+	EventJournalWriter(const EventJournalWriter& writer);
+	EventJournalWriter& operator=(const EventJournalWriter& writer);
+
+	/**
+	 * \brief A queued event.
+	 */
+	struct Entry
+	{
+		qint64 timestamp;
+		tOplkApiEventType eventType;
+		tOplkApiEventArg eventArg;
+	};
+
+	/**
+	 * \brief Writes an event to the journal file.
+	 *
+	 * \param[in] entry  The event.
+	 * \retval true  If the event has been written.
+	 * \retval false Otherwise.
+	 */
+	bool Write(const Entry& entry);
+
+	mutable QMutex mutex;
+	QWaitCondition queueNotEmpty;
+	QAtomicInt recording;
+	QElapsedTimer clock;
+	QFile file;
+	std::vector<Entry> queue;   ///< Ring of queued events.
+	UINT queueHead;             ///< Index of the oldest queued event.
+	UINT queueCount;            ///< Number of queued events.
+	ULONG dropped;
+};
+
+#endif // _EVENT_JOURNAL_WRITER_H_
@@ -0,0 +1,154 @@
+/**
+********************************************************************************
+\file   LocalObjectDictionary.h
+
+\brief  Typed synchronous access to the local object dictionary.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _LOCAL_OBJECT_DICTIONARY_H_
+#define _LOCAL_OBJECT_DICTIONARY_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <oplk/oplk.h>
+
+/**
+ * \brief Compile-time check of the value type of a local object.
+ *
+ * Only defined for the sizes of the POWERLINK basic data types, so accessing
+ * an object with any other type does not compile.
+ */
+template<UINT size>
+struct LocalObjectSize;
+
+template<> struct LocalObjectSize<1> { static const UINT kSize = 1; };
+template<> struct LocalObjectSize<2> { static const UINT kSize = 2; };
+template<> struct LocalObjectSize<4> { static const UINT kSize = 4; };
+template<> struct LocalObjectSize<8> { static const UINT kSize = 8; };
+
+/**
+ * \brief Typed synchronous access to the local object dictionary.
+ *
+ * The functions call the object dictionary of the stack directly. They
+ * neither allocate memory nor involve the SDO stack or any signal, so they
+ * can be used from any thread once the stack has been initialized.
+ *
+ * The value type has to have the size of the object: reading or writing an
+ * UNSIGNED32 object requires a 4 byte type.
+ */
+class LocalObjectDictionary
+{
+public:
+	/**
+	 * \brief   Reads an object of the local object dictionary.
+	 *
+	 * \param[in] index      Index of the object.
+	 * \param[in] subIndex   Subindex of the object.
+	 * \param[out] value     The value. Unchanged on error.
+	 * \retval kErrorOk                  On success.
+	 * \retval kErrorObdValueLengthError If the object has another size than T.
+	 * \return Other errors of oplk_readLocalObject.
+	 */
+	template<typename T>
+	static tOplkError ReadLocal(const UINT index,
+						const UINT subIndex,
+						T& value)
+	{
+		T data;
+		UINT dataSize = LocalObjectSize<sizeof(T)>::kSize;
+		tOplkError oplkRet = oplk_readLocalObject(index, subIndex, &data, &dataSize);
+		if (oplkRet != kErrorOk)
+			return oplkRet;
+
+		if (dataSize != sizeof(T))
+			return kErrorObdValueLengthError;
+
+		value = data;
+		return kErrorOk;
+	}
+
+	/**
+	 * \brief   Writes an object of the local object dictionary.
+	 *
+	 * \param[in] index      Index of the object.
+	 * \param[in] subIndex   Subindex of the object.
+	 * \param[in] value      The value.
+	 * \return kErrorOk or the error of oplk_writeLocalObject.
+	 */
+	template<typename T>
+	static tOplkError WriteLocal(const UINT index,
+						const UINT subIndex,
+						const T& value)
+	{
+		T data = value;
+		return oplk_writeLocalObject(index, subIndex, &data,
+						LocalObjectSize<sizeof(T)>::kSize);
+	}
+
+	/**
+	 * \brief   Reads consecutive subindices of an object of the local object
+	 *          dictionary.
+	 *
+	 * Reading stops at the first error.
+	 *
+	 * \param[in] index          Index of the object.
+	 * \param[in] firstSubIndex  Subindex of the first value.
+	 * \param[out] values        Buffer for at least count values.
+	 * \param[in] count          Number of values to be read.
+	 * \param[out] readCount     Number of values read.
+	 * \return kErrorOk or the error of the first failed read.
+	 */
+	template<typename T>
+	static tOplkError ReadLocalRange(const UINT index,
+						const UINT firstSubIndex,
+						T* values,
+						const UINT count,
+						UINT& readCount)
+	{
+		tOplkError oplkRet = kErrorOk;
+		for (readCount = 0; readCount < count; ++readCount)
+		{
+			oplkRet = LocalObjectDictionary::ReadLocal(index,
+							firstSubIndex + readCount,
+							values[readCount]);
+			if (oplkRet != kErrorOk)
+				break;
+		}
+		return oplkRet;
+	}
+
+private:
+	LocalObjectDictionary();
+	LocalObjectDictionary(const LocalObjectDictionary& rhs);
+	LocalObjectDictionary& operator=(const LocalObjectDictionary& rhs);
+};
+
+#endif // _LOCAL_OBJECT_DICTIONARY_H_
@@ -0,0 +1,103 @@
+/**
+********************************************************************************
+\file   LogRecordRing.h
+
+\brief  Lock-free ring buffer which transports LogRecords out of the
+		event callback of the stack.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _LOG_RECORD_RING_H_
+#define _LOG_RECORD_RING_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QAtomicInt>
+
+#include "user/LogRecord.h"
+
+/**
+ * \brief Bounded single-producer single-consumer queue of LogRecords.
+ *
+ * The event callback of the stack pushes records without taking a lock or
+ * allocating memory. The thread which formats the records pops them.
+ * If the ring is full, new records are dropped and counted.
+ *
+ * \note Push() must only be called from one thread and Pop() from one
+ *       other thread at a time.
+ */
+class LogRecordRing
+{
+public:
+	/**
+	 * \brief Number of records the ring can hold. Must be a power of two.
+	 */
+	static const int kCapacity = 1024;
+
+	LogRecordRing();
+
+	/**
+	 * \brief Appends a record. Called by the producer.
+	 *
+	 * \param[in] record  The record.
+	 * \retval true  If the record was queued.
+	 * \retval false If the ring is full and the record was dropped.
+	 */
+	bool Push(const LogRecord& record);
+
+	/**
+	 * \brief Removes the oldest record. Called by the consumer.
+	 *
+	 * \param[out] record  The removed record.
+	 * \retval true  If a record was removed.
+	 * \retval false If the ring is empty.
+	 */
+	bool Pop(LogRecord& record);
+
+	/**
+	 * \return Number of records dropped since the last call. The counter is reset.
+	 */
+	UINT TakeDropped();
+
+private:
+	LogRecordRing(const LogRecordRing& ring);
+	LogRecordRing& operator=(const LogRecordRing& ring);
+
+	/*
+	 * Head and tail run from 0 to 2 * kCapacity - 1, so that a full and an
+	 * empty ring can be distinguished without an additional counter.
+	 */
+	QAtomicInt head;
+	QAtomicInt tail;
+	QAtomicInt dropped;
+	LogRecord records[kCapacity];
+};
+
+#endif // _LOG_RECORD_RING_H_
@@ -0,0 +1,158 @@
+/**
+********************************************************************************
+\file   NodeEventBatcher.h
+
+\brief  Accumulates the events of the remote nodes and delivers them in batches.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NODE_EVENT_BATCHER_H_
+#define _NODE_EVENT_BATCHER_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QObject>
+#include <QtCore/QMutex>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+#include <QtCore/QAtomicInt>
+
+#include "user/NodeEvent.h"
+
+/**
+ * \brief Collects the node found and node state events of the stack and
+ * delivers them as one batch per window.
+ *
+ * A batch is delivered when the window after the first event of the batch
+ * has elapsed or when the configured number of events is reached. Several
+ * state changes of a node within one batch are collapsed into one
+ * NodeEvent. Nodes without a net change are not reported.
+ *
+ * \note The events are added from the event callback of the stack.
+ *       The batches are delivered in the thread of the batcher.
+ * \note This class is intended to _only_ be used by OplkEventHandler and OplkQtApi.
+ */
+class NodeEventBatcher : public QObject
+{
+	Q_OBJECT
+
+public:
+	NodeEventBatcher();
+
+	/**
+	 * \brief Starts to collect node events.
+	 *
+	 * \param[in] window    Time in ms after the first event until a batch is delivered.
+	 * \param[in] maxCount  Number of events after which a batch is delivered
+	 *                      before the window has elapsed. 0 for no limit.
+	 */
+	void Enable(const UINT window, const UINT maxCount);
+
+	/**
+	 * \brief Stops to collect node events. Collected events are delivered.
+	 */
+	void Disable();
+
+	/**
+	 * \retval true  If the node events are collected.
+	 * \retval false Otherwise.
+	 */
+	bool IsEnabled() const;
+
+	/**
+	 * \brief Adds a node found event. Ignored if the batcher is disabled.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	void AddNodeFound(const UINT nodeId);
+
+	/**
+	 * \brief Adds a node state event. Ignored if the batcher is disabled.
+	 *
+	 * \param[in] nodeId    Node id of the node.
+	 * \param[in] nmtState  The new NMT state of the node.
+	 */
+	void AddNodeStateChanged(const UINT nodeId, const tNmtState nmtState);
+
+signals:
+	/**
+	 * \brief This signal is emitted for every batch of node events.
+	 *
+	 * \param[in] events  The net changes of the nodes, ordered by node id.
+	 */
+	void SignalNodeEvents(const QVector<NodeEvent> events);
+
+private slots:
+	/**
+	 * \brief Starts the window of a batch.
+	 */
+	void StartWindow();
+
+	/**
+	 * \brief Delivers the collected events.
+	 */
+	void Flush();
+
+private:
+	NodeEventBatcher(const NodeEventBatcher& batcher);
+	NodeEventBatcher& operator=(const NodeEventBatcher& batcher);
+
+	static const UINT kMaxNodes = 256;
+
+	/**
+	 * \brief The changes of a node within the current batch.
+	 */
+	struct PendingNodeEvent
+	{
+		bool pending;
+		bool found;
+		tNmtState oldState;
+		qint64 timestamp;
+	};
+
+	/**
+	 * \brief Records an event of a node. Must be called with the mutex locked.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	void AddEvent(const UINT nodeId);
+
+	QMutex mutex;
+	QAtomicInt enabled;
+	UINT window;
+	UINT maxCount;
+	UINT eventCount;
+	bool flushScheduled;
+	QTimer timer;
+	PendingNodeEvent pendingEvents[kMaxNodes];
+	tNmtState nodeStates[kMaxNodes];    ///< Last known NMT state of each node.
+};
+
+#endif // _NODE_EVENT_BATCHER_H_
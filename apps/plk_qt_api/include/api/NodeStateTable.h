@@ -0,0 +1,162 @@
+/**
+********************************************************************************
+\file   NodeStateTable.h
+
+\brief  Table of the last known states of the remote nodes.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NODE_STATE_TABLE_H_
+#define _NODE_STATE_TABLE_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QAtomicInt>
+#include <QtCore/QVector>
+
+#include "user/NodeState.h"
+
+/**
+ * \brief Lock-free table of the states of all 256 node ids.
+ *
+ * The table is written only by the event callback of the stack. Each entry
+ * is protected by a sequence counter: the writer makes the counter odd
+ * while it updates the entry and a reader repeats its read until it got an
+ * even and unchanged counter. Readers never block the writer.
+ *
+ * A generation counter is incremented after every update, so that pollers
+ * can skip reading an unchanged table.
+ *
+ * \note This class is intended to _only_ be used by OplkEventHandler and OplkQtApi.
+ */
+class NodeStateTable
+{
+public:
+	/**
+	 * \brief Number of entries of the table. One per node id.
+	 */
+	static const UINT kMaxNodes = 256;
+
+	NodeStateTable();
+
+	/**
+	 * \brief Marks the node as found. Called by the writer.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	void SetFound(const UINT nodeId);
+
+	/**
+	 * \brief Updates the NMT state of the node. Called by the writer.
+	 *
+	 * \param[in] nodeId    Node id of the node.
+	 * \param[in] nmtState  The new NMT state of the node.
+	 */
+	void SetNmtState(const UINT nodeId, const tNmtState nmtState);
+
+	/**
+	 * \brief Counts an error event of the node. Called by the writer.
+	 *
+	 * \param[in] nodeId     Node id of the node.
+	 * \param[in] errorCode  Emergency error code of the event.
+	 */
+	void AddError(const UINT nodeId, const UINT16 errorCode);
+
+	/**
+	 * \brief Clears all entries. Called by the writer.
+	 */
+	void Reset();
+
+	/**
+	 * \param[in] nodeId  Node id of the node.
+	 * \return Consistent state of the node. An empty state for invalid node ids.
+	 */
+	NodeState GetNodeState(const UINT nodeId) const;
+
+	/**
+	 * \return The states of all nodes which have been found or reported a
+	 * state since the last reset, ordered by node id.
+	 *
+	 * \note Each entry is consistent by itself. Entries may be updated
+	 *       while the table is copied.
+	 */
+	QVector<NodeState> SnapshotNodes() const;
+
+	/**
+	 * \return The number of updates of the table.
+	 */
+	UINT GetGeneration() const;
+
+private:
+	NodeStateTable(const NodeStateTable& table);
+	NodeStateTable& operator=(const NodeStateTable& table);
+
+	/**
+	 * \brief A single entry of the table. All fields are only accessed
+	 * within the sequence protocol.
+	 */
+	struct Entry
+	{
+		QAtomicInt sequence;
+		QAtomicInt nmtState;
+		QAtomicInt lastChangeHigh;
+		QAtomicInt lastChangeLow;
+		QAtomicInt found;
+		QAtomicInt errorCount;
+		QAtomicInt lossCount;
+		QAtomicInt lastErrorCode;
+	};
+
+	/**
+	 * \brief Starts the update of an entry. The sequence becomes odd.
+	 *
+	 * \param[in] entry  The entry.
+	 */
+	void BeginWrite(Entry& entry);
+
+	/**
+	 * \brief Finishes the update of an entry and counts the update.
+	 *
+	 * \param[in] entry  The entry.
+	 */
+	void EndWrite(Entry& entry);
+
+	/**
+	 * \brief Sets the time of the last change of an entry to now.
+	 *
+	 * \param[in] entry  The entry.
+	 */
+	static void SetLastChange(Entry& entry);
+
+	Entry entries[kMaxNodes];
+	QAtomicInt generation;
+};
+
+#endif // _NODE_STATE_TABLE_H_
@@ -0,0 +1,326 @@
+/**
+********************************************************************************
+\file   ObjectDictionaryCache.h
+
+\brief  Definitions of the object dictionary value cache
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _OBJECT_DICTIONARY_CACHE_H_
+#define _OBJECT_DICTIONARY_CACHE_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <list>
+#include <map>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QMetaMethod>
+#include <QtCore/QMutex>
+#include <QtCore/QPointer>
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+#include "user/ObjectCachePolicy.h"
+#include "user/SdoTransferResult.h"
+#include "api/LocalObjectDictionary.h"
+
+/**
+ * \brief Caches the values of frequently read object dictionary entries.
+ *
+ * The entries are identified by node id, index and subindex; node id 0
+ * identifies the local object dictionary. Only entries with a policy other
+ * than ObjectCachePolicy::UNDEFINED are cached. A valid entry is served from
+ * the cache. Otherwise the object is read from the stack; reads of the same
+ * object by several callers at once share one SDO transfer.
+ *
+ * The entries are invalidated according to their policy by the NMT state
+ * and PDO mapping change events of the stack. A reset of the local node
+ * invalidates all entries.
+ *
+ * \note Remote reads require an event loop in the thread of the cache.
+ */
+class PLKQTAPI_EXPORT ObjectDictionaryCache : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \return Returns the instance of the class.
+	 */
+	static ObjectDictionaryCache& GetInstance();
+
+	/**
+	 * \brief   Sets the cache policy of an object.
+	 *
+	 * A cached value of the object is invalidated.
+	 *
+	 * \param[in] nodeId      Node id. 0 or the node id of the local node.
+	 * \param[in] index       Index of the object.
+	 * \param[in] subIndex    Subindex of the object.
+	 * \param[in] policy      The cache policy.
+	 * \param[in] timeToLive  Time in ms a value stays valid. Only used by
+	 *                        ObjectCachePolicy::TIME_TO_LIVE.
+	 */
+	void SetPolicy(const UINT nodeId,
+				const UINT index,
+				const UINT subIndex,
+				const ObjectCachePolicy::ObjectCachePolicy policy,
+				const ULONG timeToLive = 0);
+
+	/**
+	 * \brief   Reads an object of the local object dictionary.
+	 *
+	 * \param[in] index          Index of the object.
+	 * \param[in] subIndex       Subindex of the object.
+	 * \param[out] data          Buffer for the value.
+	 * \param[in,out] dataSize   Size of the buffer; the size of the value
+	 *                           on return.
+	 * \return kErrorOk or the error of oplk_readLocalObject.
+	 */
+	tOplkError ReadLocal(const UINT index,
+						const UINT subIndex,
+						void* data,
+						UINT* dataSize);
+
+	/**
+	 * \brief   Reads an object of the local object dictionary into a value
+	 *          of the size of the object.
+	 *
+	 * \param[in] index      Index of the object.
+	 * \param[in] subIndex   Subindex of the object.
+	 * \param[out] value     The value. Unchanged on error.
+	 * \return kErrorOk, kErrorObdValueLengthError if the object has another
+	 *         size than T, or the error of oplk_readLocalObject.
+	 */
+	template<typename T>
+	tOplkError ReadLocal(const UINT index,
+						const UINT subIndex,
+						T& value)
+	{
+		T data;
+		UINT dataSize = LocalObjectSize<sizeof(T)>::kSize;
+		tOplkError oplkRet = this->ReadLocal(index, subIndex, (void*) &data, &dataSize);
+		if (oplkRet != kErrorOk)
+			return oplkRet;
+
+		if (dataSize != sizeof(T))
+			return kErrorObdValueLengthError;
+
+		value = data;
+		return kErrorOk;
+	}
+
+	/**
+	 * \brief   Reads an object of a remote node.
+	 *
+	 * The result is delivered to the receiver function through a queued
+	 * invocation, also if the value is served from the cache. A read joins
+	 * a read of the same object and size in flight, unless that read has
+	 * been invalidated. A cached value is limited to dataSize.
+	 *
+	 * \param[in] nodeId            Node id of the remote node.
+	 * \param[in] index             Index of the object.
+	 * \param[in] subIndex          Subindex of the object.
+	 * \param[in] dataSize          Maximum size of the value in bytes.
+	 * \param[in] receiver          Receiver object.
+	 * \param[in] receiverFunction  Receiver function. Its signature has to be
+	 *                              'void (const SdoTransferResult, const QByteArray)'.
+	 * \param[in] sdoType           The protocol type.
+	 * \retval true  If the result will be delivered.
+	 * \retval false If the receiver function is invalid or the transfer
+	 *               could not be queued.
+	 */
+	bool Read(const UINT nodeId,
+			const UINT index,
+			const UINT subIndex,
+			const UINT dataSize,
+			const QObject& receiver,
+			const QMetaMethod& receiverFunction,
+			tSdoType sdoType = kSdoTypeAsnd);
+
+	/**
+	 * \brief   Invalidates the cached value of an object.
+	 *
+	 * \param[in] nodeId    Node id. 0 or the node id of the local node.
+	 * \param[in] index     Index of the object.
+	 * \param[in] subIndex  Subindex of the object.
+	 */
+	void Invalidate(const UINT nodeId, const UINT index, const UINT subIndex);
+
+	/**
+	 * \brief   Invalidates all cached values.
+	 */
+	void InvalidateAll();
+
+	/**
+	 * \return Number of reads served from the cache.
+	 */
+	ULONG GetHitCount() const;
+
+	/**
+	 * \return Number of reads forwarded to the stack.
+	 */
+	ULONG GetMissCount() const;
+
+	/**
+	 * \return Number of remote reads which joined a transfer in flight.
+	 */
+	ULONG GetCoalescedCount() const;
+
+private slots:
+	/**
+	 * \brief   Receives the results of the remote reads.
+	 *
+	 * \param[in] transferId  Id of the SDO transfer.
+	 * \param[in] result      The result of the SDO transfer.
+	 */
+	void HandleSdoTransferFinished(const ULONG transferId,
+						const SdoTransferResult result);
+
+	/**
+	 * \brief   Invalidates the entries of a remote node on NMT state changes.
+	 *
+	 * \param[in] nodeId    Node id of the node.
+	 * \param[in] nmtState  The new NMT state of the node.
+	 */
+	void HandleNodeStateChanged(const int nodeId, tNmtState nmtState);
+
+	/**
+	 * \brief   Invalidates the entries of the local node on NMT state changes.
+	 *
+	 * \param[in] nmtState  The new NMT state of the local node.
+	 */
+	void HandleLocalNodeStateChanged(tNmtState nmtState);
+
+	/**
+	 * \brief   Invalidates the entries depending on the PDO mapping of a node.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	void HandlePdoChanged(const int nodeId);
+
+private:
+	/**
+	 * \brief A cached object.
+	 */
+	struct CacheEntry
+	{
+		ObjectCachePolicy::ObjectCachePolicy policy;
+		qint64 timeToLive;
+		bool valid;
+		qint64 readTime;    ///< Time of the read, relative to ObjectDictionaryCache::clock.
+		QByteArray data;
+	};
+
+	/**
+	 * \brief A caller waiting for a remote read.
+	 */
+	struct Waiter
+	{
+		QPointer<QObject> receiver;
+		QMetaMethod receiverFunction;
+	};
+
+	/**
+	 * \brief A remote read in flight.
+	 */
+	struct PendingRead
+	{
+		ULONG transferId;    ///< Id of the transfer in the SdoScheduler.
+		UINT dataSize;
+		QByteArray buffer;
+		std::vector<Waiter> waiters;
+		bool invalidated;    ///< The value is delivered but not cached.
+	};
+
+	/// The reads in flight of an object. The buffers are not moved while the transfers run.
+	typedef std::list<PendingRead> PendingReadList;
+
+	mutable QMutex mutex;
+	std::map<quint32, CacheEntry> entries;
+	std::map<quint32, PendingReadList> pendingReads;
+	QElapsedTimer clock;
+	ULONG hitCount;
+	ULONG missCount;
+	ULONG coalescedCount;
+
+	ObjectDictionaryCache();
+	ObjectDictionaryCache(const ObjectDictionaryCache& cache);
+	ObjectDictionaryCache& operator=(const ObjectDictionaryCache& cache);
+
+	/**
+	 * \return The key of the object in the maps. The local node has the
+	 *         same key for node id 0 and its own node id.
+	 */
+	static quint32 GetKey(const UINT nodeId, const UINT index, const UINT subIndex);
+
+	/**
+	 * \param[in] key  The key of the object.
+	 * \return The valid entry of the object. NULL if the object is not
+	 *         cached or its value is invalid.
+	 * \note The mutex has to be locked by the caller.
+	 */
+	const CacheEntry* FindValidEntry(const quint32 key);
+
+	/**
+	 * \brief   Stores the value of an object with a cache policy.
+	 * \note The mutex has to be locked by the caller.
+	 */
+	void Store(const quint32 key, const QByteArray& data);
+
+	/**
+	 * \brief   Invalidates the entries of a node.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 * \param[in] policy  Only the entries with this policy are invalidated.
+	 * \note The mutex has to be locked by the caller.
+	 */
+	void InvalidateNode(const UINT nodeId,
+					const ObjectCachePolicy::ObjectCachePolicy policy);
+
+	/**
+	 * \brief   Invalidates the entry and the reads in flight of an object.
+	 * \note The mutex has to be locked by the caller.
+	 */
+	void InvalidateKey(const quint32 key);
+
+	/**
+	 * \brief   Marks the reads in flight of an object as invalidated.
+	 * \note The mutex has to be locked by the caller.
+	 */
+	void InvalidatePendingReads(const quint32 key);
+};
+
+#endif // _OBJECT_DICTIONARY_CACHE_H_
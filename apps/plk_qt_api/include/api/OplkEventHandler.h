@@ -48,7 +48,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <oplkcfg.h>
 
 #include "api/ReceiverContext.h"
+#include "api/LogRecordRing.h"
+#include "api/NodeEventBatcher.h"
+#include "api/NodeStateTable.h"
+#include "api/PdoMappingModel.h"
+#include "api/ErrorStatistics.h"
+#include "api/EventJournalWriter.h"
 #include "user/SdoTransferResult.h"
+#include "user/LogRecord.h"
+#include "user/CriticalError.h"
 
 /**
  * \brief Thread used to receive openPOWERLINK-Stack asynchronous callback events.
@@ -65,6 +73,8 @@ class OplkEventHandler : public QThread
 private:
 
 	friend class OplkQtApi;
+	friend class EventJournalReplay;
+	friend class ShutdownSequencer;
 
 	OplkEventHandler();
 	OplkEventHandler(const OplkEventHandler& eventHandler);
@@ -72,6 +82,17 @@ private:
 
 	QMutex          mutex;
 	QWaitCondition  nmtGsOffCondition;
+	bool            nmtGsOff;       ///< The local node is in NMT_GS_OFF. Guarded by mutex.
+	bool            stackInitialised; ///< The stack is initialised. Guarded by mutex.
+	LogRecordRing   logRecords;
+	QAtomicInt      logDrainPending;
+	QAtomicInt      logLevels[LogCategory::NUMBER_OF_CATEGORIES];
+	NodeEventBatcher nodeEventBatcher;
+	NodeStateTable  nodeStateTable;
+	PdoMappingModel pdoMappingModel;
+	ErrorStatistics errorStatistics;
+	EventJournalWriter journalWriter;
+	QAtomicInt      replaying;      ///< Events are replayed from a journal. The stack is not accessed.
 
 	/**
 	 * \return Returns the instance of the class
@@ -96,8 +117,45 @@ private:
 
 	/**
 	 * \brief   Waits until the NMT state NMT_GS_OFF is reached
+	 *
+	 * Returns immediately if the local node is already switched off.
+	 *
+	 * \param[in] timeout  Maximum time to wait in ms.
+	 * \retval true  If the local node is in NMT_GS_OFF.
+	 * \retval false If the timeout has elapsed.
+	 */
+	bool AwaitNmtGsOff(const ULONG timeout);
+
+	/**
+	 * \brief   Marks the local node as leaving NMT_GS_OFF.
+	 *
+	 * Has to be called before the NMT s/w reset is issued, so a following
+	 * AwaitNmtGsOff() does not return before the reset has been processed.
+	 */
+	void ClearNmtGsOff();
+
+	/**
+	 * \brief   Records whether the stack is initialised.
+	 *
+	 * \param[in] initialised  true before oplk_init, false after oplk_shutdown.
+	 * \retval true  If the state has been recorded.
+	 * \retval false If an event journal is being replayed. The stack must
+	 *               not be initialised.
+	 */
+	bool SetStackInitialised(const bool initialised);
+
+	/**
+	 * \brief   Starts feeding replayed events through AppCbEvent.
+	 *
+	 * \retval true  If the replay may start.
+	 * \retval false If the stack is initialised or another replay is running.
+	 */
+	bool BeginReplay();
+
+	/**
+	 * \brief   Ends the replay started by BeginReplay().
 	 */
-	void AwaitNmtGsOff();
+	void EndReplay();
 
 	/**
 	 * \brief   Process the NMT state change events of the local node.
@@ -205,30 +263,107 @@ private:
 	void TriggerNodeStateChanged(const int nodeId, tNmtState nmtState);
 
 	/**
-	 * \brief   Triggers a signal OplkEventHandler::SignalPrintLog with the
-	 *  log message for all the events occurred.
+	 * \brief   Sets the minimum severity of the logged events of a category.
+	 *
+	 * \param[in] category  The category.
+	 * \param[in] minimum   Events with a lower severity are not logged.
+	 */
+	void SetLogLevel(const LogCategory::LogCategory category,
+					 const LogSeverity::LogSeverity minimum);
+
+	/**
+	 * \param[in] category  The category.
+	 * \return The minimum severity of the logged events of the category.
+	 */
+	LogSeverity::LogSeverity GetLogLevel(const LogCategory::LogCategory category) const;
+
+	/**
+	 * \brief   Checks whether events of the type are logged.
 	 *
-	 * \param[in] logStr  Formatted log message.
+	 * Called before a record is created, so that events of disabled
+	 * categories or without any logger cost no further work.
+	 *
+	 * \param[in] type  Type of the event.
+	 * \retval true  If the severity of the type reaches the level of its
+	 *               category and a logger is registered.
+	 * \retval false Otherwise.
+	 */
+	bool IsLogEnabled(const LogRecordType::LogRecordType type) const;
+
+	/**
+	 * \brief   Queues the record of an event for the logger.
+	 *
+	 * The record is not formatted here. OplkEventHandler::DrainLogRecords
+	 * is scheduled in the thread of the event handler if it is not yet pending.
+	 *
+	 * \param[in] record  The record of the event.
+	 *
+	 * \note Must only be called from the event callback of the stack.
 	 */
-	void TriggerPrintLog(const QString logStr);
+	void TriggerLogRecord(const LogRecord& record);
 
 	/**
-	 * \brief   Triggers a signal OplkEventHandler::SignalSdoTransferFinished
-	 *  when SDO transfer to the remote node has finished.
+	 * \brief   Logs the number of occurrences of an error which have not been
+	 *  logged because of the rate limit. Nothing is logged for 0.
+	 *
+	 * \param[in] nodeId      Node id of the node. 0 for the local node.
+	 * \param[in] errorCode   The error code.
+	 * \param[in] suppressed  Number of occurrences which have not been logged.
+	 *
+	 * \note Must only be called from the event callback of the stack.
+	 */
+	void TriggerErrorsSuppressed(const UINT nodeId,
+								const UINT16 errorCode,
+								const ULONG suppressed);
+
+	/**
+	 * \brief   Delivers the result of a finished SDO transfer to the remote
+	 *  node to the target of the transfer.
+	 *
+	 * Transfers without a ReceiverContext trigger the signal
+	 * OplkEventHandler::SignalSdoTransferFinished instead.
 	 *
 	 * \param[in] result               The result of the SDO transfer.
-	 * \param[in,out] receiverContext  The details of the receiver object.
+	 * \param[in,out] receiverContext  The target of the transfer. It is deleted.
 	 */
 	void TriggerSdoTransferFinished(const tSdoComFinished& result,
+									ReceiverContext* receiverContext);
+
+	/**
+	 * \brief   Delivers the progress of a running segmented SDO transfer to
+	 *  the target of the transfer.
+	 *
+	 * \param[in] progress         The state of the running SDO transfer.
+	 * \param[in] receiverContext  The target of the transfer. May be NULL.
+	 */
+	void TriggerSdoTransferProgress(const tSdoComFinished& progress,
 									const ReceiverContext* receiverContext);
 
 	/**
-	 * \brief Triggers a signal OplkEventHandler::SignalCriticalError to the
-	 * application
+	 * \brief Triggers the signals OplkEventHandler::SignalCriticalError and
+	 * OplkEventHandler::SignalCriticalErrorOccurred to the application
+	 *
+	 * \param[in] error  The decoded and classified error.
+	 */
+	void TriggerCriticalError(const CriticalError& error);
+
+	/**
+	 * \brief   Triggers a signal OplkEventHandler::SignalPdoChanged when the
+	 *  PDO mapping to or from a node has been activated or deleted.
 	 *
-	 * \param[in] errorMessage Detailed message about the error occurred.
+	 * \param[in] nodeId  The node id of the respective node
 	 */
-	void TriggerCriticalError(const QString errorMessage);
+	void TriggerPdoChanged(const int nodeId);
+
+private slots:
+	/**
+	 * \brief   Delivers the queued log records.
+	 *
+	 * Triggers the signal OplkEventHandler::SignalLogRecord for each record.
+	 * The records are formatted for OplkEventHandler::SignalPrintLog only
+	 * if a logger is registered.
+	 */
+	void DrainLogRecords();
 
 signals:
 	/**
@@ -260,6 +395,13 @@ signals:
 	 */
 	void SignalPrintLog(const QString &logStr);
 
+	/**
+	 * \brief   This signal is emitted for every event logged by the stack.
+	 *
+	 * \param[in] record  Unformatted record of the event.
+	 */
+	void SignalLogRecord(const LogRecord record);
+
 	/**
 	 * \brief   This signal is emitted when the SDO transfer has happened/aborted.
 	 *
@@ -274,6 +416,22 @@ signals:
 	 */
 	void SignalCriticalError(const QString& errorMessage);
 
+	/**
+	 * \brief This signal is emitted along with SignalCriticalError and carries
+	 *        the decoded and classified error.
+	 *
+	 * \param[in] error  The critical error.
+	 */
+	void SignalCriticalErrorOccurred(const CriticalError error);
+
+	/**
+	 * \brief   This signal is emitted when the PDO mapping to or from the
+	 *          node has changed.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	void SignalPdoChanged(const int nodeId);
+
 };
 
 #endif // _OPLK_EVENT_HANDLER_H_
@@ -40,8 +40,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 //#include <QObject>
 #include <QtCore/QMetaMethod>
+#include <QtCore/QVector>
+#include <QtCore/QString>
 
 #include <string>
+#include <vector>
 
 #include <oplk/oplk.h>
 #include <oplk/nmt.h>
@@ -49,6 +52,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "user/SdoTransferResult.h"
 #include "user/SdoTransferJob.h"
+#include "user/LogCategory.h"
+#include "user/LogSeverity.h"
+#include "user/NodeEvent.h"
+#include "user/NodeState.h"
+#include "user/ErrorStatisticsEntry.h"
+#include "user/PdoMapping.h"
+#include "user/PdoChannelLocation.h"
+#include "user/ReloadOutcome.h"
 #include "api/ReceiverContext.h"
 #include "common/QtApiGlobal.h"
 #include "user/processimage/ProcessImageIn.h"
@@ -73,6 +84,8 @@ public:
 	 *
 	 * \param[in] nodeId            Id assigned to the node (ie. The local stack-instance; referred as local node-id)
 	 * \param[in] networkInterface  Network interface.
+	 * \return kErrorInvalidOperation while an event journal is replayed,
+	 *         otherwise the error of oplk_init.
 	 */
 	static tOplkError InitStack(const UINT nodeId,
 								const std::string& networkInterface);
@@ -84,9 +97,63 @@ public:
 
 	/**
 	 * \brief   Stop openPOWERLINK-Stack.
+	 *
+	 * Runs a ShutdownSequencer with the default deadlines. The stack is
+	 * released also if a phase fails or times out.
+	 *
+	 * \return kErrorOk or the error of the first failed shutdown phase.
 	 */
 	static tOplkError StopStack();
 
+	/**
+	 * \brief   Restarts the network without shutting down the stack.
+	 *
+	 * The local node is reset by kNmtEventSwReset. The stack instance, the
+	 * CDC, the ProcessImage and the threads are reused, so the restart
+	 * takes only the boot-up time of the network. The scheduled SDO
+	 * transfers are aborted.
+	 *
+	 * \return kErrorOk or the error of oplk_execNmtCommand.
+	 */
+	static tOplkError RestartStack();
+
+	/**
+	 * \brief   Shut down an openPOWERLINK-Stack which has been initialised
+	 *          but not started.
+	 *
+	 * Frees the ProcessImage, if allocated, and releases the stack. Use it to
+	 * undo InitStack() if the start-up is aborted before StartStack().
+	 */
+	static tOplkError ShutdownStack();
+
+	/**
+	 * \brief   Reloads the configuration of the running openPOWERLINK-Stack.
+	 *
+	 * Activates a new CDC and ProcessImage without shutting down the stack.
+	 * - If the size of the ProcessImage is unchanged, the new CDC is
+	 *   activated by a NMT reset configuration and the memory of the
+	 *   ProcessImage is reused.
+	 * - Otherwise the local node is switched off, the ProcessImage is
+	 *   reallocated and the stack is restarted by a NMT s/w reset.
+	 *
+	 * The synchronous ProcessImage exchange is paused until the new
+	 * ProcessImage is in place.
+	 *
+	 * \param[in]     cdcFileName  File name of the new CDC.
+	 * \param[in,out] in           The instance of the new ProcessImageIn.
+	 * \param[in,out] out          The instance of the new ProcessImageOut.
+	 * \param[out]    outcome      The ProcessImage in use on return, also
+	 *                             on error.
+	 * \return a tOplkError error code.
+	 * \note If any step fails after the old ProcessImage has been freed the
+	 *       stack is shut down (ReloadOutcome::SHUT_DOWN) and has to be
+	 *       initialised again with InitStack().
+	 */
+	static tOplkError ReloadConfiguration(const std::string& cdcFileName,
+										ProcessImageIn& in,
+										ProcessImageOut& out,
+										ReloadOutcome::ReloadOutcome& outcome);
+
 	/**
 	 * \brief   Send a NMT command to the specified node.
 	 *
@@ -107,12 +174,33 @@ public:
 	 * \param[in] receiver          Receiver object.
 	 * \param[in] receiverFunction  Receiver function where the result is received.
 	 *
-	 * \see OplkEventHandler::SignalSdoTransferFinished(const SdoTransferResult);
+	 * \note Only the receiver of this transfer is notified. The result is
+	 *       dropped if the receiver is deleted before the transfer finishes.
 	 */
 	static tOplkError TransferObject(const SdoTransferJob& sdoTransferJob,
 									const QObject& receiver,
 									const QMetaMethod& receiverFunction);
 
+	/**
+	 * \brief   Performs an SDO transfer and reports the result to a callback.
+	 *
+	 * The callback is called from the stack event thread, without a round trip
+	 * through the Qt event loop.
+	 *
+	 * \param[in] sdoTransferJob  SDO transfer input parameters.
+	 * \param[in] callback        Callback for the result of a remote transfer.
+	 *                            The API takes the ownership and deletes it
+	 *                            after the result is reported or when the
+	 *                            transfer could not be started.
+	 * \param[out] sdoComConHdl   Optional. The SDO connection handle of the
+	 *                            transfer, e.g. to abort it by oplk_abortSdo().
+	 *
+	 * \note Local transfers finish immediately and do not call the callback.
+	 */
+	static tOplkError TransferObject(const SdoTransferJob& sdoTransferJob,
+									SdoTransferCallback* callback,
+									tSdoComConHdl* sdoComConHdl = NULL);
+
 	/**
 	 * \brief   Allocates the memory for the ProcessImage and updates the
 	 *          data pointer
@@ -230,6 +318,127 @@ public:
 	static bool UnregisterLocalNodeStateChangedEventHandler(const QObject& receiver,
 									const QMetaMethod& receiverFunction);
 
+	/**
+	 * \brief Returns the last known state of a remote node.
+	 *
+	 * The state is tracked from the node events of the stack since the last
+	 * communication reset. The call does not block the stack.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 * \return The state of the node.
+	 */
+	static NodeState GetNodeState(const UINT nodeId);
+
+	/**
+	 * \return The states of all nodes which have been found or reported a
+	 * state since the last communication reset, ordered by node id.
+	 */
+	static QVector<NodeState> SnapshotNodes();
+
+	/**
+	 * \return Number of updates of the node states. Pollers can skip
+	 * OplkQtApi::SnapshotNodes() while the number is unchanged.
+	 */
+	static UINT GetNodeStateGeneration();
+
+	/**
+	 * \return The occurrences of all error codes of all nodes, ordered by
+	 * node id and error code. Node id 0 holds the error history of the
+	 * local node.
+	 */
+	static std::vector<ErrorStatisticsEntry> GetErrorStatistics();
+
+	/**
+	 * \param[in] nodeId  Node id of the node. 0 for the local node.
+	 * \return The occurrences of the error codes of the node.
+	 */
+	static std::vector<ErrorStatisticsEntry> GetErrorStatistics(const UINT nodeId);
+
+	/**
+	 * \param[in] count  Maximum number of entries.
+	 * \return The error codes with the highest rate within the sliding
+	 * window of ErrorStatistics, then with the most occurrences.
+	 */
+	static std::vector<ErrorStatisticsEntry> GetTopErrorOffenders(const UINT count);
+
+	/**
+	 * \return Number of errors which have not been counted because the
+	 * table of the error statistics was full.
+	 */
+	static ULONG GetErrorStatisticsOverflowCount();
+
+	/**
+	 * \brief Clears the error statistics.
+	 */
+	static void ResetErrorStatistics();
+
+	/**
+	 * \brief Starts to deliver the node found and node state events in batches.
+	 *
+	 * The events of a batch are collected for the given window after the
+	 * first event or until maxCount events occurred. Intermediate states of
+	 * a node within a batch are collapsed. The single node events are still
+	 * delivered.
+	 *
+	 * \param[in] window    Time in ms after the first event until a batch is delivered.
+	 * \param[in] maxCount  Number of events after which a batch is delivered
+	 *                      before the window has elapsed. 0 for no limit.
+	 *
+	 * \see OplkQtApi::RegisterNodeEventBatchHandler
+	 */
+	static void EnableNodeEventBatching(const UINT window, const UINT maxCount);
+
+	/**
+	 * \brief Stops to deliver the node events in batches.
+	 *
+	 * Collected events are delivered immediately.
+	 */
+	static void DisableNodeEventBatching();
+
+	/**
+	 * \brief Registers the receiver for the batches of node events.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Registration successful.
+	 * \retval false  Registration not successful.
+	 *
+	 * \see NodeEventBatcher::SignalNodeEvents(const QVector<NodeEvent>)
+	 */
+	static bool RegisterNodeEventBatchHandler(const QObject& receiver,
+									const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Unregisters the receiver from the batches of node events.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Unregistration successful.
+	 * \retval false  Unregistration not successful.
+	 *
+	 * \see NodeEventBatcher::SignalNodeEvents(const QVector<NodeEvent>)
+	 */
+	static bool UnregisterNodeEventBatchHandler(const QObject& receiver,
+									const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Starts to record all events of the stack to a journal file.
+	 *
+	 * The journal can be replayed without a network by EventJournalReplay.
+	 *
+	 * \param[in] fileName  Path of the journal file. An existing file is overwritten.
+	 * \retval true  If the recording has been started.
+	 * \retval false If the file could not be created or a recording is running.
+	 */
+	static bool StartEventJournal(const QString& fileName);
+
+	/**
+	 * \brief Stops the recording of the event journal.
+	 *
+	 * \return Number of events which have been dropped during the recording.
+	 */
+	static ULONG StopEventJournal();
+
 	/**
 	 * \brief Registers for the formatted log events from the stack.
 	 *
@@ -256,6 +465,53 @@ public:
 	static bool UnregisterEventLogger(const QObject& receiver,
 									const QMetaMethod& receiverFunction);
 
+	/**
+	 * \brief Registers for the unformatted log records from the stack.
+	 *
+	 * The records are formatted on demand by LogRecord::ToString().
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Registration successful.
+	 * \retval false  Registration not successful.
+	 *
+	 * \see OplkEventHandler::SignalLogRecord(const LogRecord)
+	 */
+	static bool RegisterLogRecordHandler(const QObject& receiver,
+									const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Unregisters from receiving the unformatted log records from the stack.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Unregistration successful.
+	 * \retval false  Unregistration not successful.
+	 *
+	 * \see OplkEventHandler::SignalLogRecord(const LogRecord)
+	 */
+	static bool UnregisterLogRecordHandler(const QObject& receiver,
+									const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Sets the minimum severity of the logged events of a category.
+	 *
+	 * Events below the minimum are discarded in the event callback of the
+	 * stack before they are recorded. LogSeverity::DISABLED disables the
+	 * category. All categories log every event by default.
+	 *
+	 * \param[in] category  The category of the events.
+	 * \param[in] minimum   The minimum severity.
+	 */
+	static void SetLogLevel(const LogCategory::LogCategory category,
+							const LogSeverity::LogSeverity minimum);
+
+	/**
+	 * \param[in] category  The category of the events.
+	 * \return The minimum severity of the logged events of the category.
+	 */
+	static LogSeverity::LogSeverity GetLogLevel(const LogCategory::LogCategory category);
+
 	/**
 	 * \brief Registers for the sync events from the stack.
 	 *
@@ -358,15 +614,168 @@ public:
 	static bool UnregisterCriticalErrorEventHandler(const QObject& receiver,
 										const QMetaMethod& receiverFunction);
 
+	/**
+	 * \brief Registers for the decoded and classified critical errors from
+	 * the stack.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Registration successful.
+	 * \retval false  Registration not successful.
+	 *
+	 * \see OplkEventHandler::SignalCriticalErrorOccurred(const CriticalError)
+	 */
+	static bool RegisterCriticalErrorOccurredEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Unregisters from receiving the classified critical errors.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Unregistration successful.
+	 * \retval false  Unregistration not successful.
+	 *
+	 * \see OplkEventHandler::SignalCriticalErrorOccurred(const CriticalError)
+	 */
+	static bool UnregisterCriticalErrorOccurredEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Registers for the PDO mapping change events from the stack.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Registration successful.
+	 * \retval false  Registration not successful.
+	 *
+	 * \see OplkEventHandler::SignalPdoChanged(const int)
+	 */
+	static bool RegisterPdoChangedEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Unregisters from receiving the PDO mapping change events from the stack.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Unregistration successful.
+	 * \retval false  Unregistration not successful.
+	 *
+	 * \see OplkEventHandler::SignalPdoChanged(const int)
+	 */
+	static bool UnregisterPdoChangedEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
+	/**
+	 * \param[in] nodeId     Node id of the node.
+	 * \param[in] direction  Direction::PI_IN for the PDOs received from the
+	 *                       node, Direction::PI_OUT for the PDOs sent to it.
+	 * \return The active PDO mappings of the local node for the node.
+	 *
+	 * \note The mappings are updated asynchronously after the PDO change
+	 *       events. See OplkQtApi::RegisterPdoMappingChangedEventHandler.
+	 */
+	static std::vector<PdoMapping> GetPdoMappings(const UINT nodeId,
+									const Direction::Direction direction);
+
+	/**
+	 * \brief Estimates the location of the channels of the XAP process image
+	 *        within the PDOs.
+	 *
+	 * \param[in] processImage  The input or output process image.
+	 * \return The channels with their probable mapped objects in the PDOs.
+	 *
+	 * \see PdoMappingModel::EstimateChannelLocations(const ProcessImage&)
+	 */
+	static std::vector<PdoChannelLocation> GetPdoChannelLocations(
+									const ProcessImage& processImage);
+
+	/**
+	 * \brief Registers for the updates of the PDO mapping model.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Registration successful.
+	 * \retval false  Registration not successful.
+	 *
+	 * \see PdoMappingModel::SignalPdoMappingChanged(const int)
+	 */
+	static bool RegisterPdoMappingChangedEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Unregisters from the updates of the PDO mapping model.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Unregistration successful.
+	 * \retval false  Unregistration not successful.
+	 *
+	 * \see PdoMappingModel::SignalPdoMappingChanged(const int)
+	 */
+	static bool UnregisterPdoMappingChangedEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Registers for the retry events of the scheduled SDO transfers.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Registration successful.
+	 * \retval false  Registration not successful.
+	 *
+	 * \see SdoScheduler::SignalSdoTransferRetry(const ULONG, const SdoTransferResult, const UINT, const UINT)
+	 */
+	static bool RegisterSdoTransferRetryEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief Unregisters from receiving the retry events of the scheduled SDO transfers.
+	 *
+	 * \param[in] receiver          Object to handle the event.
+	 * \param[in] receiverFunction  Member function to handle the event.
+	 * \retval true   Unregistration successful.
+	 * \retval false  Unregistration not successful.
+	 *
+	 * \see SdoScheduler::SignalSdoTransferRetry(const ULONG, const SdoTransferResult, const UINT, const UINT)
+	 */
+	static bool UnregisterSdoTransferRetryEventHandler(const QObject& receiver,
+										const QMetaMethod& receiverFunction);
+
 private:
+	friend class ShutdownSequencer;
+	friend class ObjectDictionaryCache;
+
 	static tOplkApiInitParam initParam;
 	static bool cdcSet;
+	static UINT allocatedInSize;
+	static UINT allocatedOutSize;
 
 	OplkQtApi();
 	OplkQtApi(const OplkQtApi& api);
 	OplkQtApi& operator=(const OplkQtApi& api);
 
 	static void SetInitParam();
+
+	/**
+	 * \brief   Starts the SDO transfer with the given context as user argument.
+	 *
+	 * \param[in] sdoTransferJob   SDO transfer input parameters.
+	 * \param[in] receiverContext  Context of a remote transfer out of the
+	 *                             SdoTransferPool. NULL for a local transfer.
+	 *                             Released if the transfer could not be started.
+	 * \param[out] sdoComConHdl    Optional. The SDO connection handle.
+	 */
+	static tOplkError TransferObject(const SdoTransferJob& sdoTransferJob,
+									ReceiverContext* receiverContext,
+									tSdoComConHdl* sdoComConHdl);
+
+	/**
+	 * \retval true  If the transfer accesses the local object dictionary.
+	 * \retval false If the transfer accesses a remote node.
+	 */
+	static bool IsLocalTransfer(const SdoTransferJob& sdoTransferJob);
 };
 
 #endif //  _OPLK_QT_API_H_
@@ -41,6 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 
 #include <QtCore/QThread>
+#include <QtCore/QMutex>
 #include <oplk/errordefs.h>
 #include <oplk/event.h>
 
@@ -93,8 +94,11 @@ protected:
 private:
 
 	friend class OplkQtApi;
+	friend class ShutdownSequencer;
 
 	ULONG sleepTime; ///< Thread sleep time in micro seconds.
+	bool paused;     ///< ProcessImage exchange is paused.
+	QMutex exchangeMutex; ///< Serialises the ProcessImage exchange and pausing.
 
 	OplkSyncEventHandler();
 	OplkSyncEventHandler(const OplkSyncEventHandler& syncThread);
@@ -131,6 +135,16 @@ private:
 	 * \param[in] sleepTime Time in micro seconds.
 	 */
 	void SetSleepTime(const ULONG sleepTime);
+
+	/**
+	 * \brief Pauses or resumes the ProcessImage exchange.
+	 *
+	 * Once this function returns with paused set, no ProcessImage exchange is
+	 * in progress and none will be started until it is resumed.
+	 *
+	 * \param[in] paused  true to pause, false to resume the exchange.
+	 */
+	void SetPaused(const bool paused);
 };
 
 #endif // _OPLK_SYNC_EVENT_HANDLER_H_
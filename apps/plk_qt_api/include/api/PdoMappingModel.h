@@ -0,0 +1,172 @@
+/**
+********************************************************************************
+\file   PdoMappingModel.h
+
+\brief  Model of the PDO mapping of the local node.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _PDO_MAPPING_MODEL_H_
+#define _PDO_MAPPING_MODEL_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <map>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QMutex>
+
+#include <oplk/oplk.h>
+
+#include "user/PdoMapping.h"
+#include "user/PdoChannelLocation.h"
+#include "user/processimage/ProcessImage.h"
+
+/**
+ * \brief Keeps the PDO mapping of the local node per node and direction.
+ *
+ * The PDO change events of the stack only mark a mapping parameter object
+ * as changed. Its mapping entries are read once in the thread of the model,
+ * so the event callback never reads the object dictionary. Several changes
+ * of a mapping before the update are collapsed.
+ *
+ * \note The changes are added from the event callback of the stack.
+ *       The mapping is read in the thread of the model.
+ * \note This class is intended to _only_ be used by OplkEventHandler and OplkQtApi.
+ */
+class PdoMappingModel : public QObject
+{
+	Q_OBJECT
+
+public:
+	PdoMappingModel();
+
+	/**
+	 * \brief Records a PDO change event and schedules the update of the mapping.
+	 *
+	 * \param[in] pdoChange  Details of the PDO change event.
+	 */
+	void AddPdoChange(const tOplkApiEventPdoChange& pdoChange);
+
+	/**
+	 * \brief Discards all mappings. Changes which are not yet read are dropped.
+	 */
+	void Reset();
+
+	/**
+	 * \return All active mappings, ordered by the index of the mapping
+	 *         parameter object.
+	 */
+	std::vector<PdoMapping> GetPdoMappings() const;
+
+	/**
+	 * \param[in] nodeId     Node id of the node.
+	 * \param[in] direction  Direction of the PDOs.
+	 * \return The active mappings of the node in the direction.
+	 */
+	std::vector<PdoMapping> GetPdoMappings(const UINT nodeId,
+							const Direction::Direction direction) const;
+
+	/**
+	 * \brief Estimates the location of the channels of a process image within
+	 *        the PDOs.
+	 *
+	 * The XAP does not name the object of a channel, so the location is a
+	 * heuristic. Only objects of the process image range of the object
+	 * dictionary are considered. The channels of a node are assigned to the
+	 * mapped objects of the same bit size, the channels in the order of the
+	 * process image and the objects in the order of index and subindex.
+	 * The result is wrong if the XAP generator has allocated the variables
+	 * of one bit size in another order, e.g. for different data types of
+	 * the same size.
+	 *
+	 * \param[in] processImage  The input or output process image of the XAP.
+	 * \return The estimated locations of all channels which could be assigned.
+	 */
+	std::vector<PdoChannelLocation> EstimateChannelLocations(const ProcessImage& processImage) const;
+
+signals:
+	/**
+	 * \brief This signal is emitted when the mapping of a PDO of the node
+	 *        has been read or deleted.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	void SignalPdoMappingChanged(const int nodeId);
+
+private slots:
+	/**
+	 * \brief Reads the changed mappings and applies them to the model.
+	 */
+	void Update();
+
+private:
+	PdoMappingModel(const PdoMappingModel& model);
+	PdoMappingModel& operator=(const PdoMappingModel& model);
+
+	static const UINT kMappingsPerDirection = 256;
+	static const UINT kProcessImageFirstIndex = 0xA000;
+	static const UINT kProcessImageLastIndex = 0xAFFF;
+
+	/**
+	 * \brief The latest change of a mapping parameter object.
+	 */
+	struct PendingChange
+	{
+		bool pending;
+		bool activated;
+		UINT nodeId;
+		UINT objectCount;
+	};
+
+	/**
+	 * \param[in] slot  Slot of the mapping parameter object.
+	 * \return Index of the mapping parameter object.
+	 */
+	static UINT GetMappingIndex(const UINT slot);
+
+	/**
+	 * \brief Reads the mapping entries of a mapping parameter object.
+	 *
+	 * \param[in] mappingIndex  Index of the mapping parameter object.
+	 * \param[in] change        The change of the object.
+	 * \return The mapping. The objects up to the first failed read.
+	 */
+	static PdoMapping ReadMapping(const UINT mappingIndex, const PendingChange& change);
+
+	mutable QMutex mutex;
+	bool updateScheduled;
+	bool resetPending;
+	PendingChange pendingChanges[2 * kMappingsPerDirection];
+	std::map<UINT, PdoMapping> mappings;   ///< Mappings by mapping parameter index.
+};
+
+#endif // _PDO_MAPPING_MODEL_H_
@@ -0,0 +1,128 @@
+/**
+********************************************************************************
+\file   PhaseTimingReport.h
+
+\brief  Timing report of the openPOWERLINK stack start-up phases
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _PHASE_TIMING_REPORT_H_
+#define _PHASE_TIMING_REPORT_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <string>
+
+#include <QtCore/QElapsedTimer>
+
+#include <oplk/basictypes.h>
+
+#include "api/StartupPhase.h"
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Records the start time and the duration of every start-up phase.
+ *
+ * All times are given in microseconds relative to Start(). The phases may
+ * overlap, so the total duration is less than the sum of the phase durations
+ * if they have run concurrently.
+ *
+ * \note BeginPhase() and EndPhase() of different phases may be called from
+ * different threads. The report shall only be read after these threads
+ * have been joined.
+ */
+class PLKQTAPI_EXPORT PhaseTimingReport
+{
+public:
+	PhaseTimingReport();
+
+	/**
+	 * \brief Clears all phases and restarts the reference clock.
+	 */
+	void Start();
+
+	/**
+	 * \brief Records the start of a phase.
+	 * \param[in] phase  The start-up phase.
+	 */
+	void BeginPhase(const StartupPhase::StartupPhase phase);
+
+	/**
+	 * \brief Records the end of a phase.
+	 * \param[in] phase  The start-up phase.
+	 */
+	void EndPhase(const StartupPhase::StartupPhase phase);
+
+	/**
+	 * \param[in] phase  The start-up phase.
+	 * \retval true  If the phase has been started and ended.
+	 * \retval false Otherwise.
+	 */
+	bool IsPhaseCompleted(const StartupPhase::StartupPhase phase) const;
+
+	/**
+	 * \param[in] phase  The start-up phase.
+	 * \return The start time of the phase in us or -1 if it has not been started.
+	 */
+	qint64 GetPhaseStart(const StartupPhase::StartupPhase phase) const;
+
+	/**
+	 * \param[in] phase  The start-up phase.
+	 * \return The duration of the phase in us or -1 if it is not completed.
+	 */
+	qint64 GetPhaseDuration(const StartupPhase::StartupPhase phase) const;
+
+	/**
+	 * \return The time in us from Start() to the end of the last completed phase.
+	 */
+	qint64 GetTotalDuration() const;
+
+	/**
+	 * \return The sum of the durations of all completed phases in us.
+	 * This is the time the start-up takes if no phase overlaps.
+	 */
+	qint64 GetSequentialDuration() const;
+
+	/**
+	 * \return The report formatted as one line per completed phase.
+	 */
+	std::string ToString() const;
+
+private:
+	static const UINT kNumberOfPhases = StartupPhase::BUILD_VIEWS + 1;
+
+	QElapsedTimer timer;
+	qint64 phaseStart[kNumberOfPhases];
+	qint64 phaseEnd[kNumberOfPhases];
+
+	qint64 GetElapsedTime() const;
+};
+
+#endif // _PHASE_TIMING_REPORT_H_
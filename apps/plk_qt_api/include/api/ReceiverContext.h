@@ -38,40 +38,139 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*******************************************************************************
 * INCLUDES
 *******************************************************************************/
-class QObject;
-class QMetaMethod;
+#include <QtCore/QObject>
+#include <QtCore/QMetaMethod>
+#include <QtCore/QElapsedTimer>
+
+#include <oplk/oplk.h>
+
+#include "api/SdoTransferCallback.h"
+#include "user/SdoTransferResult.h"
+
+/**
+ * \brief Emits the result of a transfer to the receiver function.
+ *
+ * The result is delivered through a queued connection, so Qt drops it
+ * safely if the receiver is deleted in its thread while the result is
+ * emitted from the stack event thread.
+ */
+class ReceiverRelay : public QObject
+{
+	Q_OBJECT
+
+public:
+	ReceiverRelay();
+
+signals:
+	/**
+	 * \param[in] result  The result of the SDO transfer.
+	 */
+	void SignalSdoTransferFinished(const SdoTransferResult result);
+
+private:
+	ReceiverRelay(const ReceiverRelay& rhs);
+	ReceiverRelay& operator=(const ReceiverRelay& rhs);
+};
 
 /**
- * \brief A container class to pack the receiver and receiver function for
- * handling Async call back events
+ * \brief A container class to pack the completion target of a single
+ * asynchronous SDO transfer.
+ *
+ * An instance is passed as pUserArg to the stack, so the result of every
+ * transfer is dispatched to its own target without a shared signal.
+ * The target is either a receiver object with a receiver function or a
+ * SdoTransferCallback.
+ *
+ * The instances are owned and recycled by the SdoTransferPool.
  */
 class ReceiverContext
 {
 public:
 	/**
-	 * \brief   Initializer constructor
-	 *
-	 * Initializes the receiver context object with receiver and receiver function.
+	 * \brief   Constructs a context without a target.
+	 */
+	ReceiverContext();
+
+	~ReceiverContext();
+
+	/**
+	 * \brief   Sets the receiver and receiver function as target.
 	 *
 	 * \param[in] receiver          Receiver class object.
-	 * \param[in] receiverFunction  Receiver function pointer.
+	 * \param[in] receiverFunction  Receiver function. Its signature has to
+	 *                              be 'void (const SdoTransferResult)'.
+	 * \retval true  If the receiver function has been connected.
+	 * \retval false Otherwise.
+	 */
+	bool SetReceiver(const QObject* receiver,
+		const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief   Sets a callback as target.
+	 *
+	 * \param[in] callback  The callback. The context takes the ownership.
+	 */
+	void SetCallback(SdoTransferCallback* callback);
+
+	/**
+	 * \brief   Removes the target and deletes the callback, if any.
+	 */
+	void Reset();
+
+	/**
+	 * \brief   Marks the submission of the transfer to the stack.
+	 *
+	 * \param[in] sdoType  The protocol type the transfer is issued with.
+	 */
+	void Start(tSdoType sdoType);
+
+	/**
+	 * \return The protocol type passed to Start().
 	 */
-	ReceiverContext(const QObject* receiver,
-		const QMetaMethod* receiverFunction);
+	tSdoType GetSdoType() const;
 
 	/**
-	 * \return Pointer to the receiver object.
+	 * \return Microseconds elapsed since Start(). 0 if not started.
 	 */
-	const QObject* GetReceiver() const;
+	quint64 GetLatency() const;
 
 	/**
-	 * \return Pointer to the receiver function.
+	 * \return The receiver function.
 	 */
-	const QMetaMethod* GetReceiverFunction() const;
+	const QMetaMethod& GetReceiverFunction() const;
+
+	/**
+	 * \brief   Delivers the result of the transfer to the target.
+	 *
+	 * The receiver function is invoked through a queued connection in the
+	 * thread of the receiver. Qt drops the result if the receiver has been
+	 * deleted. The callback is called directly.
+	 *
+	 * \param[in] result  The result of the SDO transfer.
+	 * \retval true  If the result has been emitted to a target.
+	 * \retval false If the context has no target.
+	 */
+	bool Dispatch(const SdoTransferResult& result);
+
+	/**
+	 * \brief   Delivers the progress of a running transfer to the callback.
+	 *
+	 * Receiver functions only receive the final result.
+	 *
+	 * \param[in] progress  The state of the running SDO transfer.
+	 */
+	void DispatchProgress(const SdoTransferResult& progress) const;
 
 private:
-	const QObject* receiver;
-	const QMetaMethod* receiverFunction;
+	ReceiverRelay relay;
+	bool connected;               ///< The relay is connected to the receiver function.
+	QMetaMethod receiverFunction;
+	SdoTransferCallback* callback;
+	tSdoType sdoType;
+	QElapsedTimer timer;
+
+	ReceiverContext(const ReceiverContext& rhs);
+	ReceiverContext& operator=(const ReceiverContext& rhs);
 };
 
 #endif // _RECEIVER_CONTEXT_H_
@@ -0,0 +1,223 @@
+/**
+********************************************************************************
+\file   RecoveryPolicyEngine.h
+
+\brief  Automatic recovery from critical errors of the stack.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _RECOVERY_POLICY_ENGINE_H_
+#define _RECOVERY_POLICY_ENGINE_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QElapsedTimer>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+#include "user/CriticalError.h"
+#include "user/Recoverability.h"
+#include "user/RecoveryEvent.h"
+#include "user/RecoveryPolicy.h"
+
+/**
+ * \brief Recovers the local node from critical errors of the stack.
+ *
+ * A critical error starts the recovery with the RecoveryPolicy of its
+ * Recoverability. The actions of the policy are executed one after the
+ * other until the local node becomes operational again or all actions
+ * failed. Critical errors during a recovery do not start a new recovery;
+ * a fatal one fails the running recovery.
+ *
+ * The default policies are:
+ *  - Recoverability::TRANSIENT: reset communication, reset node and
+ *    three restarts of the stack.
+ *  - Recoverability::RECOVERABLE: three restarts of the stack.
+ *  - Recoverability::FATAL: none, the recovery fails immediately.
+ *
+ * \note The engine has to live in a thread with an event loop. All its
+ *       functions have to be called from this thread.
+ */
+class PLKQTAPI_EXPORT RecoveryPolicyEngine : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \param[in] parent  Parent object.
+	 */
+	explicit RecoveryPolicyEngine(QObject* parent = 0);
+
+	virtual ~RecoveryPolicyEngine();
+
+	/**
+	 * \brief Replaces the policy of a class of errors.
+	 *
+	 * \param[in] recoverability  The class of errors.
+	 * \param[in] policy          The new policy.
+	 */
+	void SetPolicy(const Recoverability::Recoverability recoverability,
+				const RecoveryPolicy& policy);
+
+	/**
+	 * \param[in] recoverability  The class of errors.
+	 * \return The policy of the class of errors.
+	 */
+	const RecoveryPolicy& GetPolicy(const Recoverability::Recoverability recoverability) const;
+
+	/**
+	 * \brief Starts handling the critical errors of the stack.
+	 *
+	 * \retval true   Registration successful.
+	 * \retval false  Registration not successful.
+	 */
+	bool Enable();
+
+	/**
+	 * \brief Stops handling the critical errors and aborts a running recovery
+	 *        without reporting it.
+	 */
+	void Disable();
+
+	/**
+	 * \return true if the critical errors are handled.
+	 */
+	bool IsEnabled() const;
+
+	/**
+	 * \return true if a recovery is running.
+	 */
+	bool IsRecovering() const;
+
+	/**
+	 * \return Time to recover in ms of the last successful recovery.
+	 */
+	qint64 GetLastTimeToRecover() const;
+
+	/**
+	 * \return Longest time to recover in ms of all successful recoveries.
+	 */
+	qint64 GetMaxTimeToRecover() const;
+
+	/**
+	 * \return Number of successful recoveries.
+	 */
+	ULONG GetRecoveredCount() const;
+
+	/**
+	 * \return Number of failed recoveries.
+	 */
+	ULONG GetFailedCount() const;
+
+signals:
+	/**
+	 * \brief This signal is emitted for every step of a recovery.
+	 *
+	 * \param[in] event  The recovery event.
+	 */
+	void SignalRecoveryEvent(const RecoveryEvent event);
+
+private slots:
+	/**
+	 * \brief Starts a recovery unless one is running. Fails the running
+	 *        recovery if the error is fatal.
+	 *
+	 * \param[in] error  The critical error.
+	 */
+	void HandleCriticalError(const CriticalError error);
+
+	/**
+	 * \brief Completes the recovery when the local node becomes operational
+	 *        after an action.
+	 *
+	 * \param[in] nmtState  The new NMT state of the local node.
+	 */
+	void HandleLocalNodeStateChanged(tNmtState nmtState);
+
+	/**
+	 * \brief Executes the next action of the policy.
+	 */
+	void ExecuteNextAction();
+
+	/**
+	 * \brief Continues with the next action or fails the recovery.
+	 */
+	void HandleRecoveryTimeout();
+
+private:
+	RecoveryPolicyEngine(const RecoveryPolicyEngine& engine);
+	RecoveryPolicyEngine& operator=(const RecoveryPolicyEngine& engine);
+
+	/**
+	 * \param[in] action  The action.
+	 * \return kErrorOk or the error of the stack.
+	 */
+	static tOplkError Execute(const RecoveryAction::RecoveryAction action);
+
+	/**
+	 * \param[in] type    Type of the event.
+	 * \param[in] action  The executed action.
+	 * \param[in] result  Result of the action.
+	 */
+	void TriggerRecoveryEvent(const RecoveryEventType::RecoveryEventType type,
+						const RecoveryAction::RecoveryAction action,
+						const tOplkError result);
+
+	/**
+	 * \brief Reports the failed recovery and ends it.
+	 */
+	void FailRecovery();
+
+	/**
+	 * \return Time in ms since the critical error has been received.
+	 */
+	qint64 GetElapsed() const;
+
+	RecoveryPolicy policies[Recoverability::NUMBER_OF_CLASSES];
+	QTimer attemptTimer;       ///< Backoff before the next action.
+	QTimer recoveryTimer;      ///< Time of the action to recover the local node.
+	bool enabled;
+	bool recovering;
+	bool awaitingOperational;  ///< An action has been executed.
+	bool nodeReset;            ///< The local node left operational after the action.
+	CriticalError error;
+	QElapsedTimer errorTimer;  ///< Started when the critical error is received.
+	UINT attempt;              ///< Number of actions executed.
+	RecoveryAction::RecoveryAction lastAction;
+	qint64 lastTimeToRecover;
+	qint64 maxTimeToRecover;
+	ULONG recoveredCount;
+	ULONG failedCount;
+};
+
+#endif // _RECOVERY_POLICY_ENGINE_H_
@@ -0,0 +1,218 @@
+/**
+********************************************************************************
+\file   SdoBatch.h
+
+\brief  Definitions of a batch of SDO transfers with an aggregated result
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_BATCH_H_
+#define _SDO_BATCH_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+#include "user/SdoBatchItemState.h"
+#include "user/SdoBatchRequest.h"
+#include "user/SdoTransferResult.h"
+
+/**
+ * \brief Handle to a list of SDO transfers which are run as one batch.
+ *
+ * The requests are handed to the SdoScheduler interleaved round-robin over
+ * the nodes, so the transfers to different nodes are in flight at the same
+ * time. The results of the single requests are available as soon as they
+ * have finished. SignalFinished() is emitted once all requests have
+ * finished, have been cancelled or the deadline has expired.
+ *
+ * The batch owns the data buffers of all requests. If the batch is deleted,
+ * the outstanding transfers are cancelled.
+ *
+ * \note The batch has to live in a thread with an event loop.
+ */
+class PLKQTAPI_EXPORT SdoBatch : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \param[in] requests  The objects to be transferred.
+	 * \param[in] parent    Parent object.
+	 */
+	explicit SdoBatch(const std::vector<SdoBatchRequest>& requests,
+					QObject* parent = 0);
+
+	virtual ~SdoBatch();
+
+	/**
+	 * \brief   Queues all requests.
+	 *
+	 * \param[in] deadline  Time in ms after which the outstanding requests
+	 *                      are cancelled. 0 for no deadline.
+	 * \retval true  If the batch has been started.
+	 * \retval false If it has been started before.
+	 */
+	bool Start(const int deadline = 0);
+
+	/**
+	 * \brief   Cancels all outstanding requests.
+	 */
+	void Cancel();
+
+	/**
+	 * \retval true  If no request is pending any more.
+	 * \retval false Otherwise.
+	 */
+	bool IsFinished() const;
+
+	/**
+	 * \return Number of requests in the batch.
+	 */
+	UINT GetItemCount() const;
+
+	/**
+	 * \return Number of requests which are not pending any more.
+	 */
+	UINT GetFinishedItemCount() const;
+
+	/**
+	 * \param[in] item  Position of the request in the list given to the constructor.
+	 * \return The request.
+	 * \throws std::out_of_range If item is not in the batch.
+	 */
+	const SdoBatchRequest& GetRequest(const UINT item) const;
+
+	/**
+	 * \param[in] item  Position of the request in the list given to the constructor.
+	 * \return The state of the request.
+	 * \throws std::out_of_range If item is not in the batch.
+	 */
+	SdoBatchItemState::SdoBatchItemState GetItemState(const UINT item) const;
+
+	/**
+	 * \param[in] item  Position of the request in the list given to the constructor.
+	 * \return The result of the transfer.
+	 * \throws std::out_of_range If item is not in the batch.
+	 */
+	const SdoTransferResult& GetResult(const UINT item) const;
+
+	/**
+	 * \param[in] item  Position of the request in the list given to the constructor.
+	 * \return The data read or written. For read requests only
+	 *         SdoTransferResult::GetTransferredBytes() bytes are valid.
+	 * \throws std::out_of_range If item is not in the batch.
+	 */
+	const std::vector<BYTE>& GetData(const UINT item) const;
+
+signals:
+	/**
+	 * \brief   This signal is emitted when a request is not pending any more.
+	 *
+	 * \param[in] item  Position of the request in the list given to the constructor.
+	 */
+	void SignalItemFinished(const UINT item);
+
+	/**
+	 * \brief   This signal is emitted when no request is pending any more.
+	 */
+	void SignalFinished();
+
+private slots:
+	/**
+	 * \brief   Receives the results from the SdoScheduler.
+	 *
+	 * \param[in] transferId  The id of the transfer returned by the scheduler.
+	 * \param[in] result      The result of the SDO transfer.
+	 */
+	void HandleSdoTransferFinished(const ULONG transferId,
+								const SdoTransferResult result);
+
+	/**
+	 * \brief   Cancels the outstanding requests once the deadline has expired.
+	 */
+	void HandleDeadlineExpired();
+
+private:
+	/**
+	 * \brief A request with its buffer and result.
+	 */
+	struct Item
+	{
+		SdoBatchRequest request;
+		std::vector<BYTE> data;
+		ULONG transferId;
+		SdoBatchItemState::SdoBatchItemState state;
+		SdoTransferResult result;
+	};
+
+	std::vector<Item> items;
+	std::vector<UINT> issueOrder; ///< Item positions interleaved over the nodes.
+	QTimer deadlineTimer;
+	UINT finishedItems;
+	bool started;
+
+	SdoBatch(const SdoBatch& batch);
+	SdoBatch& operator=(const SdoBatch& batch);
+
+	/**
+	 * \param[in] item  Position of the request.
+	 * \throws std::out_of_range If item is not in the batch.
+	 */
+	const Item& GetItem(const UINT item) const;
+
+	/**
+	 * \brief   Cancels all pending requests.
+	 *
+	 * \param[in] state      The new state of the pending requests.
+	 * \param[in] abortCode  The abort code reported in their result.
+	 */
+	void CancelPending(const SdoBatchItemState::SdoBatchItemState state,
+					const UINT32 abortCode);
+
+	/**
+	 * \brief   Stores the result of a request and emits the signals.
+	 *
+	 * \param[in] item    Position of the request.
+	 * \param[in] state   The new state of the request.
+	 * \param[in] result  The result of the transfer.
+	 */
+	void FinishItem(const UINT item,
+					const SdoBatchItemState::SdoBatchItemState state,
+					const SdoTransferResult& result);
+};
+
+#endif // _SDO_BATCH_H_
@@ -0,0 +1,257 @@
+/**
+********************************************************************************
+\file   SdoDomainTransfer.h
+
+\brief  Definitions of the streaming transfer of DOMAIN objects
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_DOMAIN_TRANSFER_H_
+#define _SDO_DOMAIN_TRANSFER_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QObject>
+#include <QtCore/QFile>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QElapsedTimer>
+
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+#include "user/SdoTransferResult.h"
+
+/**
+ * \brief Transfers a DOMAIN object, e.g. a firmware image, between a remote
+ * node and a file or a memory region.
+ *
+ * A file is memory mapped, so the object is passed to the stack without
+ * being loaded into the heap. The stack transfers it in segments; the
+ * progress is signalled as far as the stack reports it. The throughput is
+ * available during and after the transfer.
+ *
+ * An aborted or failed transfer can be resumed by Resume(). The SDO
+ * protocol has no offset for DOMAIN objects, so the object is transferred
+ * again from the beginning.
+ *
+ * \note The transfer has to live in a thread with an event loop.
+ */
+class PLKQTAPI_EXPORT SdoDomainTransfer : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \brief   Transfers the object from or to a file.
+	 *
+	 * \param[in] nodeId         Node id of the remote node.
+	 * \param[in] index          Index of the object.
+	 * \param[in] subIndex       Subindex of the object.
+	 * \param[in] fileName       The file to be written to the object or to
+	 *                           receive the object.
+	 * \param[in] sdoAccessType  kSdoAccessTypeWrite to download the file,
+	 *                           kSdoAccessTypeRead to upload the object.
+	 * \param[in] maxReadSize    Maximum size of an uploaded object in bytes.
+	 *                           Not used by downloads.
+	 * \param[in] sdoType        The protocol type.
+	 * \param[in] parent         Parent object.
+	 */
+	SdoDomainTransfer(const UINT nodeId,
+					const UINT index,
+					const UINT subIndex,
+					const QString& fileName,
+					tSdoAccessType sdoAccessType,
+					const UINT maxReadSize = 0,
+					tSdoType sdoType = kSdoTypeUdp,
+					QObject* parent = 0);
+
+	/**
+	 * \brief   Transfers the object from or to a memory region.
+	 *
+	 * \param[in] nodeId         Node id of the remote node.
+	 * \param[in] index          Index of the object.
+	 * \param[in] subIndex       Subindex of the object.
+	 * \param[in,out] data       The memory region. It has to stay valid
+	 *                           until the transfer has finished.
+	 * \param[in] size           Size of the memory region in bytes.
+	 * \param[in] sdoAccessType  The SDO access type.
+	 * \param[in] sdoType        The protocol type.
+	 * \param[in] parent         Parent object.
+	 */
+	SdoDomainTransfer(const UINT nodeId,
+					const UINT index,
+					const UINT subIndex,
+					uchar* data,
+					const UINT size,
+					tSdoAccessType sdoAccessType,
+					tSdoType sdoType = kSdoTypeUdp,
+					QObject* parent = 0);
+
+	/**
+	 * \brief   Aborts a running transfer.
+	 *
+	 * A mapped file stays mapped until the stack has reported the abort.
+	 * A memory region has to stay valid until then as well.
+	 */
+	virtual ~SdoDomainTransfer();
+
+	/**
+	 * \brief   Starts the transfer.
+	 *
+	 * \retval kErrorApiTaskDeferred   The remote transfer has been started.
+	 * \retval kErrorOk                The local transfer has finished.
+	 * \retval kErrorApiInvalidParam   The transfer is running already.
+	 * \retval kErrorNoResource        The file could not be mapped.
+	 * \return Otherwise the error of OplkQtApi::TransferObject.
+	 */
+	tOplkError Start();
+
+	/**
+	 * \brief   Aborts the running transfer.
+	 *
+	 * SignalFinished() is emitted once the stack has reported the abort.
+	 *
+	 * \retval true  If the abort has been requested.
+	 * \retval false If no transfer is running or the abort failed.
+	 */
+	bool Abort();
+
+	/**
+	 * \brief   Starts an aborted or failed transfer again.
+	 *
+	 * \retval kErrorApiInvalidParam  If the transfer is running or has
+	 *                                finished successfully.
+	 * \return Otherwise the return value of Start().
+	 */
+	tOplkError Resume();
+
+	/**
+	 * \retval true  If the transfer is running.
+	 * \retval false Otherwise.
+	 */
+	bool IsRunning() const;
+
+	/**
+	 * \return Number of bytes transferred so far.
+	 */
+	UINT GetTransferredBytes() const;
+
+	/**
+	 * \return Size of the object (download) or of the buffer (upload) in bytes.
+	 */
+	UINT GetSize() const;
+
+	/**
+	 * \return The throughput of the current or last transfer in bytes per second.
+	 */
+	double GetThroughput() const;
+
+	/**
+	 * \return The result of the last finished transfer.
+	 */
+	const SdoTransferResult& GetResult() const;
+
+signals:
+	/**
+	 * \brief   Emitted when the stack reports the progress of the transfer.
+	 *
+	 * \param[in] transferredBytes  Number of bytes transferred so far.
+	 * \param[in] size              Size of the object or of the buffer in bytes.
+	 */
+	void SignalProgress(const UINT transferredBytes, const UINT size);
+
+	/**
+	 * \brief   Emitted when the transfer has finished or has been aborted.
+	 *
+	 * \param[in] result  The result of the transfer.
+	 */
+	void SignalFinished(const SdoTransferResult result);
+
+private slots:
+	/**
+	 * \param[in] attempt   The attempt the progress belongs to.
+	 * \param[in] progress  The state of the running transfer.
+	 */
+	void HandleSdoTransferProgress(const ULONG attempt,
+								const SdoTransferResult progress);
+
+	/**
+	 * \param[in] attempt  The attempt the result belongs to.
+	 * \param[in] result   The result of the transfer.
+	 */
+	void HandleSdoTransferFinished(const ULONG attempt,
+								const SdoTransferResult result);
+
+private:
+	const UINT nodeId;
+	const UINT index;
+	const UINT subIndex;
+	const tSdoAccessType sdoAccessType;
+	const tSdoType sdoType;
+	QSharedPointer<QFile> file;   ///< Shared with the callback of the running attempt.
+	const bool useFile;           ///< The data is mapped from the file.
+	uchar* data;
+	UINT size;
+	const UINT maxReadSize;
+	tSdoComConHdl sdoComConHdl;
+	ULONG attempt;                ///< Ignores the reports of aborted attempts.
+	bool running;
+	UINT transferredBytes;
+	SdoTransferResult result;
+	QElapsedTimer timer;
+	qint64 duration;
+
+	SdoDomainTransfer(const SdoDomainTransfer& transfer);
+	SdoDomainTransfer& operator=(const SdoDomainTransfer& transfer);
+
+	/**
+	 * \brief   Maps the file into the memory.
+	 *
+	 * \retval true  If the file has been mapped.
+	 * \retval false Otherwise.
+	 */
+	bool MapFile();
+
+	/**
+	 * \brief   Unmaps the file and truncates an uploaded file to the
+	 *          size of the object.
+	 */
+	void UnmapFile();
+
+	/**
+	 * \brief   Stores the result and emits SignalFinished().
+	 *
+	 * \param[in] result  The result of the transfer.
+	 */
+	void Finish(const SdoTransferResult& result);
+};
+
+#endif // _SDO_DOMAIN_TRANSFER_H_
@@ -0,0 +1,354 @@
+/**
+********************************************************************************
+\file   SdoScheduler.h
+
+\brief  Definitions of the asynchronous SDO transfer scheduler
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_SCHEDULER_H_
+#define _SDO_SCHEDULER_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <deque>
+#include <list>
+#include <map>
+
+#include <QtCore/QObject>
+#include <QtCore/QMetaMethod>
+#include <QtCore/QMutex>
+#include <QtCore/QPointer>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+#include "user/SdoTransferJob.h"
+#include "user/SdoTransferResult.h"
+#include "user/SdoSchedulerStatistics.h"
+#include "user/SdoRetryPolicy.h"
+
+class ReceiverContext;
+
+/**
+ * \brief Queues SDO transfers and keeps several of them in flight.
+ *
+ * Any number of SdoTransferJob can be queued. The scheduler issues up to
+ * GetMaxTransfersPerNode() transfers per node and GetMaxTransfers() transfers
+ * overall to the stack, within the SDO connection limits of the stack
+ * (SDO_MAX_CONNECTION_ASND and SDO_MAX_CONNECTION_UDP). Waiting transfers of
+ * other nodes are issued ahead of a blocked node, so the transfers to
+ * different nodes are pipelined.
+ *
+ * The result of every transfer is delivered to its receiver function through
+ * a queued invocation as soon as it has finished, so the results may arrive
+ * in a different order than the transfers have been queued.
+ *
+ * Transfers which fail with a transient error are repeated according to
+ * their SdoRetryPolicy before the result is delivered. The policy is taken
+ * from the job, the node or the default policy, in this order, when the
+ * transfer is queued. SignalSdoTransferRetry() is emitted for every retry.
+ *
+ * \note The data buffer of the SdoTransferJob has to stay valid until the
+ * result has been received.
+ */
+class PLKQTAPI_EXPORT SdoScheduler : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \return Returns the instance of the class.
+	 */
+	static SdoScheduler& GetInstance();
+
+	/**
+	 * \brief   Queues a SDO transfer.
+	 *
+	 * \param[in] sdoTransferJob    SDO transfer input parameters.
+	 * \param[in] receiver          Receiver object. No result is delivered once it is deleted.
+	 * \param[in] receiverFunction  Receiver function where the result is
+	 *                              received. Its signature has to be
+	 *                              'void (const SdoTransferResult)' or
+	 *                              'void (const ULONG, const SdoTransferResult)'
+	 *                              to receive the id of the transfer as well.
+	 * \return The id of the queued transfer. 0 if the receiver function is invalid.
+	 */
+	ULONG Enqueue(const SdoTransferJob& sdoTransferJob,
+				const QObject& receiver,
+				const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief   Queues a SDO transfer with its own retry policy.
+	 *
+	 * \param[in] sdoTransferJob    SDO transfer input parameters.
+	 * \param[in] receiver          Receiver object. No result is delivered once it is deleted.
+	 * \param[in] receiverFunction  Receiver function where the result is
+	 *                              received. Its signature has to be
+	 *                              'void (const SdoTransferResult)' or
+	 *                              'void (const ULONG, const SdoTransferResult)'
+	 *                              to receive the id of the transfer as well.
+	 * \param[in] retryPolicy       The retry policy of the transfer.
+	 * \return The id of the queued transfer. 0 if the receiver function is invalid.
+	 */
+	ULONG Enqueue(const SdoTransferJob& sdoTransferJob,
+				const QObject& receiver,
+				const QMetaMethod& receiverFunction,
+				const SdoRetryPolicy& retryPolicy);
+
+	/**
+	 * \brief   Cancels a transfer.
+	 *
+	 * A queued transfer is removed from the queue. A transfer in flight is
+	 * aborted in the stack. No result is delivered for a cancelled transfer.
+	 *
+	 * \param[in] transferId  The id returned by Enqueue().
+	 * \retval true  If the transfer has been cancelled.
+	 * \retval false If the transfer has already finished.
+	 */
+	bool Cancel(const ULONG transferId);
+
+	/**
+	 * \brief   Aborts all transfers.
+	 *
+	 * Transfers in flight are aborted in the stack. The receivers of all
+	 * queued and in flight transfers receive an aborted result. Like
+	 * cancelled transfers, the aborted transfers occupy their SDO
+	 * connection until the stack reports the abort.
+	 */
+	void Clear();
+
+	/**
+	 * \brief   Releases the SDO connections of the transfers in flight.
+	 *
+	 * Only to be called after the stack has been shut down, as the stack
+	 * does not report the aborts any more.
+	 */
+	void ReleaseInFlight();
+
+	/**
+	 * \param[in] maxTransfers  Maximum number of transfers in flight per node (at least 1).
+	 */
+	void SetMaxTransfersPerNode(const UINT maxTransfers);
+
+	/**
+	 * \return Maximum number of transfers in flight per node. Defaults to 1.
+	 */
+	UINT GetMaxTransfersPerNode() const;
+
+	/**
+	 * \param[in] maxTransfers  Maximum number of transfers in flight overall (at least 1).
+	 */
+	void SetMaxTransfers(const UINT maxTransfers);
+
+	/**
+	 * \return Maximum number of transfers in flight overall.
+	 *         Defaults to the SDO connection limit of the stack.
+	 */
+	UINT GetMaxTransfers() const;
+
+	/**
+	 * \param[in] retryPolicy  The retry policy of the transfers to nodes
+	 *                         without a policy of their own.
+	 */
+	void SetRetryPolicy(const SdoRetryPolicy& retryPolicy);
+
+	/**
+	 * \return The default retry policy. Defaults to no retries.
+	 */
+	SdoRetryPolicy GetRetryPolicy() const;
+
+	/**
+	 * \param[in] nodeId       Node id of the node.
+	 * \param[in] retryPolicy  The retry policy of the transfers to the node.
+	 */
+	void SetNodeRetryPolicy(const UINT nodeId, const SdoRetryPolicy& retryPolicy);
+
+	/**
+	 * \brief   Applies the default retry policy to the node again.
+	 *
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	void ResetNodeRetryPolicy(const UINT nodeId);
+
+	/**
+	 * \return A snapshot of the current statistics.
+	 */
+	SdoSchedulerStatistics GetStatistics() const;
+
+signals:
+	/**
+	 * \brief   This signal is emitted when a failed attempt is repeated.
+	 *
+	 * \param[in] transferId  The id of the transfer.
+	 * \param[in] result      The result of the failed attempt.
+	 * \param[in] retry       Number of the retry, starting with 1.
+	 * \param[in] backoff     Time in ms until the retry is issued.
+	 */
+	void SignalSdoTransferRetry(const ULONG transferId,
+								const SdoTransferResult result,
+								const UINT retry,
+								const UINT backoff);
+
+private slots:
+	/**
+	 * \brief   Receives the results of the remote SDO transfers.
+	 *
+	 * \param[in] transferId  The id of the finished transfer.
+	 * \param[in] result      The result of the SDO transfer.
+	 */
+	void HandleSdoTransferFinished(const ULONG transferId,
+								const SdoTransferResult result);
+
+	/**
+	 * \brief   Aborts the attempts which exceeded their attempt timeout and
+	 *          issues the retries whose back-off has elapsed.
+	 */
+	void HandleTimeout();
+
+	/**
+	 * \brief   Rearms the timer after a transfer with an attempt timeout
+	 *          has been issued from another thread.
+	 */
+	void UpdateTimer();
+
+private:
+	/**
+	 * \brief A queued or issued SDO transfer.
+	 */
+	struct ScheduledTransfer
+	{
+		ULONG id;
+		SdoTransferJob job;
+		QPointer<QObject> receiver;    ///< Null once the receiver has been deleted.
+		QMetaMethod receiverFunction;
+		tSdoComConHdl sdoComConHdl;
+		ReceiverContext* receiverContext;    ///< Context of the attempt in flight.
+		bool cancelled;    ///< The result is not delivered to the receiver.
+		SdoRetryPolicy retryPolicy;
+		UINT retries;      ///< Number of retries issued so far.
+		qint64 notBefore;  ///< Earliest issue time of a retry.
+		qint64 issuedAt;   ///< Issue time of the current attempt.
+		bool timedOut;     ///< The current attempt has been aborted due to the attempt timeout.
+	};
+
+	mutable QMutex mutex;
+	std::deque<ScheduledTransfer> queue;
+	std::list<ScheduledTransfer> inFlight;
+	std::map<UINT, UINT> inFlightPerNode;
+	UINT inFlightAsnd;
+	UINT inFlightUdp;
+	UINT maxTransfersPerNode;
+	UINT maxTransfers;
+	ULONG lastTransferId;
+	UINT peakQueueDepth;
+	ULONG completed;
+	ULONG failed;
+	ULONG retried;
+	SdoRetryPolicy retryPolicy;
+	std::map<UINT, SdoRetryPolicy> nodeRetryPolicies;
+	QElapsedTimer clock;   ///< Time base of the back-off and the attempt timeout.
+	QTimer timer;          ///< Expires at the next back-off or attempt timeout.
+	QElapsedTimer busyTimer;
+	qint64 busyTime;
+
+	SdoScheduler();
+	SdoScheduler(const SdoScheduler& scheduler);
+	SdoScheduler& operator=(const SdoScheduler& scheduler);
+
+	/**
+	 * \brief   Issues the waiting transfers as far as the limits permit.
+	 * \note The mutex has to be locked by the caller.
+	 */
+	void IssueTransfers();
+
+	/**
+	 * \param[in] transfer  The waiting transfer.
+	 * \retval true  If the transfer can be issued within the limits.
+	 * \retval false Otherwise.
+	 */
+	bool CanIssue(const ScheduledTransfer& transfer) const;
+
+	/**
+	 * \brief   Counts a transfer in or out of the in flight limits.
+	 *
+	 * \param[in] transfer  The transfer.
+	 * \param[in] issued    True if the transfer is issued, false if it has finished.
+	 */
+	void UpdateInFlight(const ScheduledTransfer& transfer, const bool issued);
+
+	/**
+	 * \brief   Delivers the result to the receiver of the transfer and
+	 *          updates the statistics.
+	 *
+	 * \param[in] transfer  The finished transfer.
+	 * \param[in] result    The result of the transfer.
+	 */
+	void Finish(const ScheduledTransfer& transfer,
+				const SdoTransferResult& result);
+
+	/**
+	 * \brief   Delivers the result to the receiver of the transfer.
+	 *
+	 * \param[in] transfer  The transfer.
+	 * \param[in] result    The result of the transfer.
+	 */
+	void Deliver(const ScheduledTransfer& transfer,
+				const SdoTransferResult& result);
+
+	/**
+	 * \brief   Queues the transfer again if the error is transient and
+	 *          retries are left.
+	 *
+	 * \param[in,out] transfer  The failed transfer.
+	 * \param[in] result        The result of the failed attempt.
+	 * \param[out] backoff      Time in ms until the retry is issued.
+	 * \retval true  If the transfer has been queued again.
+	 * \retval false If the result has to be delivered.
+	 */
+	bool ScheduleRetry(ScheduledTransfer& transfer,
+					const SdoTransferResult& result,
+					UINT& backoff);
+
+	/**
+	 * \brief   Starts the timer for the next back-off or attempt timeout.
+	 * \note The mutex has to be locked by the caller, in the thread of the scheduler.
+	 */
+	void ArmTimer();
+
+	/**
+	 * \brief   Accounts the busy time once no transfer is left.
+	 */
+	void UpdateBusyTime();
+};
+
+#endif // _SDO_SCHEDULER_H_
@@ -0,0 +1,117 @@
+/**
+********************************************************************************
+\file   SdoStatistics.h
+
+\brief  Refer brief of SdoStatistics.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_STATISTICS_H_
+#define _SDO_STATISTICS_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <map>
+#include <vector>
+
+#include <QtCore/QMutex>
+
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+#include "user/NodeSdoStatistics.h"
+#include "user/SdoTransferResult.h"
+
+/**
+ * \brief Latency and abort statistics of the remote SDO transfers per node.
+ *
+ * Every transfer reported by the stack is recorded with the time from its
+ * submission to its result. Local OD accesses are not recorded.
+ */
+class PLKQTAPI_EXPORT SdoStatistics
+{
+public:
+	/**
+	 * \return Returns the instance of the class.
+	 */
+	static SdoStatistics& GetInstance();
+
+	/**
+	 * \brief   Records a finished transfer.
+	 *
+	 * \param[in] result   The result of the transfer.
+	 * \param[in] sdoType  The protocol type the transfer has been issued with.
+	 * \param[in] latency  Time from the submission to the result in microseconds.
+	 */
+	void Record(const SdoTransferResult& result,
+			tSdoType sdoType,
+			const quint64 latency);
+
+	/**
+	 * \param[in] nodeId  Node id of the node.
+	 * \return The statistics of the node. Empty if no transfer to the node
+	 *         has finished.
+	 */
+	NodeSdoStatistics GetNodeStatistics(const UINT nodeId) const;
+
+	/**
+	 * \return The statistics of all nodes with finished transfers, in the
+	 *         order of their node ids.
+	 */
+	std::vector<NodeSdoStatistics> GetNodeStatistics() const;
+
+	/**
+	 * \param[in] count  Maximum number of nodes to be returned.
+	 * \return The nodes with the highest average latency, slowest first.
+	 */
+	std::vector<NodeSdoStatistics> GetSlowestNodes(const UINT count) const;
+
+	/**
+	 * \param[in] count  Maximum number of nodes to be returned.
+	 * \return The nodes with the most aborted transfers, most first. Nodes
+	 *         without aborts are not returned.
+	 */
+	std::vector<NodeSdoStatistics> GetMostAbortingNodes(const UINT count) const;
+
+	/**
+	 * \brief   Discards the statistics of all nodes.
+	 */
+	void Reset();
+
+private:
+	mutable QMutex mutex;
+	std::map<UINT, NodeSdoStatistics> nodes;
+
+	SdoStatistics();
+	SdoStatistics(const SdoStatistics& statistics);
+	SdoStatistics& operator=(const SdoStatistics& statistics);
+};
+
+#endif // _SDO_STATISTICS_H_
@@ -0,0 +1,78 @@
+/**
+********************************************************************************
+\file   SdoTransferCallback.h
+
+\brief  Interface to receive the result of a single SDO transfer
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_TRANSFER_CALLBACK_H_
+#define _SDO_TRANSFER_CALLBACK_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QtGlobal>
+
+#include "common/QtApiGlobal.h"
+#include "user/SdoTransferResult.h"
+
+/**
+ * \brief Receives the result of exactly one SDO transfer.
+ *
+ * An instance is handed over to OplkQtApi::TransferObject() and is deleted
+ * by the library after OnSdoTransferFinished() has been called.
+ *
+ * \note The functions are called in the thread of the stack event
+ * callback. They shall only store or forward the result and return quickly.
+ */
+class PLKQTAPI_EXPORT SdoTransferCallback
+{
+public:
+	virtual ~SdoTransferCallback() {}
+
+	/**
+	 * \brief   Called while a segmented transfer is running, as far as the
+	 *          stack reports the progress.
+	 *
+	 * \param[in] progress  The state of the running SDO transfer. The
+	 *                      transferred bytes are counted so far.
+	 */
+	virtual void OnSdoTransferProgress(const SdoTransferResult& progress)
+	{
+		Q_UNUSED(progress);
+	}
+
+	/**
+	 * \param[in] result  The result of the SDO transfer.
+	 */
+	virtual void OnSdoTransferFinished(const SdoTransferResult& result) = 0;
+};
+
+#endif // _SDO_TRANSFER_CALLBACK_H_
@@ -0,0 +1,128 @@
+/**
+********************************************************************************
+\file   SdoTransferPool.h
+
+\brief  Definitions of the pool of SDO transfer contexts
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_TRANSFER_POOL_H_
+#define _SDO_TRANSFER_POOL_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include <QtCore/QMutex>
+
+#include <oplk/oplk.h>
+#include <oplkcfg.h>
+
+#include "common/QtApiGlobal.h"
+#include "api/ReceiverContext.h"
+
+#if !defined(SDO_MAX_CONNECTION_ASND) || !defined(SDO_MAX_CONNECTION_UDP)
+#error "The SDO connection limits are taken from the oplkcfg.h of the stack library"
+#endif
+
+/**
+ * \brief Fixed capacity pool of the contexts of the remote SDO transfers.
+ *
+ * Every remote SDO transfer occupies one ReceiverContext of the pool, which
+ * holds its completion target, from the start until the stack has reported
+ * the result. The contexts are allocated once and recycled afterwards, so
+ * no memory is allocated per transfer.
+ *
+ * The capacity equals the number of SDO connections of the stack, so a
+ * transfer that finds the pool exhausted would have been refused by the
+ * stack as well.
+ */
+class PLKQTAPI_EXPORT SdoTransferPool
+{
+public:
+	/**
+	 * \brief Number of contexts in the pool.
+	 */
+	static const UINT kCapacity = SDO_MAX_CONNECTION_ASND + SDO_MAX_CONNECTION_UDP;
+
+	/**
+	 * \return Returns the instance of the class.
+	 */
+	static SdoTransferPool& GetInstance();
+
+	/**
+	 * \brief   Takes a free context out of the pool.
+	 *
+	 * \return A context without target. NULL if the pool is exhausted.
+	 */
+	ReceiverContext* Acquire();
+
+	/**
+	 * \brief   Resets the context and returns it to the pool.
+	 *
+	 * \param[in] context  A context returned by Acquire(). NULL is ignored.
+	 */
+	void Release(ReceiverContext* context);
+
+	/**
+	 * \brief   Returns all contexts to the pool.
+	 *
+	 * \note Only to be called once the stack cannot report results any more.
+	 */
+	void ReleaseAll();
+
+	/**
+	 * \return Number of contexts in use.
+	 */
+	UINT GetInUse() const;
+
+	/**
+	 * \return Highest number of contexts in use at the same time.
+	 */
+	UINT GetHighWaterMark() const;
+
+	/**
+	 * \return Number of Acquire() calls which found the pool exhausted.
+	 */
+	ULONG GetExhaustedCount() const;
+
+private:
+	mutable QMutex mutex;
+	ReceiverContext contexts[kCapacity];
+	std::vector<UINT> freeContexts;    ///< Indices of the free contexts.
+	UINT highWaterMark;
+	ULONG exhaustedCount;
+
+	SdoTransferPool();
+	SdoTransferPool(const SdoTransferPool& pool);
+	SdoTransferPool& operator=(const SdoTransferPool& pool);
+};
+
+#endif // _SDO_TRANSFER_POOL_H_
@@ -0,0 +1,67 @@
+/**
+********************************************************************************
+\file   ShutdownPhase.h
+
+\brief  Phases of the openPOWERLINK stack shutdown
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SHUTDOWN_PHASE_H_
+#define _SHUTDOWN_PHASE_H_
+
+#include <string>
+
+#include "common/QtApiGlobal.h"
+
+namespace ShutdownPhase
+{
+	/**
+	 * \brief The phases run by the ShutdownSequencer.
+	 */
+	enum ShutdownPhase
+	{
+		UNDEFINED = 0,
+		ABORT_TRANSFERS,    ///< Abort the scheduled SDO transfers.
+		SWITCH_OFF,         ///< Switch the local node off and wait for NMT_GS_OFF.
+		STOP_SYNC_THREAD,   ///< Stop the ProcessImage exchange and its thread.
+		FREE_PI,            ///< Free the ProcessImage.
+		SHUTDOWN_STACK,     ///< oplk_shutdown()
+		JOIN_THREADS,       ///< Join the threads of the event and sync handlers.
+		RELEASE_TRANSFERS   ///< Release the contexts of the pending SDO transfers.
+	};
+
+	/**
+	 * \param[in] phase  The shutdown phase.
+	 * \return Returns the name of the phase.
+	 */
+	PLKQTAPI_EXPORT std::string GetShutdownPhaseString(ShutdownPhase phase);
+
+} // namespace ShutdownPhase
+
+#endif // _SHUTDOWN_PHASE_H_
@@ -0,0 +1,171 @@
+/**
+********************************************************************************
+\file   ShutdownSequencer.h
+
+\brief  Shuts the openPOWERLINK stack down in phases with deadlines
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SHUTDOWN_SEQUENCER_H_
+#define _SHUTDOWN_SEQUENCER_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <string>
+
+#include <QtCore/QElapsedTimer>
+
+#include <oplk/oplk.h>
+
+#include "api/ShutdownPhase.h"
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Stops the openPOWERLINK stack in explicit phases, each of which
+ * waits at most for its deadline.
+ *
+ * The phases are run in the order of ShutdownPhase. A failed or timed out
+ * phase does not stop the sequence, so that all resources are released and
+ * the stack can be started again:
+ * - The local node is switched off. The sequencer waits for NMT_GS_OFF
+ *   until the deadline of ShutdownPhase::SWITCH_OFF.
+ * - The ProcessImage exchange is paused and the sync thread is asked to
+ *   stop. It is joined until the deadline of ShutdownPhase::STOP_SYNC_THREAD.
+ *   A sync thread blocked in the stack is released by the shutdown of the
+ *   stack and joined in ShutdownPhase::JOIN_THREADS.
+ * - The ProcessImage is freed and the stack is shut down.
+ * - The threads are joined until the deadline of ShutdownPhase::JOIN_THREADS.
+ *
+ * The deadlines only apply to the phases which wait for another thread.
+ */
+class PLKQTAPI_EXPORT ShutdownSequencer
+{
+public:
+	/**
+	 * \brief Default deadline in ms of ShutdownPhase::SWITCH_OFF.
+	 */
+	static const ULONG kDefaultSwitchOffDeadline = 500;
+
+	/**
+	 * \brief Default deadline in ms of ShutdownPhase::STOP_SYNC_THREAD.
+	 */
+	static const ULONG kDefaultStopSyncDeadline = 100;
+
+	/**
+	 * \brief Default deadline in ms of ShutdownPhase::JOIN_THREADS.
+	 */
+	static const ULONG kDefaultJoinDeadline = 500;
+
+	ShutdownSequencer();
+
+	/**
+	 * \brief Sets the deadline of a phase.
+	 *
+	 * \param[in] phase     The shutdown phase.
+	 * \param[in] deadline  Maximum time in ms the phase waits.
+	 */
+	void SetDeadline(const ShutdownPhase::ShutdownPhase phase, const ULONG deadline);
+
+	/**
+	 * \param[in] phase  The shutdown phase.
+	 * \return The maximum time in ms the phase waits.
+	 */
+	ULONG GetDeadline(const ShutdownPhase::ShutdownPhase phase) const;
+
+	/**
+	 * \brief Runs all the shutdown phases.
+	 *
+	 * \return kErrorOk on success. kErrorGeneralError if a phase has timed
+	 *         out. Otherwise the error of the first failed phase.
+	 */
+	tOplkError Run();
+
+	/**
+	 * \return The first phase which has failed or timed out in the last
+	 *         Run() or ShutdownPhase::UNDEFINED if all phases succeeded.
+	 */
+	ShutdownPhase::ShutdownPhase GetFailedPhase() const;
+
+	/**
+	 * \param[in] phase  The shutdown phase.
+	 * \retval true  If the phase has reached its deadline in the last Run().
+	 * \retval false Otherwise.
+	 */
+	bool IsTimedOut(const ShutdownPhase::ShutdownPhase phase) const;
+
+	/**
+	 * \param[in] phase  The shutdown phase.
+	 * \return The duration of the phase in us or -1 if it has not been run.
+	 */
+	qint64 GetPhaseDuration(const ShutdownPhase::ShutdownPhase phase) const;
+
+	/**
+	 * \return The duration of the last Run() in us.
+	 */
+	qint64 GetTotalDuration() const;
+
+	/**
+	 * \return The report formatted as one line per phase.
+	 */
+	std::string ToString() const;
+
+private:
+	static const UINT kNumberOfPhases = ShutdownPhase::RELEASE_TRANSFERS + 1;
+
+	/**
+	 * \brief Records the start of a phase.
+	 * \param[in] phase  The shutdown phase.
+	 */
+	void BeginPhase(const ShutdownPhase::ShutdownPhase phase);
+
+	/**
+	 * \brief Records the end of a phase and its result.
+	 *
+	 * \param[in] phase     The shutdown phase.
+	 * \param[in] oplkRet   The result of the phase.
+	 * \param[in] timedOut  Whether the phase has reached its deadline.
+	 */
+	void EndPhase(const ShutdownPhase::ShutdownPhase phase,
+				const tOplkError oplkRet,
+				const bool timedOut);
+
+	QElapsedTimer timer;
+	ULONG deadline[kNumberOfPhases];
+	qint64 phaseStart[kNumberOfPhases];
+	qint64 phaseEnd[kNumberOfPhases];
+	bool timedOut[kNumberOfPhases];
+	ShutdownPhase::ShutdownPhase failedPhase;
+	tOplkError result;
+
+	ShutdownSequencer(const ShutdownSequencer& rhs);
+	ShutdownSequencer& operator=(const ShutdownSequencer& rhs);
+};
+
+#endif // _SHUTDOWN_SEQUENCER_H_
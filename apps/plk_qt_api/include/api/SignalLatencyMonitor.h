@@ -0,0 +1,151 @@
+/**
+********************************************************************************
+\file   SignalLatencyMonitor.h
+
+\brief  Measures the time from the emission of the signals of the stack
+		until their dispatch in the receiving thread.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SIGNAL_LATENCY_MONITOR_H_
+#define _SIGNAL_LATENCY_MONITOR_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QMutex>
+#include <QtCore/QTimer>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QAtomicInt>
+
+#include "common/QtApiGlobal.h"
+#include "user/MonitoredSignal.h"
+#include "user/SignalLatencyStatistics.h"
+
+/**
+ * \brief Measures the delivery latency of the signals of OplkEventHandler
+ * and OplkSyncEventHandler.
+ *
+ * Right after a monitored signal has been emitted, the monitor posts a probe
+ * with the time of the emission to its own thread. The probe is queued behind
+ * the deliveries of the signal to the receivers in the same thread, so it is
+ * dispatched once the receivers have been called and the time until then is
+ * the delivery latency of the signal. The number of probes waiting in the queue is sampled periodically.
+ *
+ * The probe measures the event queue of the thread of the monitor only, not
+ * the thread of each receiver. Receivers in other threads, or connected
+ * directly, are not covered by the latency.
+ *
+ * The monitor lives in the thread which creates it by enabling it, which
+ * should be the thread of the receivers, e.g. the GUI thread.
+ *
+ * \note Disabled by default. A disabled monitor costs one atomic load per signal.
+ */
+class PLKQTAPI_EXPORT SignalLatencyMonitor : public QObject
+{
+	Q_OBJECT
+
+public:
+	/**
+	 * \return Returns the instance of the class.
+	 */
+	static SignalLatencyMonitor& GetInstance();
+
+	/**
+	 * \brief Marks the emission of a signal. Called by the emitter right
+	 *        after the emit, so the probe is queued behind the deliveries.
+	 *
+	 * \param[in] signal  The emitted signal.
+	 */
+	static void Enqueue(const MonitoredSignal::MonitoredSignal signal);
+
+	/**
+	 * \brief Starts the measurement.
+	 */
+	void Enable();
+
+	/**
+	 * \brief Stops the measurement. The statistics are kept.
+	 */
+	void Disable();
+
+	/**
+	 * \retval true  If the latencies are measured.
+	 * \retval false Otherwise.
+	 */
+	static bool IsEnabled();
+
+	/**
+	 * \param[in] signal  The signal.
+	 * \return The latency statistics of the signal.
+	 */
+	SignalLatencyStatistics GetStatistics(const MonitoredSignal::MonitoredSignal signal) const;
+
+	/**
+	 * \return The latency statistics of all signals.
+	 */
+	std::vector<SignalLatencyStatistics> GetStatistics() const;
+
+	/**
+	 * \brief Discards the statistics of all signals.
+	 */
+	void Reset();
+
+private slots:
+	/**
+	 * \brief Records the dispatch of a probe.
+	 *
+	 * \param[in] signal    The MonitoredSignal of the probe.
+	 * \param[in] enqueued  Time of the emission in ns on the clock of the monitor.
+	 */
+	void HandleDispatched(const int signal, const qint64 enqueued);
+
+	/**
+	 * \brief Samples the number of probes waiting in the event queue.
+	 */
+	void SampleQueueDepth();
+
+private:
+	SignalLatencyMonitor();
+	SignalLatencyMonitor(const SignalLatencyMonitor& monitor);
+	SignalLatencyMonitor& operator=(const SignalLatencyMonitor& monitor);
+
+	static QAtomicInt enabled;
+
+	mutable QMutex mutex;
+	QElapsedTimer clock;
+	QTimer sampleTimer;
+	QAtomicInt pending[MonitoredSignal::NUMBER_OF_SIGNALS];
+	std::vector<SignalLatencyStatistics> statistics;
+};
+
+#endif // _SIGNAL_LATENCY_MONITOR_H_
@@ -0,0 +1,149 @@
+/**
+********************************************************************************
+\file   StartupOrchestrator.h
+
+\brief  Definitions of the openPOWERLINK stack start-up orchestrator
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _STARTUP_ORCHESTRATOR_H_
+#define _STARTUP_ORCHESTRATOR_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <string>
+
+#include <QtCore/QMetaMethod>
+
+#include <oplk/oplk.h>
+
+#include "api/PhaseTimingReport.h"
+#include "api/StartupPhase.h"
+#include "common/QtApiGlobal.h"
+#include "user/processimage/ProcessImageParser.h"
+
+class QObject;
+
+/**
+ * \brief Starts the openPOWERLINK stack and overlaps the start-up phases
+ * which do not depend on each other.
+ *
+ * The phases are run in the following order:
+ * - The xap.xml is read and parsed in a worker thread, while
+ *   OplkQtApi::InitStack() and OplkQtApi::SetCdc() run in the calling thread.
+ * - The ProcessImage is allocated once both have finished.
+ * - The stack is started.
+ * - The views are built by the view builder while the stack boots up the
+ *   network in its own threads.
+ *
+ * The duration of every phase is recorded in a PhaseTimingReport.
+ */
+class PLKQTAPI_EXPORT StartupOrchestrator
+{
+public:
+	/**
+	 * \param[in] parserType  Type of the ProcessImageParser used for the xap.xml.
+	 */
+	explicit StartupOrchestrator(const ProcessImageParserType::ProcessImageParserType parserType);
+
+	~StartupOrchestrator();
+
+	/**
+	 * \brief   Sets the function which builds the views of the ProcessImage.
+	 *
+	 * The receiver function is invoked directly in the thread which calls
+	 * Run(), once the stack has been started. Its signature has to be
+	 * 'void (ProcessImageIn*, ProcessImageOut*)'.
+	 *
+	 * \param[in] receiver          Receiver object.
+	 * \param[in] receiverFunction  Receiver function building the views.
+	 * \retval true  If the receiver function is valid.
+	 * \retval false Otherwise.
+	 */
+	bool SetViewBuilder(QObject& receiver,
+						const QMetaMethod& receiverFunction);
+
+	/**
+	 * \brief   Runs all the start-up phases.
+	 *
+	 * If a phase fails, the remaining phases are skipped and a stack which
+	 * has been initialised but not started is shut down again.
+	 *
+	 * \param[in] nodeId            Node id of the local node.
+	 * \param[in] networkInterface  Network interface.
+	 * \param[in] xapFileName       File name of the xap.xml.
+	 * \param[in] cdcFileName       File name of the CDC.
+	 * \return kErrorOk on success. kErrorGeneralError if the xap.xml could not
+	 *         be parsed. Otherwise the error of the failed phase.
+	 * \throws std::invalid_argument if the requested ProcessImage parser is not available.
+	 */
+	tOplkError Run(const UINT nodeId,
+				const std::string& networkInterface,
+				const std::string& xapFileName,
+				const std::string& cdcFileName);
+
+	/**
+	 * \return The phase which has failed in the last Run() or
+	 *         StartupPhase::UNDEFINED if all phases succeeded.
+	 */
+	StartupPhase::StartupPhase GetFailedPhase() const;
+
+	/**
+	 * \return The error message of the xap.xml parser, if the parse phase has failed.
+	 */
+	const std::string& GetParseErrorMessage() const;
+
+	/**
+	 * \return The timing report of the last Run().
+	 */
+	const PhaseTimingReport& GetTimingReport() const;
+
+	/**
+	 * \brief   Hands over the parser holding the ProcessImage to the caller.
+	 *
+	 * \return The parser of the last Run() or NULL. The caller
+	 *         has to delete it.
+	 */
+	ProcessImageParser* ReleaseParser();
+
+private:
+	const ProcessImageParserType::ProcessImageParserType parserType;
+	ProcessImageParser* parser;
+	QObject* viewBuilderReceiver;
+	QMetaMethod viewBuilderFunction;
+	StartupPhase::StartupPhase failedPhase;
+	std::string parseErrorMessage;
+	PhaseTimingReport timingReport;
+
+	StartupOrchestrator(const StartupOrchestrator& rhs);
+	StartupOrchestrator& operator=(const StartupOrchestrator& rhs);
+};
+
+#endif // _STARTUP_ORCHESTRATOR_H_
@@ -0,0 +1,66 @@
+/**
+********************************************************************************
+\file   StartupPhase.h
+
+\brief  Phases of the openPOWERLINK stack start-up
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _STARTUP_PHASE_H_
+#define _STARTUP_PHASE_H_
+
+#include <string>
+
+#include "common/QtApiGlobal.h"
+
+namespace StartupPhase
+{
+	/**
+	 * \brief The phases run by the StartupOrchestrator.
+	 */
+	enum StartupPhase
+	{
+		UNDEFINED = 0,
+		PARSE_XAP,      ///< Read and parse the xap.xml.
+		INIT_STACK,     ///< OplkQtApi::InitStack()
+		SET_CDC,        ///< OplkQtApi::SetCdc()
+		ALLOCATE_PI,    ///< OplkQtApi::AllocateProcessImage()
+		START_STACK,    ///< OplkQtApi::StartStack()
+		BUILD_VIEWS     ///< Construction of the user interface views.
+	};
+
+	/**
+	 * \param[in] phase  The start-up phase.
+	 * \return Returns the name of the phase.
+	 */
+	PLKQTAPI_EXPORT std::string GetStartupPhaseString(StartupPhase phase);
+
+} // namespace StartupPhase
+
+#endif // _STARTUP_PHASE_H_
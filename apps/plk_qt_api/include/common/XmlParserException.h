@@ -72,6 +72,16 @@ public:
 	 */
 	XmlParserError::XmlParserError GetErrorCode() const;
 
+	/**
+	 * \return The line number where the error occurred.
+	 */
+	UINT GetLineNumber() const;
+
+	/**
+	 * \return The column number where the error occurred.
+	 */
+	UINT GetColumnNumber() const;
+
 private:
 	std::string message;
 	const XmlParserError::XmlParserError errCode;
@@ -0,0 +1,146 @@
+/**
+********************************************************************************
+\file   CriticalError.h
+
+\brief  Typed critical error of the stack.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _CRITICAL_ERROR_H_
+#define _CRITICAL_ERROR_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QtGlobal>
+#include <QtCore/QString>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+#include "user/Recoverability.h"
+
+/**
+ * \brief A critical error event of the stack with its decoded arguments
+ * and its recoverability.
+ *
+ * Errors of the event processing carry the source of the failed event.
+ * Errors of the data link layer carry the DLL state and the NMT event
+ * which has been processed.
+ *
+ * \see OplkQtApi::RegisterCriticalErrorOccurredEventHandler
+ */
+class PLKQTAPI_EXPORT CriticalError
+{
+public:
+	CriticalError();
+
+	/**
+	 * \brief Decodes and classifies the error. The time is set to now.
+	 *
+	 * \param[in] error    The error event of the stack.
+	 * \param[in] message  Formatted description of the error.
+	 */
+	CriticalError(const tEventError& error, const QString& message);
+
+	/**
+	 * \return The source of the error event.
+	 */
+	tEventSource GetSource() const;
+
+	/**
+	 * \return The error reported by the stack.
+	 */
+	tOplkError GetOplkError() const;
+
+	/**
+	 * \return The source of the event whose processing failed. Only valid
+	 *         for the sources kEventSourceEventk and kEventSourceEventu.
+	 */
+	tEventSource GetOriginalSource() const;
+
+	/**
+	 * \return The state of the data link layer. Only valid for the source
+	 *         kEventSourceDllk.
+	 */
+	UINT GetDllState() const;
+
+	/**
+	 * \return The NMT event processed by the data link layer. Only valid
+	 *         for the source kEventSourceDllk.
+	 */
+	UINT GetNmtEvent() const;
+
+	/**
+	 * \return Milliseconds since epoch of the error.
+	 */
+	qint64 GetTimestamp() const;
+
+	/**
+	 * \return How the error can be recovered.
+	 */
+	Recoverability::Recoverability GetRecoverability() const;
+
+	/**
+	 * \retval true  If the error can be recovered without the user.
+	 * \retval false Otherwise.
+	 */
+	bool IsRecoverable() const;
+
+	/**
+	 * \return Formatted description of the error.
+	 */
+	const QString& GetMessage() const;
+
+	/**
+	 * \brief Classifies an error by its source and error code.
+	 *
+	 * - Failures of resources of the stack are fatal.
+	 * - Errors of the data link layer are transient.
+	 * - All other errors require a restart of the stack.
+	 *
+	 * \param[in] source     The source of the error event.
+	 * \param[in] oplkError  The error reported by the stack.
+	 * \return How the error can be recovered.
+	 */
+	static Recoverability::Recoverability Classify(const tEventSource source,
+											const tOplkError oplkError);
+
+private:
+	tEventSource source;
+	tOplkError oplkError;
+	tEventSource originalSource;
+	UINT dllState;
+	UINT nmtEvent;
+	qint64 timestamp;
+	Recoverability::Recoverability recoverability;
+	QString message;
+};
+
+#endif // _CRITICAL_ERROR_H_
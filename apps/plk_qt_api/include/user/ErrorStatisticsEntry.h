@@ -0,0 +1,121 @@
+/**
+********************************************************************************
+\file   ErrorStatisticsEntry.h
+
+\brief  Aggregated occurrences of an error code of a node.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _ERROR_STATISTICS_ENTRY_H_
+#define _ERROR_STATISTICS_ENTRY_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QtGlobal>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Snapshot of the occurrences of an error code of a node as
+ * aggregated by the error statistics.
+ *
+ * \see OplkQtApi::GetErrorStatistics
+ */
+class PLKQTAPI_EXPORT ErrorStatisticsEntry
+{
+public:
+	ErrorStatisticsEntry();
+
+	/**
+	 * \param[in] nodeId           Node id of the node. 0 for the error history of the local node.
+	 * \param[in] errorCode        The error code.
+	 * \param[in] count            Number of occurrences.
+	 * \param[in] firstOccurrence  Milliseconds since epoch of the first occurrence.
+	 * \param[in] lastOccurrence   Milliseconds since epoch of the last occurrence.
+	 * \param[in] rate             Occurrences per second within the sliding window.
+	 * \param[in] suppressedCount  Number of occurrences which have not been logged.
+	 */
+	ErrorStatisticsEntry(const UINT nodeId,
+					const UINT16 errorCode,
+					const ULONG count,
+					const qint64 firstOccurrence,
+					const qint64 lastOccurrence,
+					const double rate,
+					const ULONG suppressedCount);
+
+	/**
+	 * \return Node id of the node. 0 for the error history of the local node.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return The error code.
+	 */
+	UINT16 GetErrorCode() const;
+
+	/**
+	 * \return Number of occurrences.
+	 */
+	ULONG GetCount() const;
+
+	/**
+	 * \return Milliseconds since epoch of the first occurrence.
+	 */
+	qint64 GetFirstOccurrence() const;
+
+	/**
+	 * \return Milliseconds since epoch of the last occurrence.
+	 */
+	qint64 GetLastOccurrence() const;
+
+	/**
+	 * \return Occurrences per second within the sliding window.
+	 */
+	double GetRate() const;
+
+	/**
+	 * \return Number of occurrences which have not been logged because of
+	 *         the rate limit of the logger.
+	 */
+	ULONG GetSuppressedCount() const;
+
+private:
+	UINT nodeId;
+	UINT16 errorCode;
+	ULONG count;
+	qint64 firstOccurrence;
+	qint64 lastOccurrence;
+	double rate;
+	ULONG suppressedCount;
+};
+
+#endif // _ERROR_STATISTICS_ENTRY_H_
@@ -0,0 +1,60 @@
+/**
+********************************************************************************
+\file   LogCategory.h
+
+\brief  Describes the source of a LogRecord.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _LOG_CATEGORY_H_
+#define _LOG_CATEGORY_H_
+
+namespace LogCategory
+{
+	/**
+	 * \brief The source of a logged event. The minimum severity of the
+	 * logged events can be set per category.
+	 *
+	 * \see OplkQtApi::SetLogLevel
+	 */
+	enum LogCategory
+	{
+		NMT = 0,                 ///< NMT state changes of the local node.
+		NODE,                    ///< Events of the remote nodes.
+		SDO,                     ///< Finished and aborted SDO transfers.
+		CFM,                     ///< Progress and result of the configuration manager.
+		PDO,                     ///< Changes of the PDO mapping.
+		HISTORY,                 ///< Entries of the error history.
+		WARNING,                 ///< Warnings and critical errors of the stack.
+		NUMBER_OF_CATEGORIES     ///< Number of categories. Not a category.
+	};
+
+} // namespace LogCategory
+
+#endif // _LOG_CATEGORY_H_
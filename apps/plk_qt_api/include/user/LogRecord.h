@@ -0,0 +1,149 @@
+/**
+********************************************************************************
+\file   LogRecord.h
+
+\brief  LogRecord describes a single event of the stack in binary form.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _LOG_RECORD_H_
+#define _LOG_RECORD_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QString>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+#include "user/LogRecordType.h"
+#include "user/LogCategory.h"
+#include "user/LogSeverity.h"
+
+/**
+ * \brief A fixed-size record of an event of the stack.
+ *
+ * The record only stores the time of the event, its type and its raw
+ * arguments. It is created in the event callback of the stack without
+ * allocating memory and formatted to text only when it is displayed.
+ *
+ * The category and the severity of a record are defined by its type.
+ *
+ * \see LogRecordType for the arguments of each type.
+ */
+class PLKQTAPI_EXPORT LogRecord
+{
+public:
+	/**
+	 * \brief Maximum number of arguments of a record.
+	 */
+	static const UINT kMaxArgs = 10;
+
+	/**
+	 * \param[in] type  Type of the event.
+	 * \return The category of the events of the type.
+	 */
+	static LogCategory::LogCategory GetCategory(const LogRecordType::LogRecordType type);
+
+	/**
+	 * \param[in] type  Type of the event.
+	 * \return The severity of the events of the type.
+	 */
+	static LogSeverity::LogSeverity GetSeverity(const LogRecordType::LogRecordType type);
+
+	/**
+	 * \brief Empty record of the type LogRecordType::UNDEFINED.
+	 */
+	LogRecord();
+
+	/**
+	 * \brief Record without arguments. The timestamp is set to the current time.
+	 *
+	 * \param[in] type  Type of the event.
+	 */
+	explicit LogRecord(const LogRecordType::LogRecordType type);
+
+	/**
+	 * \brief Appends an argument. Arguments beyond kMaxArgs are ignored.
+	 *
+	 * \param[in] arg  Raw value of the argument.
+	 */
+	void AddArg(const UINT32 arg);
+
+	/**
+	 * \return Milliseconds since epoch at which the event occurred.
+	 */
+	qint64 GetTimestamp() const;
+
+	/**
+	 * \return Type of the event.
+	 */
+	LogRecordType::LogRecordType GetType() const;
+
+	/**
+	 * \return Category of the event.
+	 */
+	LogCategory::LogCategory GetCategory() const;
+
+	/**
+	 * \return Severity of the event.
+	 */
+	LogSeverity::LogSeverity GetSeverity() const;
+
+	/**
+	 * \return Number of arguments of the record.
+	 */
+	UINT GetArgCount() const;
+
+	/**
+	 * \param[in] index  Index of the argument.
+	 * \return The raw value of the argument or 0 if it does not exist.
+	 */
+	UINT32 GetArg(const UINT index) const;
+
+	/**
+	 * \return The description of the event without timestamp.
+	 */
+	QString GetMessage() const;
+
+	/**
+	 * \return The timestamp and the description of the event as
+	 * delivered by OplkQtApi::RegisterEventLogger.
+	 */
+	QString ToString() const;
+
+private:
+	qint64 timestamp;
+	LogRecordType::LogRecordType type;
+	UINT argCount;
+	UINT32 args[kMaxArgs];
+};
+
+#endif // _LOG_RECORD_H_
@@ -0,0 +1,70 @@
+/**
+********************************************************************************
+\file   LogRecordType.h
+
+\brief  Describes the type of a LogRecord.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _LOG_RECORD_TYPE_H_
+#define _LOG_RECORD_TYPE_H_
+
+namespace LogRecordType
+{
+	/**
+	 * \brief The event described by a LogRecord. The type defines the
+	 * meaning of the arguments of the record.
+	 */
+	enum LogRecordType
+	{
+		UNDEFINED = 0,               ///< No event.
+		NMT_SHUTDOWN,                ///< newNmtState, nmtEvent
+		NMT_STATE_CHANGE,            ///< newNmtState, nmtEvent
+		CRITICAL_ERROR,              ///< eventSource, oplkError
+		CRITICAL_ERROR_ORG_SOURCE,   ///< errorArg.eventSource
+		CRITICAL_ERROR_VALUE,        ///< errorArg.uintArg
+		WARNING,                     ///< eventSource, oplkError
+		HISTORY_ENTRY,               ///< entryType, errorCode, aAddInfo[0..7]
+		NODE_CHECK_CONF,             ///< nodeId
+		NODE_UPDATE_CONF,            ///< nodeId
+		NODE_STATE,                  ///< nodeId, nmtState
+		NODE_ERROR,                  ///< nodeId, errorCode
+		CFM_PROGRESS,                ///< nodeId, objectIndex, objectSubIndex, bytesDownloaded, totalNumberOfBytes
+		CFM_PROGRESS_ERROR,          ///< sdoAbortCode, error
+		CFM_RESULT,                  ///< nodeId, nodeCommand
+		PDO_CHANGE,                  ///< fTx, mappParamIndex, nodeId, mappObjectCount, fActivated
+		SDO_TRANSFER_FINISHED,       ///< nodeId, targetIndex, targetSubIndex, transferredBytes
+		SDO_TRANSFER_ABORTED,        ///< nodeId, targetIndex, targetSubIndex, abortCode, sdoComConState
+		ERRORS_SUPPRESSED,           ///< nodeId, errorCode, suppressedCount
+		RECORDS_DROPPED              ///< Number of records lost due to a full ring.
+	};
+
+} // namespace LogRecordType
+
+#endif // _LOG_RECORD_TYPE_H_
@@ -0,0 +1,55 @@
+/**
+********************************************************************************
+\file   LogSeverity.h
+
+\brief  Describes the severity of a LogRecord.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _LOG_SEVERITY_H_
+#define _LOG_SEVERITY_H_
+
+namespace LogSeverity
+{
+	/**
+	 * \brief The severity of a logged event in ascending order.
+	 */
+	enum LogSeverity
+	{
+		VERBOSE = 0,    ///< Detailed progress, e.g. of the CFM download.
+		INFO,           ///< Regular events, e.g. NMT state changes.
+		WARNING,        ///< Events which may require attention.
+		FAILURE,        ///< Failed operations and errors reported by nodes.
+		CRITICAL,       ///< Critical errors of the stack.
+		DISABLED        ///< Only used as a minimum level to disable a category.
+	};
+
+} // namespace LogSeverity
+
+#endif // _LOG_SEVERITY_H_
@@ -0,0 +1,62 @@
+/**
+********************************************************************************
+\file   MonitoredSignal.h
+
+\brief  Describes the signals observed by the SignalLatencyMonitor.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _MONITORED_SIGNAL_H_
+#define _MONITORED_SIGNAL_H_
+
+namespace MonitoredSignal
+{
+	/**
+	 * \brief The signals of the stack whose delivery latency is measured.
+	 */
+	enum MonitoredSignal
+	{
+		LOCAL_NODE_STATE_CHANGED = 0, ///< OplkEventHandler::SignalLocalNodeStateChanged
+		NODE_FOUND,                   ///< OplkEventHandler::SignalNodeFound
+		NODE_STATE_CHANGED,           ///< OplkEventHandler::SignalNodeStateChanged
+		NODE_EVENTS,                  ///< NodeEventBatcher::SignalNodeEvents
+		PRINT_LOG,                    ///< OplkEventHandler::SignalPrintLog
+		LOG_RECORD,                   ///< OplkEventHandler::SignalLogRecord
+		SDO_TRANSFER_FINISHED,        ///< OplkEventHandler::SignalSdoTransferFinished and the receivers of transfers
+		CRITICAL_ERROR,               ///< OplkEventHandler::SignalCriticalError
+		PDO_CHANGED,                  ///< OplkEventHandler::SignalPdoChanged
+		UPDATED_OUTPUT_VALUES,        ///< OplkSyncEventHandler::SignalUpdatedOutputValues
+		UPDATE_INPUT_VALUES,          ///< OplkSyncEventHandler::SignalUpdateInputValues
+		SYNC_WAIT_TIME_CHANGED,       ///< OplkSyncEventHandler::SignalSyncWaitTimeChanged
+		NUMBER_OF_SIGNALS             ///< Number of signals. Not a signal.
+	};
+
+} // namespace MonitoredSignal
+
+#endif // _MONITORED_SIGNAL_H_
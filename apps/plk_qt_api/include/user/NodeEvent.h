@@ -0,0 +1,114 @@
+/**
+********************************************************************************
+\file   NodeEvent.h
+
+\brief  NodeEvent describes the change of a remote node within a batch
+		of node events.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NODE_EVENT_H_
+#define _NODE_EVENT_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QtGlobal>
+
+#include "oplk/oplk.h"
+#include "oplk/nmt.h"
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief The net change of a remote node within one batch of node events.
+ *
+ * Intermediate NMT states of the node within the batch are not reported.
+ *
+ * \see OplkQtApi::EnableNodeEventBatching
+ */
+class PLKQTAPI_EXPORT NodeEvent
+{
+public:
+	NodeEvent();
+
+	/**
+	 * \param[in] nodeId     Node id of the node.
+	 * \param[in] oldState   NMT state of the node before the batch.
+	 * \param[in] newState   NMT state of the node after the batch.
+	 * \param[in] timestamp  Milliseconds since epoch of the last event of the node.
+	 * \param[in] found      Whether the node was found within the batch.
+	 */
+	NodeEvent(const UINT nodeId,
+		const tNmtState oldState,
+		const tNmtState newState,
+		const qint64 timestamp,
+		const bool found);
+
+	/**
+	 * \return Node id of the node.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return NMT state of the node before the batch.
+	 */
+	tNmtState GetOldState() const;
+
+	/**
+	 * \return NMT state of the node after the batch.
+	 */
+	tNmtState GetNewState() const;
+
+	/**
+	 * \return Milliseconds since epoch of the last event of the node.
+	 */
+	qint64 GetTimestamp() const;
+
+	/**
+	 * \retval true  If the node was found within the batch.
+	 * \retval false Otherwise.
+	 */
+	bool IsFound() const;
+
+	/**
+	 * \retval true  If the NMT state of the node has changed within the batch.
+	 * \retval false Otherwise.
+	 */
+	bool IsStateChanged() const;
+
+private:
+	UINT nodeId;
+	tNmtState oldState;
+	tNmtState newState;
+	qint64 timestamp;
+	bool found;
+};
+
+#endif // _NODE_EVENT_H_
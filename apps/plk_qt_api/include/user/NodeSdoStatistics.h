@@ -0,0 +1,154 @@
+/**
+********************************************************************************
+\file   NodeSdoStatistics.h
+
+\brief  Definitions of the SDO statistics of a node
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NODE_SDO_STATISTICS_H_
+#define _NODE_SDO_STATISTICS_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <map>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+#include "user/SdoTransferResult.h"
+
+/**
+ * \brief This class accumulates the finished SDO transfers to one node.
+ *
+ * The latencies from the submission to the result of the transfers are
+ * counted in a histogram with logarithmic buckets: bucket i counts the
+ * latencies from 2^i to 2^(i+1) - 1 microseconds.
+ *
+ * \see SdoStatistics
+ */
+class PLKQTAPI_EXPORT NodeSdoStatistics
+{
+public:
+	/**
+	 * \brief Number of buckets of the latency histogram.
+	 */
+	static const UINT kLatencyBuckets = 32;
+
+	NodeSdoStatistics();
+
+	/**
+	 * \param[in] nodeId  Node id of the node.
+	 */
+	explicit NodeSdoStatistics(const UINT nodeId);
+
+	/**
+	 * \brief   Accumulates a finished transfer.
+	 *
+	 * \param[in] result   The result of the transfer.
+	 * \param[in] sdoType  The protocol type the transfer has been issued with.
+	 * \param[in] latency  Time from the submission to the result in microseconds.
+	 */
+	void Add(const SdoTransferResult& result,
+			tSdoType sdoType,
+			const quint64 latency);
+
+	/**
+	 * \return Node id of the node.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return Number of finished transfers.
+	 */
+	ULONG GetTransferCount() const;
+
+	/**
+	 * \return Number of transfers issued via UDP.
+	 */
+	ULONG GetUdpTransferCount() const;
+
+	/**
+	 * \return Number of transfers issued via ASnd or with automatic
+	 *         protocol selection.
+	 */
+	ULONG GetAsndTransferCount() const;
+
+	/**
+	 * \return Number of aborted transfers.
+	 */
+	ULONG GetAbortCount() const;
+
+	/**
+	 * \return Number of aborts per abort code.
+	 */
+	const std::map<UINT32, ULONG>& GetAbortCodes() const;
+
+	/**
+	 * \return Number of bytes transferred.
+	 */
+	quint64 GetTransferredBytes() const;
+
+	/**
+	 * \return Average latency in microseconds.
+	 */
+	quint64 GetAverageLatency() const;
+
+	/**
+	 * \return Maximum latency in microseconds.
+	 */
+	quint64 GetMaxLatency() const;
+
+	/**
+	 * \param[in] percent  The percentile, from 0 to 100.
+	 * \return Upper bound of the histogram bucket of the percentile in
+	 *         microseconds. 0 if no transfer has finished.
+	 */
+	quint64 GetLatencyPercentile(const UINT percent) const;
+
+	/**
+	 * \param[in] bucket  Index of the bucket, less than kLatencyBuckets.
+	 * \return Number of latencies in the bucket.
+	 */
+	ULONG GetLatencyHistogram(const UINT bucket) const;
+
+private:
+	UINT nodeId;
+	ULONG transferCount;
+	ULONG udpTransferCount;
+	ULONG abortCount;
+	std::map<UINT32, ULONG> abortCodes;
+	quint64 transferredBytes;
+	quint64 totalLatency;
+	quint64 maxLatency;
+	ULONG latencyHistogram[kLatencyBuckets];
+};
+
+#endif // _NODE_SDO_STATISTICS_H_
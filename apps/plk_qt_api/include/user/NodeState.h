@@ -0,0 +1,121 @@
+/**
+********************************************************************************
+\file   NodeState.h
+
+\brief  NodeState describes the last known state of a remote node.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NODE_STATE_H_
+#define _NODE_STATE_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QtGlobal>
+
+#include "oplk/oplk.h"
+#include "oplk/nmt.h"
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Snapshot of the state of a remote node as tracked by the node state table.
+ *
+ * \see OplkQtApi::GetNodeState
+ */
+class PLKQTAPI_EXPORT NodeState
+{
+public:
+	NodeState();
+
+	/**
+	 * \param[in] nodeId         Node id of the node.
+	 * \param[in] nmtState       Last reported NMT state of the node.
+	 * \param[in] lastChange     Milliseconds since epoch of the last change.
+	 * \param[in] found          Whether the node has been found.
+	 * \param[in] errorCount     Number of error events of the node.
+	 * \param[in] lossCount      Number of times the node became not active.
+	 * \param[in] lastErrorCode  Last emergency error code of the node.
+	 */
+	NodeState(const UINT nodeId,
+		const tNmtState nmtState,
+		const qint64 lastChange,
+		const bool found,
+		const UINT errorCount,
+		const UINT lossCount,
+		const UINT16 lastErrorCode);
+
+	/**
+	 * \return Node id of the node.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return Last reported NMT state of the node.
+	 */
+	tNmtState GetNmtState() const;
+
+	/**
+	 * \return Milliseconds since epoch of the last change. 0 if never changed.
+	 */
+	qint64 GetLastChange() const;
+
+	/**
+	 * \retval true  If the node has been found.
+	 * \retval false Otherwise.
+	 */
+	bool IsFound() const;
+
+	/**
+	 * \return Number of error events of the node.
+	 */
+	UINT GetErrorCount() const;
+
+	/**
+	 * \return Number of times the node became not active after it was found.
+	 */
+	UINT GetLossCount() const;
+
+	/**
+	 * \return Last emergency error code of the node. 0 if none.
+	 */
+	UINT16 GetLastErrorCode() const;
+
+private:
+	UINT nodeId;
+	tNmtState nmtState;
+	qint64 lastChange;
+	bool found;
+	UINT errorCount;
+	UINT lossCount;
+	UINT16 lastErrorCode;
+};
+
+#endif // _NODE_STATE_H_
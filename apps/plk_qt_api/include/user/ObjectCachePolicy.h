@@ -0,0 +1,56 @@
+/**
+********************************************************************************
+\file   ObjectCachePolicy.h
+
+\brief  Invalidation policies of the ObjectDictionaryCache
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _OBJECT_CACHE_POLICY_H_
+#define _OBJECT_CACHE_POLICY_H_
+
+namespace ObjectCachePolicy
+{
+	/**
+	 * \brief Defines when a cached object dictionary value becomes invalid.
+	 *
+	 * \see ObjectDictionaryCache::SetPolicy
+	 */
+	enum ObjectCachePolicy
+	{
+		UNDEFINED = 0,        ///< Not cached. Every read is forwarded.
+		STATIC,               ///< Read once per boot of the node.
+		TIME_TO_LIVE,         ///< Valid for a fixed time after the read.
+		NMT_STATE_CHANGE,     ///< Valid until the NMT state of the node changes.
+		PDO_CHANGE            ///< Valid until the PDO mapping of the node changes.
+	};
+
+} // namespace ObjectCachePolicy
+
+#endif // _OBJECT_CACHE_POLICY_H_
@@ -0,0 +1,91 @@
+/**
+********************************************************************************
+\file   PdoChannelLocation.h
+
+\brief  Position of a process image channel within a PDO.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _PDO_CHANNEL_LOCATION_H_
+#define _PDO_CHANNEL_LOCATION_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "common/QtApiGlobal.h"
+#include "user/cdc/PdoMappingObject.h"
+#include "user/processimage/Channel.h"
+
+/**
+ * \brief Assigns a channel of the XAP process image to the object which
+ * carries it in a PDO of the local node.
+ */
+class PLKQTAPI_EXPORT PdoChannelLocation
+{
+public:
+	/**
+	 * \param[in] channel       The channel of the process image.
+	 * \param[in] nodeId        Node id of the node which exchanges the PDO.
+	 * \param[in] mappingIndex  Index of the mapping parameter object.
+	 * \param[in] object        The mapped object which carries the channel.
+	 */
+	PdoChannelLocation(const Channel& channel,
+					const UINT nodeId,
+					const UINT mappingIndex,
+					const PdoMappingObject& object);
+
+	/**
+	 * \return The channel of the process image.
+	 */
+	const Channel& GetChannel() const;
+
+	/**
+	 * \return Node id of the node which exchanges the PDO.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return Index of the mapping parameter object.
+	 */
+	UINT GetMappingIndex() const;
+
+	/**
+	 * \return The mapped object which carries the channel. Its bit offset
+	 *         is the position of the channel within the PDO.
+	 */
+	const PdoMappingObject& GetObject() const;
+
+private:
+	Channel channel;
+	UINT nodeId;
+	UINT mappingIndex;
+	PdoMappingObject object;
+};
+
+#endif // _PDO_CHANNEL_LOCATION_H_
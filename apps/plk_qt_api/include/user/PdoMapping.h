@@ -0,0 +1,124 @@
+/**
+********************************************************************************
+\file   PdoMapping.h
+
+\brief  Mapped objects of a PDO of the local node.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _PDO_MAPPING_H_
+#define _PDO_MAPPING_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+#include "user/cdc/PdoMappingObject.h"
+#include "user/processimage/Direction.h"
+
+/**
+ * \brief The objects mapped by one PDO mapping parameter (0x16xx / 0x1Axx)
+ * of the local node.
+ *
+ * A receive PDO (0x16xx) carries inputs from the node (Direction::PI_IN),
+ * a transmit PDO (0x1Axx) carries outputs to the node (Direction::PI_OUT).
+ */
+class PLKQTAPI_EXPORT PdoMapping
+{
+public:
+	PdoMapping();
+
+	/**
+	 * \param[in] nodeId        Node id of the node which exchanges the PDO.
+	 * \param[in] direction     Direction of the PDO.
+	 * \param[in] mappingIndex  Index of the mapping parameter object.
+	 */
+	PdoMapping(const UINT nodeId,
+			const Direction::Direction direction,
+			const UINT mappingIndex);
+
+	/**
+	 * \brief Appends a mapped object.
+	 *
+	 * \param[in] object  The mapped object.
+	 */
+	void AddObject(const PdoMappingObject& object);
+
+	/**
+	 * \brief Marks the mapping as incomplete.
+	 *
+	 * \param[in] error  Error of the failed read of a mapping entry.
+	 */
+	void SetReadError(const tOplkError error);
+
+	/**
+	 * \return Node id of the node which exchanges the PDO.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return Direction of the PDO.
+	 */
+	Direction::Direction GetDirection() const;
+
+	/**
+	 * \return Index of the mapping parameter object.
+	 */
+	UINT GetMappingIndex() const;
+
+	/**
+	 * \return The mapped objects in the order of the mapping entries.
+	 */
+	const std::vector<PdoMappingObject>& GetObjects() const;
+
+	/**
+	 * \return Length of the mapped data in bits, i.e. the end of the last
+	 *         mapped object within the PDO.
+	 */
+	UINT GetBitSize() const;
+
+	/**
+	 * \return kErrorOk or the error of the failed read of a mapping entry.
+	 *         The objects of the following entries are missing.
+	 */
+	tOplkError GetReadError() const;
+
+private:
+	UINT nodeId;
+	Direction::Direction direction;
+	UINT mappingIndex;
+	std::vector<PdoMappingObject> objects;
+	tOplkError readError;
+};
+
+#endif // _PDO_MAPPING_H_
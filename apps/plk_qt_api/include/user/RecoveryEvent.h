@@ -0,0 +1,114 @@
+/**
+********************************************************************************
+\file   RecoveryEvent.h
+
+\brief  Progress of the recovery from a critical error.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _RECOVERY_EVENT_H_
+#define _RECOVERY_EVENT_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QtGlobal>
+
+#include "common/QtApiGlobal.h"
+#include "user/CriticalError.h"
+#include "user/RecoveryAction.h"
+#include "user/RecoveryEventType.h"
+
+/**
+ * \brief An event of the recovery from a critical error as reported by the
+ * RecoveryPolicyEngine.
+ */
+class PLKQTAPI_EXPORT RecoveryEvent
+{
+public:
+	RecoveryEvent();
+
+	/**
+	 * \param[in] type           Type of the event.
+	 * \param[in] error          The critical error which started the recovery.
+	 * \param[in] action         The executed action. Only valid for
+	 *                           RecoveryEventType::ACTION_EXECUTED and
+	 *                           RecoveryEventType::RECOVERED.
+	 * \param[in] attempt        Number of actions executed so far.
+	 * \param[in] actionResult   Result of the executed action.
+	 * \param[in] timeToRecover  Time in ms since the error.
+	 */
+	RecoveryEvent(const RecoveryEventType::RecoveryEventType type,
+				const CriticalError& error,
+				const RecoveryAction::RecoveryAction action,
+				const UINT attempt,
+				const tOplkError actionResult,
+				const qint64 timeToRecover);
+
+	/**
+	 * \return Type of the event.
+	 */
+	RecoveryEventType::RecoveryEventType GetType() const;
+
+	/**
+	 * \return The critical error which started the recovery.
+	 */
+	const CriticalError& GetError() const;
+
+	/**
+	 * \return The executed action.
+	 */
+	RecoveryAction::RecoveryAction GetAction() const;
+
+	/**
+	 * \return Number of actions executed so far.
+	 */
+	UINT GetAttempt() const;
+
+	/**
+	 * \return Result of the executed action.
+	 */
+	tOplkError GetActionResult() const;
+
+	/**
+	 * \return Time in ms since the error. For RecoveryEventType::RECOVERED
+	 *         this is the time to recover.
+	 */
+	qint64 GetTimeToRecover() const;
+
+private:
+	RecoveryEventType::RecoveryEventType type;
+	CriticalError error;
+	RecoveryAction::RecoveryAction action;
+	UINT attempt;
+	tOplkError actionResult;
+	qint64 timeToRecover;
+};
+
+#endif // _RECOVERY_EVENT_H_
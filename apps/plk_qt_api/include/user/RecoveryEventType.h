@@ -0,0 +1,54 @@
+/**
+********************************************************************************
+\file   RecoveryEventType.h
+
+\brief  Types of the events reported by the RecoveryPolicyEngine.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _RECOVERY_EVENT_TYPE_H_
+#define _RECOVERY_EVENT_TYPE_H_
+
+namespace RecoveryEventType
+{
+	/**
+	 * \brief Progress of the recovery from a critical error.
+	 */
+	enum RecoveryEventType
+	{
+		UNDEFINED = 0,
+		RECOVERY_STARTED,   ///< A critical error starts the recovery.
+		ACTION_EXECUTED,    ///< An action of the policy has been executed.
+		RECOVERED,          ///< The local node is operational again.
+		RECOVERY_FAILED     ///< All actions of the policy failed.
+	};
+
+} // namespace RecoveryEventType
+
+#endif // _RECOVERY_EVENT_TYPE_H_
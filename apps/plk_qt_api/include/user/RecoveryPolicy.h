@@ -0,0 +1,107 @@
+/**
+********************************************************************************
+\file   RecoveryPolicy.h
+
+\brief  Escalating actions to recover from a critical error.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _RECOVERY_POLICY_H_
+#define _RECOVERY_POLICY_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+#include "user/RecoveryAction.h"
+
+/**
+ * \brief The actions which are tried one after the other to recover from
+ * a critical error.
+ *
+ * An action has succeeded if the local node becomes operational within the
+ * recovery timeout. Otherwise the next action is executed after a backoff
+ * which doubles with every attempt, starting at the initial backoff and
+ * limited to the maximum backoff. An empty policy does not recover.
+ */
+class PLKQTAPI_EXPORT RecoveryPolicy
+{
+public:
+	/**
+	 * \brief Creates an empty policy with a recovery timeout of 10 s and a
+	 * backoff from 500 ms up to 8 s.
+	 */
+	RecoveryPolicy();
+
+	/**
+	 * \brief Appends an action.
+	 *
+	 * \param[in] action  The action.
+	 */
+	void AddAction(const RecoveryAction::RecoveryAction action);
+
+	/**
+	 * \param[in] recoveryTimeout  Time in ms an action has to recover the local node.
+	 */
+	void SetRecoveryTimeout(const ULONG recoveryTimeout);
+
+	/**
+	 * \param[in] initialBackoff  Delay in ms before the second action.
+	 * \param[in] maxBackoff      Maximum delay in ms before an action.
+	 */
+	void SetBackoff(const ULONG initialBackoff, const ULONG maxBackoff);
+
+	/**
+	 * \return The actions in the order of execution.
+	 */
+	const std::vector<RecoveryAction::RecoveryAction>& GetActions() const;
+
+	/**
+	 * \return Time in ms an action has to recover the local node.
+	 */
+	ULONG GetRecoveryTimeout() const;
+
+	/**
+	 * \param[in] attempt  Number of the attempt. 0 for the first one.
+	 * \return Delay in ms before the attempt.
+	 */
+	ULONG GetBackoff(const UINT attempt) const;
+
+private:
+	std::vector<RecoveryAction::RecoveryAction> actions;
+	ULONG recoveryTimeout;
+	ULONG initialBackoff;
+	ULONG maxBackoff;
+};
+
+#endif // _RECOVERY_POLICY_H_
@@ -0,0 +1,54 @@
+/**
+********************************************************************************
+\file   ReloadOutcome.h
+
+\brief  Outcomes of OplkQtApi::ReloadConfiguration
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _RELOAD_OUTCOME_H_
+#define _RELOAD_OUTCOME_H_
+
+namespace ReloadOutcome
+{
+	/**
+	 * \brief Defines the ProcessImage in use after a reload of the configuration.
+	 *
+	 * \see OplkQtApi::ReloadConfiguration
+	 */
+	enum ReloadOutcome
+	{
+		UNCHANGED = 0,    ///< The memory of the old ProcessImage is still in use. The stack keeps running.
+		REALLOCATED,      ///< The ProcessImage has been reallocated and the new one is in use.
+		SHUT_DOWN         ///< The stack has been shut down. No ProcessImage is allocated.
+	};
+
+} // namespace ReloadOutcome
+
+#endif // _RELOAD_OUTCOME_H_
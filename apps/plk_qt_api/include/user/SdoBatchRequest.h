@@ -0,0 +1,133 @@
+/**
+********************************************************************************
+\file   SdoBatchRequest.h
+
+\brief  A single SDO transfer request of a SDO batch
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_BATCH_REQUEST_H_
+#define _SDO_BATCH_REQUEST_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief This class describes one object to be read or written by a SdoBatch.
+ *
+ * Unlike SdoTransferJob the request does not refer to a data buffer of the
+ * caller. The SdoBatch owns the buffers of all its requests.
+ *
+ * \see SdoBatch
+ */
+class PLKQTAPI_EXPORT SdoBatchRequest
+{
+public:
+	/**
+	 * \brief Read request.
+	 *
+	 * \param[in] nodeId    Node id to which SDO is to be transferred.
+	 * \param[in] index     The index of the object.
+	 * \param[in] subIndex  The subindex of the object.
+	 * \param[in] dataSize  The size of the object in bytes.
+	 * \param[in] sdoType   The protocol type.
+	 */
+	SdoBatchRequest(const UINT nodeId,
+		const UINT index,
+		const UINT subIndex,
+		const UINT dataSize,
+		tSdoType sdoType = kSdoTypeAsnd);
+
+	/**
+	 * \brief Write request.
+	 *
+	 * \param[in] nodeId     Node id to which SDO is to be transferred.
+	 * \param[in] index      The index of the object.
+	 * \param[in] subIndex   The subindex of the object.
+	 * \param[in] writeData  The value to be written in 'Little Endian'.
+	 * \param[in] sdoType    The protocol type.
+	 */
+	SdoBatchRequest(const UINT nodeId,
+		const UINT index,
+		const UINT subIndex,
+		const std::vector<BYTE>& writeData,
+		tSdoType sdoType = kSdoTypeAsnd);
+
+	/**
+	 * \return Node id of the node.
+	 */
+	UINT GetNodeId() const;
+
+	/**
+	 * \return Index of the object.
+	 */
+	UINT GetIndex() const;
+
+	/**
+	 * \return Subindex of the object.
+	 */
+	UINT GetSubIndex() const;
+
+	/**
+	 * \return Size of the data in bytes.
+	 */
+	UINT GetDataSize() const;
+
+	/**
+	 * \return Type of the SDO transfer.
+	 */
+	tSdoType GetSdoType() const;
+
+	/**
+	 * \return AccessType of the SDO transfer.
+	 */
+	tSdoAccessType GetSdoAccessType() const;
+
+	/**
+	 * \return The value to be written. Empty for read requests.
+	 */
+	const std::vector<BYTE>& GetWriteData() const;
+
+private:
+	UINT nodeId;
+	UINT index;
+	UINT subIndex;
+	UINT dataSize;
+	tSdoType sdoType;
+	tSdoAccessType sdoAccessType;
+	std::vector<BYTE> writeData;
+};
+
+#endif // _SDO_BATCH_REQUEST_H_
@@ -0,0 +1,137 @@
+/**
+********************************************************************************
+\file   SdoRetryPolicy.h
+
+\brief  Retry, timeout and back-off policy of SDO transfers
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_RETRY_POLICY_H_
+#define _SDO_RETRY_POLICY_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+#include "user/SdoTransferResult.h"
+
+/**
+ * \brief This class describes how the SdoScheduler repeats a transfer which
+ * failed due to a transient error.
+ *
+ * A transfer is repeated if the lower layer aborted it, the node did not
+ * answer in time or the attempt exceeded the attempt timeout. Aborts by the
+ * remote node, e.g. for a missing object, are not repeated.
+ *
+ * The n-th retry is issued after a back-off of initialBackoff * 2^(n-1)
+ * milliseconds, limited to maxBackoff and varied randomly by up to
+ * jitter percent.
+ *
+ * \see SdoScheduler::SetRetryPolicy
+ */
+class PLKQTAPI_EXPORT SdoRetryPolicy
+{
+public:
+	/**
+	 * \brief Policy without retries.
+	 */
+	SdoRetryPolicy();
+
+	/**
+	 * \param[in] maxRetries      Number of retries after the first attempt.
+	 * \param[in] initialBackoff  Back-off before the first retry in ms.
+	 * \param[in] maxBackoff      Upper limit of the back-off in ms.
+	 * \param[in] jitter          Random variation of the back-off in percent, up to 100.
+	 * \param[in] attemptTimeout  Time in ms after which an attempt is aborted.
+	 *                            0 to rely on the SDO timeout of the stack.
+	 * \param[in] failoverToUdp   Repeat transfers issued via ASnd via UDP.
+	 */
+	SdoRetryPolicy(const UINT maxRetries,
+		const UINT initialBackoff,
+		const UINT maxBackoff,
+		const UINT jitter,
+		const UINT attemptTimeout,
+		const bool failoverToUdp);
+
+	/**
+	 * \return Number of retries after the first attempt.
+	 */
+	UINT GetMaxRetries() const;
+
+	/**
+	 * \return Back-off before the first retry in ms.
+	 */
+	UINT GetInitialBackoff() const;
+
+	/**
+	 * \return Upper limit of the back-off in ms.
+	 */
+	UINT GetMaxBackoff() const;
+
+	/**
+	 * \return Random variation of the back-off in percent.
+	 */
+	UINT GetJitter() const;
+
+	/**
+	 * \return Time in ms after which an attempt is aborted. 0 if disabled.
+	 */
+	UINT GetAttemptTimeout() const;
+
+	/**
+	 * \return Whether transfers issued via ASnd are repeated via UDP.
+	 */
+	bool IsFailoverToUdp() const;
+
+	/**
+	 * \param[in] result    The result of the failed attempt.
+	 * \param[in] timedOut  Whether the attempt exceeded the attempt timeout.
+	 * \retval true  If the error is transient.
+	 * \retval false Otherwise.
+	 */
+	bool IsRetryable(const SdoTransferResult& result, const bool timedOut) const;
+
+	/**
+	 * \param[in] retry  Number of the retry, starting with 1.
+	 * \return The back-off before the retry in ms, including the jitter.
+	 */
+	UINT GetBackoff(const UINT retry) const;
+
+private:
+	UINT maxRetries;
+	UINT initialBackoff;
+	UINT maxBackoff;
+	UINT jitter;
+	UINT attemptTimeout;
+	bool failoverToUdp;
+};
+
+#endif // _SDO_RETRY_POLICY_H_
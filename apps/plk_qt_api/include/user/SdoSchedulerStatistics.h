@@ -0,0 +1,117 @@
+/**
+********************************************************************************
+\file   SdoSchedulerStatistics.h
+
+\brief  Snapshot of the SDO scheduler statistics
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_SCHEDULER_STATISTICS_H_
+#define _SDO_SCHEDULER_STATISTICS_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief This class contains a snapshot of the SdoScheduler statistics.
+ *
+ * \see SdoScheduler::GetStatistics
+ */
+class PLKQTAPI_EXPORT SdoSchedulerStatistics
+{
+public:
+	SdoSchedulerStatistics();
+
+	/**
+	 * \param[in] queueDepth          Number of transfers waiting to be issued.
+	 * \param[in] peakQueueDepth      Maximum number of waiting transfers.
+	 * \param[in] inFlight            Number of transfers issued to the stack.
+	 * \param[in] completed           Number of successfully finished transfers.
+	 * \param[in] failed              Number of aborted or rejected transfers.
+	 * \param[in] retried             Number of retries of failed attempts.
+	 * \param[in] transfersPerSecond  Finished transfers per second of busy time.
+	 */
+	SdoSchedulerStatistics(const UINT queueDepth,
+		const UINT peakQueueDepth,
+		const UINT inFlight,
+		const ULONG completed,
+		const ULONG failed,
+		const ULONG retried,
+		const double transfersPerSecond);
+
+	/**
+	 * \return Number of transfers waiting to be issued.
+	 */
+	UINT GetQueueDepth() const;
+
+	/**
+	 * \return Maximum number of transfers which have been waiting at once.
+	 */
+	UINT GetPeakQueueDepth() const;
+
+	/**
+	 * \return Number of transfers issued to the stack and not yet finished.
+	 */
+	UINT GetInFlight() const;
+
+	/**
+	 * \return Number of successfully finished transfers.
+	 */
+	ULONG GetCompleted() const;
+
+	/**
+	 * \return Number of aborted, cancelled or rejected transfers.
+	 */
+	ULONG GetFailed() const;
+
+	/**
+	 * \return Number of retries of attempts which failed with a transient error.
+	 */
+	ULONG GetRetried() const;
+
+	/**
+	 * \return Finished transfers per second while the scheduler was busy.
+	 */
+	double GetTransfersPerSecond() const;
+
+private:
+	UINT queueDepth;
+	UINT peakQueueDepth;
+	UINT inFlight;
+	ULONG completed;
+	ULONG failed;
+	ULONG retried;
+	double transfersPerSecond;
+};
+
+#endif // _SDO_SCHEDULER_STATISTICS_H_
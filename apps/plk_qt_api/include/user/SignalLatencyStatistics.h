@@ -0,0 +1,153 @@
+/**
+********************************************************************************
+\file   SignalLatencyStatistics.h
+
+\brief  SignalLatencyStatistics accumulates the delivery latencies of a signal.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SIGNAL_LATENCY_STATISTICS_H_
+#define _SIGNAL_LATENCY_STATISTICS_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QString>
+
+#include "oplk/oplk.h"
+
+#include "common/QtApiGlobal.h"
+#include "user/MonitoredSignal.h"
+
+/**
+ * \brief This class accumulates the delivery latencies of one signal and
+ * the number of its deliveries waiting in the event queue.
+ *
+ * The latency is the time from the emission of the signal until the event
+ * loop of the receiving thread dispatches it. The latencies are counted in
+ * a histogram with logarithmic buckets: bucket i counts the latencies from
+ * 2^i to 2^(i+1) - 1 microseconds.
+ *
+ * \see SignalLatencyMonitor
+ */
+class PLKQTAPI_EXPORT SignalLatencyStatistics
+{
+public:
+	/**
+	 * \brief Number of buckets of the latency histogram.
+	 */
+	static const UINT kLatencyBuckets = 32;
+
+	SignalLatencyStatistics();
+
+	/**
+	 * \param[in] signal  The observed signal.
+	 */
+	explicit SignalLatencyStatistics(const MonitoredSignal::MonitoredSignal signal);
+
+	/**
+	 * \brief Accumulates a delivery.
+	 *
+	 * \param[in] latency  Time from the emission to the dispatch in microseconds.
+	 */
+	void AddLatency(const quint64 latency);
+
+	/**
+	 * \brief Accumulates a sample of the queue depth.
+	 *
+	 * \param[in] depth  Number of emitted but not yet dispatched deliveries.
+	 */
+	void AddQueueDepth(const UINT depth);
+
+	/**
+	 * \return The observed signal.
+	 */
+	MonitoredSignal::MonitoredSignal GetSignal() const;
+
+	/**
+	 * \return The name of the observed signal.
+	 */
+	QString GetSignalName() const;
+
+	/**
+	 * \return Number of dispatched deliveries.
+	 */
+	ULONG GetCount() const;
+
+	/**
+	 * \return Average latency in microseconds.
+	 */
+	quint64 GetAverageLatency() const;
+
+	/**
+	 * \return Maximum latency in microseconds.
+	 */
+	quint64 GetMaxLatency() const;
+
+	/**
+	 * \param[in] percent  The percentile, from 0 to 100.
+	 * \return The upper bound of the histogram bucket containing the
+	 * percentile of the latencies in microseconds.
+	 */
+	quint64 GetLatencyPercentile(const UINT percent) const;
+
+	/**
+	 * \param[in] bucket  Index of the bucket, less than kLatencyBuckets.
+	 * \return Number of deliveries in the bucket.
+	 */
+	ULONG GetLatencyHistogram(const UINT bucket) const;
+
+	/**
+	 * \return The queue depth of the last sample.
+	 */
+	UINT GetQueueDepth() const;
+
+	/**
+	 * \return The largest sampled queue depth.
+	 */
+	UINT GetMaxQueueDepth() const;
+
+	/**
+	 * \return The average of the sampled queue depths.
+	 */
+	double GetAverageQueueDepth() const;
+
+private:
+	MonitoredSignal::MonitoredSignal signal;
+	ULONG count;
+	quint64 totalLatency;
+	quint64 maxLatency;
+	ULONG latencyHistogram[kLatencyBuckets];
+	ULONG depthSamples;
+	quint64 totalDepth;
+	UINT depth;
+	UINT maxDepth;
+};
+
+#endif // _SIGNAL_LATENCY_STATISTICS_H_
@@ -0,0 +1,106 @@
+/**
+********************************************************************************
+\file   CdcEntry.h
+
+\brief  Describes a single object entry of a concise device configuration (CDC).
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _CDC_ENTRY_H_
+#define _CDC_ENTRY_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief An object entry of the concise device configuration.
+ *
+ * The value is not copied. It points to the memory of the ConciseDcf it
+ * belongs to and is valid as long as that ConciseDcf is loaded.
+ */
+class PLKQTAPI_EXPORT CdcEntry
+{
+public:
+	/**
+	 * \param[in] index     Object index.
+	 * \param[in] subIndex  Object sub-index.
+	 * \param[in] size      Size of the value in bytes.
+	 * \param[in] value     Pointer to the value inside the CDC.
+	 */
+	CdcEntry(const UINT index,
+		const UINT subIndex,
+		const UINT size,
+		const BYTE* value);
+
+	/**
+	 * \return The object index.
+	 */
+	UINT GetIndex() const;
+
+	/**
+	 * \return The object sub-index.
+	 */
+	UINT GetSubIndex() const;
+
+	/**
+	 * \return The size of the value in bytes.
+	 */
+	UINT GetSize() const;
+
+	/**
+	 * \return The pointer to the raw value in 'Little Endian'.
+	 */
+	const BYTE* GetValue() const;
+
+	/**
+	 * \brief Returns the value as an unsigned integer.
+	 *
+	 * \return The value converted from 'Little Endian'.
+	 * \throws std::out_of_range If the value is larger than 8 bytes.
+	 */
+	ULONGLONG GetUnsignedValue() const;
+
+	/**
+	 * \retval true  If the entry is stored before the given entry.
+	 * \retval false Otherwise.
+	 */
+	bool operator<(const CdcEntry& entry) const;
+
+private:
+	UINT index;          ///< Object index.
+	UINT subIndex;       ///< Object sub-index.
+	UINT size;           ///< Size of the value in bytes.
+	const BYTE* value;   ///< Value inside the CDC memory.
+};
+
+#endif // _CDC_ENTRY_H_
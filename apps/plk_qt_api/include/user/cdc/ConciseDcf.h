@@ -0,0 +1,192 @@
+/**
+********************************************************************************
+\file   ConciseDcf.h
+
+\brief  Reads a concise device configuration (CDC) and provides the
+		configured objects of all the nodes.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _CONCISE_DCF_H_
+#define _CONCISE_DCF_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <map>
+#include <string>
+#include <vector>
+
+#include <QtCore/QFile>
+
+#include <oplk/oplk.h>
+
+#include "user/cdc/CdcEntry.h"
+#include "user/cdc/PdoMappingObject.h"
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Provides the object dictionary entries configured by a concise
+ * device configuration (CDC).
+ *
+ * The CDC is read in place. A file is memory mapped and a buffer is used
+ * as it is, so none of the values are copied. The entries of the local node
+ * are stored with the node id ConciseDcf::kLocalNodeId. The configurations
+ * of the CNs, which are stored within the object 0x1F22 of the local node,
+ * are stored with the node id of the CN.
+ *
+ * The CDC format is a list of entries in 'Little Endian':
+ * - UINT32 Number of entries.
+ * - For each entry: UINT16 index, UINT8 sub-index, UINT32 size, value.
+ */
+class PLKQTAPI_EXPORT ConciseDcf
+{
+public:
+	static const UINT kLocalNodeId = 0;  ///< Node id used for the local node entries.
+
+	ConciseDcf();
+
+	~ConciseDcf();
+
+	/**
+	 * \brief Memory maps and reads the given CDC file.
+	 *
+	 * \param[in] fileName  File name of the CDC.
+	 * \throws std::invalid_argument If the file cannot be opened or mapped.
+	 * \throws std::out_of_range If an entry exceeds the size of the CDC.
+	 */
+	void Load(const std::string& fileName);
+
+	/**
+	 * \brief Reads the CDC from the given buffer.
+	 *
+	 * \param[in] cdcBuffer  Buffer to the CDC contents.
+	 * \param[in] size       Size of the buffer in bytes.
+	 * \note The buffer is not copied and has to be valid until the
+	 *       ConciseDcf is unloaded.
+	 * \throws std::invalid_argument If the buffer is NULL.
+	 * \throws std::out_of_range If an entry exceeds the size of the CDC.
+	 */
+	void Load(const BYTE* cdcBuffer, const UINT size);
+
+	/**
+	 * \brief Removes all the entries and releases the CDC memory.
+	 */
+	void Unload();
+
+	/**
+	 * \return The pointer to the CDC contents. NULL if nothing is loaded.
+	 * \note Can be passed to OplkQtApi::SetCdc(const BYTE*, const UINT).
+	 */
+	const BYTE* GetData() const;
+
+	/**
+	 * \return The size of the CDC in bytes.
+	 */
+	UINT GetSize() const;
+
+	/**
+	 * \return The list of node ids which have entries in the CDC.
+	 */
+	std::vector<UINT> GetNodeIds() const;
+
+	/**
+	 * \param[in] nodeId  Node id of the node.
+	 * \return The entries of the node sorted by index and sub-index.
+	 * \throws std::out_of_range If the node has no entries.
+	 */
+	const std::vector<CdcEntry>& GetEntries(const UINT nodeId) const;
+
+	/**
+	 * \param[in] nodeId    Node id of the node.
+	 * \param[in] index     Object index.
+	 * \param[in] subIndex  Object sub-index.
+	 * \retval true  If the object is configured for the node.
+	 * \retval false Otherwise.
+	 */
+	bool HasEntry(const UINT nodeId, const UINT index, const UINT subIndex) const;
+
+	/**
+	 * \param[in] nodeId    Node id of the node.
+	 * \param[in] index     Object index.
+	 * \param[in] subIndex  Object sub-index.
+	 * \return The requested entry.
+	 * \throws std::out_of_range If the object is not configured for the node.
+	 */
+	const CdcEntry& GetEntry(const UINT nodeId,
+							const UINT index,
+							const UINT subIndex) const;
+
+	/**
+	 * \return The cycle time (0x1006) of the local node in microseconds.
+	 * \throws std::out_of_range If the cycle time is not configured.
+	 */
+	ULONG GetCycleTime() const;
+
+	/**
+	 * \param[in] nodeId  Node id of the node.
+	 * \return The PDO mapping objects (0x16xx and 0x1Axx) configured for the node.
+	 */
+	std::vector<UINT> GetPdoMappingIndices(const UINT nodeId) const;
+
+	/**
+	 * \brief Returns the objects mapped by a PDO mapping object.
+	 *
+	 * Only the entries within the number of mapped objects (sub-index 0)
+	 * and with a length different from zero are returned.
+	 *
+	 * \param[in] nodeId        Node id of the node.
+	 * \param[in] mappingIndex  Index of the mapping object (0x16xx or 0x1Axx).
+	 * \return The list of mapped objects.
+	 */
+	std::vector<PdoMappingObject> GetPdoMapping(const UINT nodeId,
+												const UINT mappingIndex) const;
+
+private:
+	ConciseDcf(const ConciseDcf& cdc);
+	ConciseDcf& operator=(const ConciseDcf& cdc);
+
+	/**
+	 * \brief Walks the entries of a CDC in place.
+	 *
+	 * \param[in] buffer      Start of the CDC.
+	 * \param[in] bufferSize  Size of the CDC in bytes.
+	 * \param[in] nodeId      Node id the entries belong to.
+	 * \throws std::out_of_range If an entry exceeds the size of the CDC.
+	 */
+	void ParseEntries(const BYTE* buffer, const UINT bufferSize, const UINT nodeId);
+
+	QFile file;          ///< CDC file, if it has been loaded from a file.
+	const BYTE* data;    ///< CDC contents.
+	UINT size;           ///< Size of the CDC in bytes.
+	std::map<UINT, std::vector<CdcEntry> > nodes; ///< Entries per node id.
+};
+
+#endif // _CONCISE_DCF_H_
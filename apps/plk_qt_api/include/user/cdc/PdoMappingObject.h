@@ -0,0 +1,95 @@
+/**
+********************************************************************************
+\file   PdoMappingObject.h
+
+\brief  Describes a single object mapped into a PDO.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _PDO_MAPPING_OBJECT_H_
+#define _PDO_MAPPING_OBJECT_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <oplk/oplk.h>
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Decodes an entry of a PDO mapping object (0x16xx / 0x1Axx).
+ *
+ * Layout of the 64 bit mapping entry:
+ * - Bits  0-15: Index of the mapped object.
+ * - Bits 16-23: Sub-index of the mapped object.
+ * - Bits 32-47: Offset of the object within the PDO in bits.
+ * - Bits 48-63: Length of the object in bits.
+ */
+class PLKQTAPI_EXPORT PdoMappingObject
+{
+public:
+	/**
+	 * \param[in] mappingEntry  The 64 bit value of the mapping entry.
+	 */
+	explicit PdoMappingObject(const ULONGLONG mappingEntry);
+
+	/**
+	 * \return Index of the mapped object.
+	 */
+	UINT GetIndex() const;
+
+	/**
+	 * \return Sub-index of the mapped object.
+	 */
+	UINT GetSubIndex() const;
+
+	/**
+	 * \return Offset of the mapped object within the PDO in bits.
+	 */
+	UINT GetBitOffset() const;
+
+	/**
+	 * \return Length of the mapped object in bits.
+	 */
+	UINT GetBitSize() const;
+
+	/**
+	 * \retval true  If the entry maps an object.
+	 * \retval false If the entry is unused (zero length).
+	 */
+	bool IsValid() const;
+
+private:
+	UINT index;      ///< Index of the mapped object.
+	UINT subIndex;   ///< Sub-index of the mapped object.
+	UINT bitOffset;  ///< Offset within the PDO in bits.
+	UINT bitSize;    ///< Length in bits.
+};
+
+#endif // _PDO_MAPPING_OBJECT_H_
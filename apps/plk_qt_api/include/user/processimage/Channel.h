@@ -103,6 +103,15 @@ public:
 	 */
 	Direction::Direction GetDirection() const;
 
+	/**
+	 * \brief Compares all the properties of the Channel.
+	 *
+	 * \param[in] channel  The Channel to compare with.
+	 * \retval true  If all the properties are equal.
+	 * \retval false If any of the properties differ.
+	 */
+	bool operator==(const Channel& channel) const;
+
 private:
 	std::string name;                       ///< Name
 	IECDataType::IECDataType dataType;     ///< dataType
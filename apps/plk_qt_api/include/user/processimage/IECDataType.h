@@ -67,13 +67,34 @@ namespace IECDataType
 		IEC_WSTRING     ///< Variable length double byte character string
 	};
 
+	/**
+	 * \brief Properties of an IECDataType.
+	 */
+	struct IECDataTypeInfo
+	{
+		unsigned int bitSize;    ///< Size in bits. 0 for variable length types.
+		bool isSigned;           ///< Signed numeric value.
+		unsigned int alignment;  ///< Alignment within the ProcessImage in bits.
+		unsigned int hexWidth;   ///< Number of hex digits to print the value. 0 for variable length types.
+	};
+
 	/**
 	 * \brief   Convert string value to the equivalent IECDataType.
+	 *
+	 * The comparison is case insensitive and resolves the name by its length
+	 * and first character instead of comparing it against all the names.
+	 *
 	 * \param[in]  iecDataTypeStr  The string with IEC datatype.
-	 * \return The matching IECDataType.
+	 * \return The matching IECDataType. UNDEFINED if there is no match.
 	 */
 	IECDataType GetIECDatatype(const std::string& iecDataTypeStr);
 
+	/**
+	 * \param[in] iecDataType  The IECDataType.
+	 * \return The properties of the given IECDataType.
+	 */
+	const IECDataTypeInfo& GetIECDataTypeInfo(IECDataType iecDataType);
+
 } // namespace IECDataType
 
 #endif // _IEC_DATATYPE_H_
@@ -114,6 +114,33 @@ public:
 	 */
 	bool AddChannel(const Channel& channel);
 
+	/**
+	 * \brief   Inserts a list of Channels into the list of channels.
+	 *
+	 * The list is sorted by the Channel name and the channels are appended
+	 * to the map with an end() hint, so each insert is amortized constant
+	 * instead of a full tree lookup. Channels which does not belong to the
+	 * direction of this ProcessImage and duplicate names are skipped.
+	 *
+	 * \param[in,out] channels  The list of Channel objects. It is sorted in place.
+	 * \return The number of channels added.
+	 */
+	UINT AddChannels(std::vector<Channel>& channels);
+
+	/**
+	 * \brief   Exchanges the size, channels and data pointer with the given
+	 *          ProcessImage without copying the channels.
+	 *
+	 * \param[in,out] processImage  The ProcessImage of the same direction.
+	 * \throws std::invalid_argument If the directions are different.
+	 */
+	void Swap(ProcessImage& processImage);
+
+	/**
+	 * \return The direction of the ProcessImage.
+	 */
+	Direction::Direction virtual GetDirection() const = 0;
+
 	/**
 	 * \param[in] name  The name of the Channel.
 	 * \return The Channel with the given name.
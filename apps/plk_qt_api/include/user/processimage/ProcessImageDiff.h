@@ -0,0 +1,102 @@
+/**
+********************************************************************************
+\file   ProcessImageDiff.h
+
+\brief  Describes the differences between two ProcessImage channel tables.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _PROCESSIMAGE_DIFF_H_
+#define _PROCESSIMAGE_DIFF_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <vector>
+
+#include "user/processimage/Channel.h"
+#include "user/processimage/ProcessImage.h"
+
+#include "common/QtApiGlobal.h"
+
+/**
+ * \brief Compares the channel table of an active ProcessImage with the one of
+ * a newly parsed ProcessImage.
+ *
+ * The channels are compared by their name. A channel present in both
+ * ProcessImages with different properties is reported as changed.
+ * It is used to decide which parts of the ProcessImage have to be rebuilt
+ * while reloading the configuration of a running stack.
+ */
+class PLKQTAPI_EXPORT ProcessImageDiff
+{
+public:
+	/**
+	 * \brief Compares the given ProcessImages.
+	 *
+	 * \param[in] oldPi  The ProcessImage that is currently in use.
+	 * \param[in] newPi  The newly parsed ProcessImage.
+	 */
+	ProcessImageDiff(const ProcessImage& oldPi, const ProcessImage& newPi);
+
+	/**
+	 * \return The channels which are only present in the new ProcessImage.
+	 */
+	const std::vector<Channel>& GetAddedChannels() const;
+
+	/**
+	 * \return The channels which are only present in the old ProcessImage.
+	 */
+	const std::vector<Channel>& GetRemovedChannels() const;
+
+	/**
+	 * \return The new definition of the channels whose properties have changed.
+	 */
+	const std::vector<Channel>& GetChangedChannels() const;
+
+	/**
+	 * \retval true  If the size of the ProcessImage has changed.
+	 * \retval false If the size of the ProcessImage is the same.
+	 */
+	bool IsSizeChanged() const;
+
+	/**
+	 * \retval true  If both the ProcessImages are identical.
+	 * \retval false If any channel or the size has changed.
+	 */
+	bool IsEmpty() const;
+
+private:
+	std::vector<Channel> addedChannels;    ///< Channels only in the new ProcessImage.
+	std::vector<Channel> removedChannels;  ///< Channels only in the old ProcessImage.
+	std::vector<Channel> changedChannels;  ///< Channels with modified properties.
+	bool sizeChanged;                      ///< ProcessImage size has changed.
+};
+
+#endif // _PROCESSIMAGE_DIFF_H_
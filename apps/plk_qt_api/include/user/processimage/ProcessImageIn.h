@@ -103,6 +103,11 @@ public:
 			const UINT byteOffset,
 			const UINT bitOffset = 0);
 
+	/**
+	 * \return Direction::PI_IN
+	 */
+	Direction::Direction virtual GetDirection() const;
+
 private:
 
 	/**
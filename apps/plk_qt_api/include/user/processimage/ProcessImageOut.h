@@ -60,6 +60,11 @@ public:
 	ProcessImageOut(const UINT byteSize,
 		const std::map<std::string, Channel>& channels);
 
+	/**
+	 * \return Direction::PI_OUT
+	 */
+	Direction::Direction virtual GetDirection() const;
+
 private:
 	/**
 	 * \brief   Add Channel of the ProcessImage Class.
@@ -119,6 +119,8 @@ protected:
 	static const std::string channel_attribute_bitOffset_not_found;
 
 	static const std::string processImage_attribute_type_invalid_value;
+	static const std::string channel_attribute_dataType_invalid_value;
+	static const std::string channel_attribute_bitSize_invalid_value;
 
 private:
 	ProcessImageParser(const ProcessImageParser& rhs);
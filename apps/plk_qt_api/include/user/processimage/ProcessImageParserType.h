@@ -43,7 +43,8 @@ namespace ProcessImageParserType
 	enum ProcessImageParserType
 	{
 		UNDEFINED = 0,
-		QT_XML_PARSER
+		QT_XML_PARSER,
+		QT_XML_PARALLEL_PARSER ///< Parses each ProcessImage element in its own thread.
 	};
 
 } // namespace ProcessImageParserType
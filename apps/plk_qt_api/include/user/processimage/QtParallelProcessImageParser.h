@@ -0,0 +1,100 @@
+/**
+********************************************************************************
+\file   QtParallelProcessImageParser.h
+
+\brief  Definitions of a process image parser which parses the input and
+		output process images concurrently using the Qt 5.2 QXmlStreamReader
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _QT_PARALLEL_PROCESSIMAGE_PARSER_H_
+#define _QT_PARALLEL_PROCESSIMAGE_PARSER_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <string>
+#include <vector>
+
+#include "user/processimage/ProcessImageParser.h"
+
+/**
+ * \brief  Inherits ProcessImageParser and parses every ProcessImage element
+ * of the xml description in its own thread.
+ *
+ * The description is split at the ProcessImage element boundaries. Each
+ * section is parsed by a QtProcessImageParser which sees the complete
+ * document with the other sections blanked out, so the ApplicationProcess
+ * structure is still validated and the reported line and column numbers are
+ * those of the original document. The channel tables of the sections are then
+ * moved into this parser without copying.
+ *
+ * If more than one section has failed, the error which occurs first in the
+ * document is thrown, so the result does not depend on the thread scheduling.
+ * Descriptions which can not be split safely (e.g. with comments or CDATA)
+ * are parsed sequentially.
+ *
+ * \note Uses XmlParserException to handle the errors.
+ */
+class QtParallelProcessImageParser : public ProcessImageParser
+{
+
+public:
+	/**
+	 * \brief Position of a ProcessImage element in the xml description.
+	 */
+	struct Section
+	{
+		std::size_t begin; ///< Offset of the '<' of the start tag.
+		std::size_t end;   ///< Offset after the '>' of the end tag.
+	};
+
+private:
+	/**
+	 * \brief   Implements the ProcessImage parser.
+	 * \param[in] xmlDescription  Char pointer to the xml contents.
+	 * \throws std::invalid_argument if xml file buffer is NULL.
+	 * \throws XmlParserException If any error occurred.
+	 */
+	void virtual ParseInternal(const char* xmlDescription);
+
+	/**
+	 * \brief   Locates the ProcessImage elements in the xml description.
+	 *
+	 * \param[in]  document  The xml description.
+	 * \param[out] sections  The ProcessImage sections in document order.
+	 * \retval true  If the description can be split at the sections.
+	 * \retval false If the description has to be parsed sequentially.
+	 */
+	static bool FindSections(const std::string& document,
+							std::vector<Section>& sections);
+
+};
+
+#endif // _QT_PARALLEL_PROCESSIMAGE_PARSER_H_
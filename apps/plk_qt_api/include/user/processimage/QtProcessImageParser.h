@@ -39,6 +39,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*******************************************************************************
 * INCLUDES
 *******************************************************************************/
+#include <vector>
+
 #include <QXmlStreamReader>
 
 #include "user/processimage/ProcessImageParser.h"
@@ -57,6 +59,8 @@ class QtProcessImageParser : public ProcessImageParser
 private:
 
 	QXmlStreamReader xml; ///< Xml reader instance
+	std::vector<Channel> inChannels;  ///< Input channels collected until the end of the document.
+	std::vector<Channel> outChannels; ///< Output channels collected until the end of the document.
 
 	/**
 	 * \brief   Implements the ProcessImage parser.
@@ -0,0 +1,259 @@
+/**
+********************************************************************************
+\file   ErrorStatistics.cpp
+
+\brief  Aggregates the error events of the nodes.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <algorithm>
+
+#include <QtCore/QDateTime>
+
+#include "api/ErrorStatistics.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Orders the entries by node id and error code.
+	 */
+	bool IsLowerKey(const ErrorStatisticsEntry& first, const ErrorStatisticsEntry& second)
+	{
+		if (first.GetNodeId() != second.GetNodeId())
+			return (first.GetNodeId() < second.GetNodeId());
+		return (first.GetErrorCode() < second.GetErrorCode());
+	}
+
+	/**
+	 * \brief Orders the entries by descending rate and number of occurrences.
+	 */
+	bool IsWorseOffender(const ErrorStatisticsEntry& first, const ErrorStatisticsEntry& second)
+	{
+		if (first.GetRate() != second.GetRate())
+			return (first.GetRate() > second.GetRate());
+		return (first.GetCount() > second.GetCount());
+	}
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+ErrorStatistics::ErrorStatistics() :
+		mutex(),
+		clock(),
+		entries(),
+		overflowCount(0)
+{
+	this->clock.start();
+	this->Reset();
+}
+
+bool ErrorStatistics::AddError(const UINT nodeId, const UINT16 errorCode, ULONG& suppressed)
+{
+	QMutexLocker lock(&this->mutex);
+
+	Entry* entry = this->FindEntry(nodeId, errorCode);
+	if (entry == NULL)
+	{
+		++this->overflowCount;
+		return true;
+	}
+
+	const qint64 now = this->clock.elapsed();
+	const qint64 nowSlot = now / ErrorStatistics::kSlotLength;
+
+	if (entry->count == 0)
+	{
+		entry->firstOccurrence = QDateTime::currentMSecsSinceEpoch();
+		entry->newestSlot = nowSlot;
+		entry->logWindowStart = now;
+	}
+	entry->lastOccurrence = QDateTime::currentMSecsSinceEpoch();
+	++entry->count;
+
+	// Clear the slots which have passed since the last occurrence.
+	for (qint64 slot = entry->newestSlot + 1;
+		 (slot <= nowSlot) && (slot <= (entry->newestSlot + ErrorStatistics::kWindowSlots));
+		 ++slot)
+	{
+		entry->slotCounts[slot % ErrorStatistics::kWindowSlots] = 0;
+	}
+	if (nowSlot > entry->newestSlot)
+		entry->newestSlot = nowSlot;
+	++entry->slotCounts[nowSlot % ErrorStatistics::kWindowSlots];
+
+	if ((now - entry->logWindowStart)
+			>= (qint64) (ErrorStatistics::kWindowSlots * ErrorStatistics::kSlotLength))
+	{
+		entry->logWindowStart = now;
+		entry->loggedInWindow = 0;
+	}
+
+	if (entry->loggedInWindow >= ErrorStatistics::kLogBurst)
+	{
+		++entry->suppressedCount;
+		++entry->pendingSuppressed;
+		return false;
+	}
+
+	++entry->loggedInWindow;
+	suppressed = entry->pendingSuppressed;
+	entry->pendingSuppressed = 0;
+	return true;
+}
+
+void ErrorStatistics::Reset()
+{
+	QMutexLocker lock(&this->mutex);
+
+	for (UINT i = 0; i < ErrorStatistics::kCapacity; ++i)
+	{
+		Entry& entry = this->entries[i];
+		entry.used = false;
+		entry.nodeId = 0;
+		entry.errorCode = 0;
+		entry.count = 0;
+		entry.firstOccurrence = 0;
+		entry.lastOccurrence = 0;
+		entry.newestSlot = 0;
+		for (UINT slot = 0; slot < ErrorStatistics::kWindowSlots; ++slot)
+		{
+			entry.slotCounts[slot] = 0;
+		}
+		entry.logWindowStart = 0;
+		entry.loggedInWindow = 0;
+		entry.suppressedCount = 0;
+		entry.pendingSuppressed = 0;
+	}
+	this->overflowCount = 0;
+}
+
+std::vector<ErrorStatisticsEntry> ErrorStatistics::GetEntries() const
+{
+	QMutexLocker lock(&this->mutex);
+
+	const qint64 nowSlot = this->clock.elapsed() / ErrorStatistics::kSlotLength;
+	std::vector<ErrorStatisticsEntry> result;
+	for (UINT i = 0; i < ErrorStatistics::kCapacity; ++i)
+	{
+		if (this->entries[i].used)
+			result.push_back(ErrorStatistics::ToStatisticsEntry(this->entries[i], nowSlot));
+	}
+
+	std::sort(result.begin(), result.end(), IsLowerKey);
+	return result;
+}
+
+std::vector<ErrorStatisticsEntry> ErrorStatistics::GetEntries(const UINT nodeId) const
+{
+	QMutexLocker lock(&this->mutex);
+
+	const qint64 nowSlot = this->clock.elapsed() / ErrorStatistics::kSlotLength;
+	std::vector<ErrorStatisticsEntry> result;
+	for (UINT i = 0; i < ErrorStatistics::kCapacity; ++i)
+	{
+		if (this->entries[i].used && (this->entries[i].nodeId == nodeId))
+			result.push_back(ErrorStatistics::ToStatisticsEntry(this->entries[i], nowSlot));
+	}
+
+	std::sort(result.begin(), result.end(), IsLowerKey);
+	return result;
+}
+
+std::vector<ErrorStatisticsEntry> ErrorStatistics::GetTopOffenders(const UINT count) const
+{
+	std::vector<ErrorStatisticsEntry> result = this->GetEntries();
+	std::stable_sort(result.begin(), result.end(), IsWorseOffender);
+	if (result.size() > count)
+		result.resize(count);
+	return result;
+}
+
+ULONG ErrorStatistics::GetOverflowCount() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->overflowCount;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+ErrorStatistics::Entry* ErrorStatistics::FindEntry(const UINT nodeId,
+						const UINT16 errorCode)
+{
+	const quint32 key = ((quint32) nodeId << 16) | errorCode;
+	// Multiplicative hashing spreads the error codes of a node over the table.
+	const UINT start = (UINT) ((key * 2654435761U) % ErrorStatistics::kCapacity);
+
+	for (UINT probe = 0; probe < ErrorStatistics::kCapacity; ++probe)
+	{
+		Entry& entry = this->entries[(start + probe) % ErrorStatistics::kCapacity];
+		if (!entry.used)
+		{
+			entry.used = true;
+			entry.nodeId = nodeId;
+			entry.errorCode = errorCode;
+			return &entry;
+		}
+
+		if ((entry.nodeId == nodeId) && (entry.errorCode == errorCode))
+			return &entry;
+	}
+	return NULL;
+}
+
+ErrorStatisticsEntry ErrorStatistics::ToStatisticsEntry(const Entry& entry,
+						const qint64 nowSlot)
+{
+	ULONG windowCount = 0;
+	for (UINT age = 0; age < ErrorStatistics::kWindowSlots; ++age)
+	{
+		const qint64 slot = entry.newestSlot - age;
+		if ((slot < 0) || (slot <= (nowSlot - ErrorStatistics::kWindowSlots)))
+			break;
+
+		windowCount += entry.slotCounts[slot % ErrorStatistics::kWindowSlots];
+	}
+
+	const double windowLength = (ErrorStatistics::kWindowSlots
+								* ErrorStatistics::kSlotLength) / 1000.0;
+	return ErrorStatisticsEntry(entry.nodeId,
+						entry.errorCode,
+						entry.count,
+						entry.firstOccurrence,
+						entry.lastOccurrence,
+						windowCount / windowLength,
+						entry.suppressedCount);
+}
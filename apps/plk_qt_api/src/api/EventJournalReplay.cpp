@@ -0,0 +1,180 @@
+/**
+********************************************************************************
+\file   EventJournalReplay.cpp
+
+\brief  Implementation of EventJournalReplay class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <cstring>
+
+#include <QtCore/QFile>
+#include <QtCore/QElapsedTimer>
+
+#include "api/EventJournalReplay.h"
+#include "api/EventJournalWriter.h"
+#include "api/OplkEventHandler.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Longest time in us the replay sleeps before it checks for a stop request.
+	 */
+	const qint64 kMaxSleep = 100000;
+
+	/**
+	 * \brief Reads a value of the journal in host byte order.
+	 *
+	 * \return true if the value has been read completely.
+	 */
+	template<typename T>
+	bool ReadValue(QFile& file, T& value)
+	{
+		return (file.read((char*) &value, sizeof(T)) == (qint64) sizeof(T));
+	}
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+EventJournalReplay::EventJournalReplay(const QString& fileName,
+		const double speed) :
+		QThread(),
+		fileName(fileName),
+		speed((speed > 0) ? speed : 0),
+		stopRequested(0)
+{
+	// The event handler has to live in the thread of the application.
+	OplkEventHandler::GetInstance();
+}
+
+void EventJournalReplay::Stop()
+{
+	this->stopRequested.storeRelease(1);
+}
+
+/*******************************************************************************
+* Protected functions
+*******************************************************************************/
+void EventJournalReplay::run()
+{
+	ulong eventCount = 0;
+	QFile file(this->fileName);
+
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		emit this->SignalReplayFinished(eventCount, file.errorString());
+		return;
+	}
+
+	char magic[sizeof(EventJournalWriter::kMagic)];
+	UINT32 version = 0;
+	UINT32 argSize = 0;
+	if ((file.read(magic, sizeof(magic)) != (qint64) sizeof(magic))
+		|| (std::memcmp(magic, EventJournalWriter::kMagic, sizeof(magic)) != 0)
+		|| !ReadValue(file, version)
+		|| !ReadValue(file, argSize))
+	{
+		emit this->SignalReplayFinished(eventCount, "Not an event journal");
+		return;
+	}
+
+	if ((version != EventJournalWriter::kVersion)
+		|| (argSize != sizeof(tOplkApiEventArg)))
+	{
+		emit this->SignalReplayFinished(eventCount,
+				"The journal was recorded by an incompatible version");
+		return;
+	}
+
+	// The events only reach the application, not the stack.
+	OplkEventHandler& eventHandler = OplkEventHandler::GetInstance();
+	if (!eventHandler.BeginReplay())
+	{
+		emit this->SignalReplayFinished(eventCount,
+				"The stack is initialised or another journal is being replayed");
+		return;
+	}
+
+	QElapsedTimer clock;
+	clock.start();
+
+	qint64 timestamp = 0;
+	UINT32 eventType = 0;
+	UINT32 payloadSize = 0;
+	tOplkApiEventArg eventArg;
+
+	while ((this->stopRequested.loadAcquire() == 0) && ReadValue(file, timestamp))
+	{
+		std::memset(&eventArg, 0, sizeof(eventArg));
+		if (!ReadValue(file, eventType)
+			|| !ReadValue(file, payloadSize)
+			|| (payloadSize > sizeof(eventArg))
+			|| (file.read((char*) &eventArg, payloadSize) != (qint64) payloadSize))
+		{
+			eventHandler.EndReplay();
+			emit this->SignalReplayFinished(eventCount, "The journal is truncated");
+			return;
+		}
+
+		this->WaitUntilDue(timestamp, clock.nsecsElapsed() / 1000);
+		if (this->stopRequested.loadAcquire() != 0)
+			break;
+
+		OplkEventHandler::AppCbEvent((tOplkApiEventType) eventType, &eventArg, NULL);
+		++eventCount;
+	}
+
+	eventHandler.EndReplay();
+	emit this->SignalReplayFinished(eventCount, QString());
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void EventJournalReplay::WaitUntilDue(const qint64 timestamp,
+		const qint64 elapsed)
+{
+	if (this->speed == 0)
+		return;
+
+	qint64 remaining = (qint64) (timestamp / this->speed) - elapsed;
+	while ((remaining > 0) && (this->stopRequested.loadAcquire() == 0))
+	{
+		const qint64 sleep = (remaining < kMaxSleep) ? remaining : kMaxSleep;
+		QThread::usleep((unsigned long) sleep);
+		remaining -= sleep;
+	}
+}
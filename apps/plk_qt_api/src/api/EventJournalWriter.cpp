@@ -0,0 +1,241 @@
+/**
+********************************************************************************
+\file   EventJournalWriter.cpp
+
+\brief  Implementation of EventJournalWriter class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "api/EventJournalWriter.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Number of events which can be queued for the writer.
+	 */
+	const UINT kQueueCapacity = 4096;
+
+	/**
+	 * \brief Time in ms after which the writer checks for a stop request.
+	 */
+	const ULONG kWriterPollInterval = 100;
+}
+
+const char EventJournalWriter::kMagic[8] = {'O', 'P', 'L', 'K', 'J', 'R', 'N', 'L'};
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+EventJournalWriter::EventJournalWriter() :
+		QThread(),
+		mutex(),
+		queueNotEmpty(),
+		recording(0),
+		clock(),
+		file(),
+		queue(kQueueCapacity),
+		queueHead(0),
+		queueCount(0),
+		dropped(0)
+{
+
+}
+
+EventJournalWriter::~EventJournalWriter()
+{
+	this->Close();
+}
+
+bool EventJournalWriter::Open(const QString& fileName)
+{
+	if (this->IsOpen() || this->isRunning())
+		return false;
+
+	this->file.setFileName(fileName);
+	if (!this->file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+		return false;
+
+	const UINT32 version = EventJournalWriter::kVersion;
+	const UINT32 argSize = sizeof(tOplkApiEventArg);
+	this->file.write(EventJournalWriter::kMagic, sizeof(EventJournalWriter::kMagic));
+	this->file.write((const char*) &version, sizeof(version));
+	this->file.write((const char*) &argSize, sizeof(argSize));
+
+	this->mutex.lock();
+	this->queueHead = 0;
+	this->queueCount = 0;
+	this->dropped = 0;
+	this->mutex.unlock();
+
+	this->clock.start();
+	this->recording.storeRelease(1);
+	this->start();
+
+	return true;
+}
+
+void EventJournalWriter::Close()
+{
+	this->recording.storeRelease(0);
+
+	if (this->isRunning())
+	{
+		this->requestInterruption();
+		this->mutex.lock();
+		this->queueNotEmpty.wakeAll();
+		this->mutex.unlock();
+		this->wait();
+	}
+}
+
+bool EventJournalWriter::IsOpen() const
+{
+	return (this->recording.loadAcquire() != 0);
+}
+
+void EventJournalWriter::Record(const tOplkApiEventType eventType,
+		const tOplkApiEventArg& eventArg)
+{
+	if (!this->IsOpen() || (EventJournalWriter::GetPayloadSize(eventType) == 0))
+		return;
+
+	QMutexLocker lock(&this->mutex);
+	if (this->queueCount == kQueueCapacity)
+	{
+		++this->dropped;
+		return;
+	}
+
+	Entry& entry = this->queue[(this->queueHead + this->queueCount) % kQueueCapacity];
+	entry.timestamp = this->clock.nsecsElapsed() / 1000;
+	entry.eventType = eventType;
+	entry.eventArg = eventArg;
+	// The receiver context of a SDO transfer is only valid in this process.
+	if (eventType == kOplkApiEventSdo)
+		entry.eventArg.sdoInfo.pUserArg = NULL;
+
+	++this->queueCount;
+	this->queueNotEmpty.wakeOne();
+}
+
+ULONG EventJournalWriter::GetDroppedEvents() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->dropped;
+}
+
+UINT EventJournalWriter::GetPayloadSize(const tOplkApiEventType eventType)
+{
+	switch (eventType)
+	{
+		case kOplkApiEventNmtStateChange:
+			return sizeof(tEventNmtStateChange);
+		case kOplkApiEventCriticalError:
+		case kOplkApiEventWarning:
+			return sizeof(tEventError);
+		case kOplkApiEventHistoryEntry:
+			return sizeof(tErrHistoryEntry);
+		case kOplkApiEventNode:
+			return sizeof(tOplkApiEventNode);
+		case kOplkApiEventSdo:
+			return sizeof(tSdoComFinished);
+		case kOplkApiEventCfmProgress:
+			return sizeof(tCfmEventCnProgress);
+		case kOplkApiEventCfmResult:
+			return sizeof(tOplkApiEventCfmResult);
+		case kOplkApiEventPdoChange:
+			return sizeof(tOplkApiEventPdoChange);
+		default:
+			return 0;
+	}
+}
+
+/*******************************************************************************
+* Protected functions
+*******************************************************************************/
+void EventJournalWriter::run()
+{
+	std::vector<Entry> pending;
+	bool stop = false;
+
+	while (!stop)
+	{
+		this->mutex.lock();
+		if (this->queueCount == 0)
+			this->queueNotEmpty.wait(&this->mutex, kWriterPollInterval);
+
+		// Events queued before the stop request are still written.
+		stop = this->isInterruptionRequested();
+		pending.clear();
+		for (; this->queueCount > 0; --this->queueCount)
+		{
+			pending.push_back(this->queue[this->queueHead]);
+			this->queueHead = (this->queueHead + 1) % kQueueCapacity;
+		}
+		this->mutex.unlock();
+
+		for (std::vector<Entry>::const_iterator it = pending.begin();
+			 it != pending.end(); ++it)
+		{
+			if (!this->Write(*it))
+			{
+				qDebug("Event journal: %s", qPrintable(this->file.errorString()));
+				this->recording.storeRelease(0);
+				stop = true;
+				break;
+			}
+		}
+	}
+
+	this->file.close();
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+bool EventJournalWriter::Write(const Entry& entry)
+{
+	const UINT32 eventType = entry.eventType;
+	const UINT32 payloadSize = EventJournalWriter::GetPayloadSize(entry.eventType);
+
+	return ((this->file.write((const char*) &entry.timestamp, sizeof(entry.timestamp))
+				== (qint64) sizeof(entry.timestamp))
+			&& (this->file.write((const char*) &eventType, sizeof(eventType))
+				== (qint64) sizeof(eventType))
+			&& (this->file.write((const char*) &payloadSize, sizeof(payloadSize))
+				== (qint64) sizeof(payloadSize))
+			&& (this->file.write((const char*) &entry.eventArg, payloadSize)
+				== (qint64) payloadSize));
+}
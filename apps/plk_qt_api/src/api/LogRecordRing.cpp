@@ -0,0 +1,99 @@
+/**
+********************************************************************************
+\file   LogRecordRing.cpp
+
+\brief  Implementation of LogRecordRing class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "api/LogRecordRing.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	const int kPositionMask = (2 * LogRecordRing::kCapacity) - 1;
+	const int kIndexMask = LogRecordRing::kCapacity - 1;
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+LogRecordRing::LogRecordRing() :
+		head(0),
+		tail(0),
+		dropped(0),
+		records()
+{
+
+}
+
+bool LogRecordRing::Push(const LogRecord& record)
+{
+	// Only the producer modifies the head.
+	const int headPos = this->head.load();
+	const int tailPos = this->tail.loadAcquire();
+
+	if (((headPos - tailPos) & kPositionMask) == LogRecordRing::kCapacity)
+	{
+		this->dropped.fetchAndAddRelaxed(1);
+		return false;
+	}
+
+	this->records[headPos & kIndexMask] = record;
+	// Publish the record before the consumer can see the new head.
+	this->head.storeRelease((headPos + 1) & kPositionMask);
+
+	return true;
+}
+
+bool LogRecordRing::Pop(LogRecord& record)
+{
+	// Only the consumer modifies the tail.
+	const int tailPos = this->tail.load();
+	const int headPos = this->head.loadAcquire();
+
+	if (headPos == tailPos)
+		return false;
+
+	record = this->records[tailPos & kIndexMask];
+	// Release the slot only after the record has been copied.
+	this->tail.storeRelease((tailPos + 1) & kPositionMask);
+
+	return true;
+}
+
+UINT LogRecordRing::TakeDropped()
+{
+	return (UINT) this->dropped.fetchAndStoreRelaxed(0);
+}
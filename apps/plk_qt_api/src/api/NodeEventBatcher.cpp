@@ -0,0 +1,186 @@
+/**
+********************************************************************************
+\file   NodeEventBatcher.cpp
+
+\brief  Implementation of NodeEventBatcher class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QDateTime>
+#include <QtCore/QMetaType>
+
+#include "api/NodeEventBatcher.h"
+#include "api/SignalLatencyMonitor.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+NodeEventBatcher::NodeEventBatcher() :
+		QObject(),
+		mutex(),
+		enabled(0),
+		window(0),
+		maxCount(0),
+		eventCount(0),
+		flushScheduled(false),
+		timer(),
+		pendingEvents(),
+		nodeStates()
+{
+	for (UINT nodeId = 0; nodeId < NodeEventBatcher::kMaxNodes; ++nodeId)
+	{
+		this->nodeStates[nodeId] = kNmtGsOff;
+		this->pendingEvents[nodeId].pending = false;
+		this->pendingEvents[nodeId].found = false;
+		this->pendingEvents[nodeId].oldState = kNmtGsOff;
+		this->pendingEvents[nodeId].timestamp = 0;
+	}
+
+	this->timer.setSingleShot(true);
+	QObject::connect(&this->timer, SIGNAL(timeout()), this, SLOT(Flush()));
+
+	/* qRegisterMetaType<T>() is only required for sending the object
+	 * through queued signals and slots.
+	 */
+	qRegisterMetaType<QVector<NodeEvent> >("QVector<NodeEvent>");
+}
+
+void NodeEventBatcher::Enable(const UINT window, const UINT maxCount)
+{
+	QMutexLocker lock(&this->mutex);
+	this->window = window;
+	this->maxCount = maxCount;
+	this->enabled.storeRelease(1);
+}
+
+void NodeEventBatcher::Disable()
+{
+	this->enabled.storeRelease(0);
+	this->Flush();
+}
+
+bool NodeEventBatcher::IsEnabled() const
+{
+	return (this->enabled.loadAcquire() != 0);
+}
+
+void NodeEventBatcher::AddNodeFound(const UINT nodeId)
+{
+	if (!this->IsEnabled() || (nodeId >= NodeEventBatcher::kMaxNodes))
+		return;
+
+	QMutexLocker lock(&this->mutex);
+	this->AddEvent(nodeId);
+	this->pendingEvents[nodeId].found = true;
+}
+
+void NodeEventBatcher::AddNodeStateChanged(const UINT nodeId,
+		const tNmtState nmtState)
+{
+	if (!this->IsEnabled() || (nodeId >= NodeEventBatcher::kMaxNodes))
+		return;
+
+	QMutexLocker lock(&this->mutex);
+	this->AddEvent(nodeId);
+	this->nodeStates[nodeId] = nmtState;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void NodeEventBatcher::AddEvent(const UINT nodeId)
+{
+	PendingNodeEvent& event = this->pendingEvents[nodeId];
+	if (!event.pending)
+	{
+		event.pending = true;
+		event.found = false;
+		event.oldState = this->nodeStates[nodeId];
+	}
+	event.timestamp = QDateTime::currentMSecsSinceEpoch();
+
+	if (this->eventCount == 0)
+	{
+		// The timer belongs to the thread of the batcher.
+		QMetaObject::invokeMethod(this, "StartWindow", Qt::QueuedConnection);
+	}
+	++this->eventCount;
+
+	if ((this->maxCount != 0)
+		&& (this->eventCount >= this->maxCount)
+		&& !this->flushScheduled)
+	{
+		this->flushScheduled = true;
+		QMetaObject::invokeMethod(this, "Flush", Qt::QueuedConnection);
+	}
+}
+
+void NodeEventBatcher::StartWindow()
+{
+	QMutexLocker lock(&this->mutex);
+	// The batch may already have been delivered due to the event count.
+	if ((this->eventCount != 0) && !this->timer.isActive())
+		this->timer.start(this->window);
+}
+
+void NodeEventBatcher::Flush()
+{
+	QVector<NodeEvent> events;
+
+	this->mutex.lock();
+	for (UINT nodeId = 0; nodeId < NodeEventBatcher::kMaxNodes; ++nodeId)
+	{
+		PendingNodeEvent& event = this->pendingEvents[nodeId];
+		if (!event.pending)
+			continue;
+
+		if (event.found || (event.oldState != this->nodeStates[nodeId]))
+		{
+			events.append(NodeEvent(nodeId,
+							event.oldState,
+							this->nodeStates[nodeId],
+							event.timestamp,
+							event.found));
+		}
+		event.pending = false;
+	}
+	this->eventCount = 0;
+	this->flushScheduled = false;
+	this->timer.stop();
+	this->mutex.unlock();
+
+	if (!events.isEmpty())
+	{
+		emit this->SignalNodeEvents(events);
+		SignalLatencyMonitor::Enqueue(MonitoredSignal::NODE_EVENTS);
+	}
+}
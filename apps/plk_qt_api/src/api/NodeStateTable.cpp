@@ -0,0 +1,187 @@
+/**
+********************************************************************************
+\file   NodeStateTable.cpp
+
+\brief  Implementation of NodeStateTable class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QDateTime>
+
+#include "api/NodeStateTable.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+NodeStateTable::NodeStateTable() :
+		entries(),
+		generation(0)
+{
+	for (UINT nodeId = 0; nodeId < NodeStateTable::kMaxNodes; ++nodeId)
+	{
+		this->entries[nodeId].nmtState.store(kNmtGsOff);
+	}
+}
+
+void NodeStateTable::SetFound(const UINT nodeId)
+{
+	if (nodeId >= NodeStateTable::kMaxNodes)
+		return;
+
+	Entry& entry = this->entries[nodeId];
+	this->BeginWrite(entry);
+	entry.found.store(1);
+	NodeStateTable::SetLastChange(entry);
+	this->EndWrite(entry);
+}
+
+void NodeStateTable::SetNmtState(const UINT nodeId, const tNmtState nmtState)
+{
+	if (nodeId >= NodeStateTable::kMaxNodes)
+		return;
+
+	Entry& entry = this->entries[nodeId];
+	this->BeginWrite(entry);
+	// Only the writer modifies the entry, so the old values are stable.
+	if ((nmtState == kNmtCsNotActive)
+		&& (entry.found.load() != 0)
+		&& (entry.nmtState.load() != kNmtCsNotActive))
+	{
+		entry.lossCount.store(entry.lossCount.load() + 1);
+	}
+	entry.nmtState.store(nmtState);
+	NodeStateTable::SetLastChange(entry);
+	this->EndWrite(entry);
+}
+
+void NodeStateTable::AddError(const UINT nodeId, const UINT16 errorCode)
+{
+	if (nodeId >= NodeStateTable::kMaxNodes)
+		return;
+
+	Entry& entry = this->entries[nodeId];
+	this->BeginWrite(entry);
+	entry.errorCount.store(entry.errorCount.load() + 1);
+	entry.lastErrorCode.store(errorCode);
+	this->EndWrite(entry);
+}
+
+void NodeStateTable::Reset()
+{
+	for (UINT nodeId = 0; nodeId < NodeStateTable::kMaxNodes; ++nodeId)
+	{
+		Entry& entry = this->entries[nodeId];
+		this->BeginWrite(entry);
+		entry.nmtState.store(kNmtGsOff);
+		entry.lastChangeHigh.store(0);
+		entry.lastChangeLow.store(0);
+		entry.found.store(0);
+		entry.errorCount.store(0);
+		entry.lossCount.store(0);
+		entry.lastErrorCode.store(0);
+		this->EndWrite(entry);
+	}
+}
+
+NodeState NodeStateTable::GetNodeState(const UINT nodeId) const
+{
+	if (nodeId >= NodeStateTable::kMaxNodes)
+		return NodeState();
+
+	const Entry& entry = this->entries[nodeId];
+	int sequence = 0;
+	NodeState state;
+
+	do
+	{
+		sequence = entry.sequence.loadAcquire();
+		if ((sequence & 1) != 0)
+			continue;
+
+		// Acquire loads keep the check of the sequence behind the fields.
+		const quint64 lastChange =
+				((quint64) (quint32) entry.lastChangeHigh.loadAcquire() << 32)
+				| (quint32) entry.lastChangeLow.loadAcquire();
+		state = NodeState(nodeId,
+					(tNmtState) entry.nmtState.loadAcquire(),
+					(qint64) lastChange,
+					(entry.found.loadAcquire() != 0),
+					(UINT) entry.errorCount.loadAcquire(),
+					(UINT) entry.lossCount.loadAcquire(),
+					(UINT16) entry.lastErrorCode.loadAcquire());
+	} while (((sequence & 1) != 0) || (sequence != entry.sequence.load()));
+
+	return state;
+}
+
+QVector<NodeState> NodeStateTable::SnapshotNodes() const
+{
+	QVector<NodeState> nodes;
+
+	for (UINT nodeId = 0; nodeId < NodeStateTable::kMaxNodes; ++nodeId)
+	{
+		const NodeState state = this->GetNodeState(nodeId);
+		if (state.IsFound() || (state.GetLastChange() != 0))
+			nodes.append(state);
+	}
+
+	return nodes;
+}
+
+UINT NodeStateTable::GetGeneration() const
+{
+	return (UINT) this->generation.loadAcquire();
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void NodeStateTable::BeginWrite(Entry& entry)
+{
+	// Ordered: the odd sequence is visible before any field changes.
+	entry.sequence.fetchAndAddOrdered(1);
+}
+
+void NodeStateTable::EndWrite(Entry& entry)
+{
+	// Ordered: all field changes are visible before the even sequence.
+	entry.sequence.fetchAndAddOrdered(1);
+	this->generation.fetchAndAddOrdered(1);
+}
+
+void NodeStateTable::SetLastChange(Entry& entry)
+{
+	const quint64 now = (quint64) QDateTime::currentMSecsSinceEpoch();
+
+	entry.lastChangeHigh.store((int) (now >> 32));
+	entry.lastChangeLow.store((int) (now & 0xFFFFFFFFULL));
+}
@@ -0,0 +1,447 @@
+/**
+********************************************************************************
+\file   ObjectDictionaryCache.cpp
+
+\brief  Implementation of the object dictionary value cache
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <cstring>
+
+#include <QtCore/QMetaType>
+#include <QtCore/QtDebug>
+
+#include "api/ObjectDictionaryCache.h"
+#include "api/OplkQtApi.h"
+#include "api/SdoScheduler.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+ObjectDictionaryCache& ObjectDictionaryCache::GetInstance()
+{
+	// Local static object - Not thread safe
+	static ObjectDictionaryCache instance;
+	return instance;
+}
+
+void ObjectDictionaryCache::SetPolicy(const UINT nodeId,
+						const UINT index,
+						const UINT subIndex,
+						const ObjectCachePolicy::ObjectCachePolicy policy,
+						const ULONG timeToLive)
+{
+	QMutexLocker lock(&this->mutex);
+
+	const quint32 key = ObjectDictionaryCache::GetKey(nodeId, index, subIndex);
+	this->InvalidateKey(key);
+
+	CacheEntry& entry = this->entries[key];
+	entry.policy = policy;
+	entry.timeToLive = timeToLive;
+}
+
+tOplkError ObjectDictionaryCache::ReadLocal(const UINT index,
+						const UINT subIndex,
+						void* data,
+						UINT* dataSize)
+{
+	QMutexLocker lock(&this->mutex);
+
+	const quint32 key = ObjectDictionaryCache::GetKey(0, index, subIndex);
+	const CacheEntry* entry = this->FindValidEntry(key);
+	if (entry != NULL)
+	{
+		++this->hitCount;
+		const UINT size = ((UINT) entry->data.size() < *dataSize)
+						? (UINT) entry->data.size() : *dataSize;
+		std::memcpy(data, entry->data.constData(), size);
+		*dataSize = size;
+		return kErrorOk;
+	}
+
+	++this->missCount;
+	tOplkError oplkRet = oplk_readLocalObject(index, subIndex, data, dataSize);
+	if (oplkRet == kErrorOk)
+	{
+		this->Store(key, QByteArray((const char*) data, *dataSize));
+	}
+
+	return oplkRet;
+}
+
+bool ObjectDictionaryCache::Read(const UINT nodeId,
+						const UINT index,
+						const UINT subIndex,
+						const UINT dataSize,
+						const QObject& receiver,
+						const QMetaMethod& receiverFunction,
+						tSdoType sdoType)
+{
+	if (!receiverFunction.isValid())
+		return false;
+
+	QMutexLocker lock(&this->mutex);
+
+	const quint32 key = ObjectDictionaryCache::GetKey(nodeId, index, subIndex);
+	const Waiter waiter = {const_cast<QObject*>(&receiver), receiverFunction};
+
+	const CacheEntry* entry = this->FindValidEntry(key);
+	if (entry != NULL)
+	{
+		++this->hitCount;
+		// The value is limited to the requested size like a read by the stack.
+		const QByteArray data = entry->data.left(dataSize);
+		return receiverFunction.invoke(const_cast<QObject*>(&receiver),
+						Qt::QueuedConnection,
+						Q_ARG(SdoTransferResult, SdoTransferResult(nodeId,
+													index,
+													subIndex,
+													data.size(),
+													kSdoAccessTypeRead,
+													kSdoComTransferFinished,
+													0)),
+						Q_ARG(QByteArray, data));
+	}
+
+	PendingReadList& reads = this->pendingReads[key];
+	for (PendingReadList::iterator it = reads.begin(); it != reads.end(); ++it)
+	{
+		// A read started before an invalidation may return the old value.
+		if ((it->dataSize == dataSize) && !it->invalidated)
+		{
+			++this->coalescedCount;
+			it->waiters.push_back(waiter);
+			return true;
+		}
+	}
+
+	++this->missCount;
+	reads.push_back(PendingRead());
+	PendingRead& read = reads.back();
+	read.transferId = 0;
+	read.dataSize = dataSize;
+	read.buffer.fill(0, dataSize);
+	read.waiters.push_back(waiter);
+	read.invalidated = false;
+
+	// The result is delivered through a queued connection and waits for the mutex.
+	read.transferId = SdoScheduler::GetInstance().Enqueue(
+					SdoTransferJob(nodeId,
+								index,
+								subIndex,
+								read.buffer.data(),
+								dataSize,
+								sdoType,
+								kSdoAccessTypeRead),
+					*this,
+					this->metaObject()->method(this->metaObject()->indexOfSlot(
+						QMetaObject::normalizedSignature(
+						"HandleSdoTransferFinished(const ULONG,const SdoTransferResult)").constData())));
+	if (read.transferId == 0)
+	{
+		reads.pop_back();
+		if (reads.empty())
+		{
+			this->pendingReads.erase(key);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+void ObjectDictionaryCache::Invalidate(const UINT nodeId,
+						const UINT index,
+						const UINT subIndex)
+{
+	QMutexLocker lock(&this->mutex);
+	this->InvalidateKey(ObjectDictionaryCache::GetKey(nodeId, index, subIndex));
+}
+
+void ObjectDictionaryCache::InvalidateAll()
+{
+	QMutexLocker lock(&this->mutex);
+
+	for (std::map<quint32, CacheEntry>::iterator it = this->entries.begin();
+		 it != this->entries.end(); ++it)
+	{
+		it->second.valid = false;
+		it->second.data.clear();
+	}
+
+	for (std::map<quint32, PendingReadList>::iterator it = this->pendingReads.begin();
+		 it != this->pendingReads.end(); ++it)
+	{
+		this->InvalidatePendingReads(it->first);
+	}
+}
+
+ULONG ObjectDictionaryCache::GetHitCount() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->hitCount;
+}
+
+ULONG ObjectDictionaryCache::GetMissCount() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->missCount;
+}
+
+ULONG ObjectDictionaryCache::GetCoalescedCount() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->coalescedCount;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+ObjectDictionaryCache::ObjectDictionaryCache() :
+		QObject(),
+		mutex(),
+		entries(),
+		pendingReads(),
+		clock(),
+		hitCount(0),
+		missCount(0),
+		coalescedCount(0)
+{
+	/* qRegisterMetaType<T>() is only required for sending the object
+	 * through queued signal/slot connections.
+	 */
+	qRegisterMetaType<SdoTransferResult>("SdoTransferResult");
+	qRegisterMetaType<tNmtState>("tNmtState");
+
+	this->clock.start();
+
+	bool ret = OplkQtApi::RegisterNodeStateChangedEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandleNodeStateChanged(const int, tNmtState)").constData())));
+	Q_ASSERT(ret != false);
+
+	ret = OplkQtApi::RegisterLocalNodeStateChangedEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandleLocalNodeStateChanged(tNmtState)").constData())));
+	Q_ASSERT(ret != false);
+
+	ret = OplkQtApi::RegisterPdoChangedEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandlePdoChanged(const int)").constData())));
+	Q_ASSERT(ret != false);
+}
+
+void ObjectDictionaryCache::HandleSdoTransferFinished(const ULONG transferId,
+						const SdoTransferResult result)
+{
+	QMutexLocker lock(&this->mutex);
+
+	const quint32 key = ObjectDictionaryCache::GetKey(result.GetNodeId(),
+												result.GetIndex(),
+												result.GetSubIndex());
+	std::map<quint32, PendingReadList>::iterator reads = this->pendingReads.find(key);
+	if (reads == this->pendingReads.end())
+		return;
+
+	PendingReadList::iterator pending = reads->second.begin();
+	while ((pending != reads->second.end())
+		&& (pending->transferId != transferId))
+	{
+		++pending;
+	}
+	if (pending == reads->second.end())
+		return;
+
+	QByteArray data;
+	if (result.GetSdoComConState() == kSdoComTransferFinished)
+	{
+		data = pending->buffer.left(result.GetTransferredBytes());
+		if (!pending->invalidated)
+		{
+			this->Store(key, data);
+		}
+	}
+
+	for (std::vector<Waiter>::const_iterator it = pending->waiters.begin();
+		 it != pending->waiters.end(); ++it)
+	{
+		if (it->receiver.isNull())
+			continue;
+
+		it->receiverFunction.invoke(it->receiver.data(),
+						Qt::QueuedConnection,
+						Q_ARG(SdoTransferResult, result),
+						Q_ARG(QByteArray, data));
+	}
+
+	reads->second.erase(pending);
+	if (reads->second.empty())
+	{
+		this->pendingReads.erase(reads);
+	}
+}
+
+void ObjectDictionaryCache::HandleNodeStateChanged(const int nodeId,
+						tNmtState nmtState)
+{
+	QMutexLocker lock(&this->mutex);
+
+	this->InvalidateNode(nodeId, ObjectCachePolicy::NMT_STATE_CHANGE);
+
+	// The node has been reset and boots again.
+	if (nmtState == kNmtCsNotActive)
+	{
+		this->InvalidateNode(nodeId, ObjectCachePolicy::STATIC);
+	}
+}
+
+void ObjectDictionaryCache::HandleLocalNodeStateChanged(tNmtState nmtState)
+{
+	switch (nmtState)
+	{
+		case kNmtGsOff:
+		case kNmtGsInitialising:
+		case kNmtGsResetApplication:
+		case kNmtGsResetCommunication:
+		case kNmtGsResetConfiguration:
+			// The whole network boots again.
+			this->InvalidateAll();
+			break;
+		default:
+		{
+			QMutexLocker lock(&this->mutex);
+			this->InvalidateNode(0, ObjectCachePolicy::NMT_STATE_CHANGE);
+			break;
+		}
+	}
+}
+
+void ObjectDictionaryCache::HandlePdoChanged(const int nodeId)
+{
+	QMutexLocker lock(&this->mutex);
+
+	// The mapping objects of the local node change as well.
+	this->InvalidateNode(nodeId, ObjectCachePolicy::PDO_CHANGE);
+	this->InvalidateNode(0, ObjectCachePolicy::PDO_CHANGE);
+}
+
+quint32 ObjectDictionaryCache::GetKey(const UINT nodeId,
+						const UINT index,
+						const UINT subIndex)
+{
+	// The local objects are read locally and through SDO with the node id.
+	const UINT keyNodeId = (nodeId == OplkQtApi::initParam.nodeId) ? 0 : nodeId;
+	return ((keyNodeId & 0xFF) << 24) | ((index & 0xFFFF) << 8) | (subIndex & 0xFF);
+}
+
+const ObjectDictionaryCache::CacheEntry* ObjectDictionaryCache::FindValidEntry(
+						const quint32 key)
+{
+	std::map<quint32, CacheEntry>::iterator it = this->entries.find(key);
+	if ((it == this->entries.end())
+		|| (it->second.policy == ObjectCachePolicy::UNDEFINED)
+		|| !it->second.valid)
+	{
+		return NULL;
+	}
+
+	if ((it->second.policy == ObjectCachePolicy::TIME_TO_LIVE)
+		&& ((this->clock.elapsed() - it->second.readTime) >= it->second.timeToLive))
+	{
+		it->second.valid = false;
+		it->second.data.clear();
+		return NULL;
+	}
+
+	return &it->second;
+}
+
+void ObjectDictionaryCache::Store(const quint32 key, const QByteArray& data)
+{
+	std::map<quint32, CacheEntry>::iterator it = this->entries.find(key);
+	if ((it == this->entries.end())
+		|| (it->second.policy == ObjectCachePolicy::UNDEFINED))
+	{
+		return;
+	}
+
+	it->second.data = data;
+	it->second.readTime = this->clock.elapsed();
+	it->second.valid = true;
+}
+
+void ObjectDictionaryCache::InvalidateNode(const UINT nodeId,
+						const ObjectCachePolicy::ObjectCachePolicy policy)
+{
+	const quint32 first = ObjectDictionaryCache::GetKey(nodeId, 0, 0);
+	const quint32 last = ObjectDictionaryCache::GetKey(nodeId, 0xFFFF, 0xFF);
+
+	for (std::map<quint32, CacheEntry>::iterator it = this->entries.lower_bound(first);
+		 (it != this->entries.end()) && (it->first <= last); ++it)
+	{
+		if (it->second.policy != policy)
+			continue;
+
+		it->second.valid = false;
+		it->second.data.clear();
+		this->InvalidatePendingReads(it->first);
+	}
+}
+
+void ObjectDictionaryCache::InvalidateKey(const quint32 key)
+{
+	std::map<quint32, CacheEntry>::iterator it = this->entries.find(key);
+	if (it != this->entries.end())
+	{
+		it->second.valid = false;
+		it->second.data.clear();
+	}
+
+	this->InvalidatePendingReads(key);
+}
+
+void ObjectDictionaryCache::InvalidatePendingReads(const quint32 key)
+{
+	std::map<quint32, PendingReadList>::iterator reads = this->pendingReads.find(key);
+	if (reads == this->pendingReads.end())
+		return;
+
+	for (PendingReadList::iterator it = reads->second.begin();
+		 it != reads->second.end(); ++it)
+	{
+		it->invalidated = true;
+	}
+}
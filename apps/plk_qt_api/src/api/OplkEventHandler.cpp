@@ -39,21 +39,70 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*******************************************************************************
 * INCLUDES
 *******************************************************************************/
-#include <QtCore/QDateTime>
 #include <QtCore/QString>
 #include <QtCore/QMetaMethod>
+#include <QtCore/QElapsedTimer>
 #include <oplk/debugstr.h>
 
 #include "api/OplkEventHandler.h"
+#include "api/SdoTransferPool.h"
+#include "api/SdoStatistics.h"
+#include "api/SignalLatencyMonitor.h"
 
 /*******************************************************************************
 * PUBLIC Functions
 *******************************************************************************/
-void OplkEventHandler::AwaitNmtGsOff()
+bool OplkEventHandler::AwaitNmtGsOff(const ULONG timeout)
 {
-	OplkEventHandler::mutex.lock();
-	OplkEventHandler::nmtGsOffCondition.wait(&(OplkEventHandler::mutex));
-	OplkEventHandler::mutex.unlock();
+	QMutexLocker lock(&this->mutex);
+
+	QElapsedTimer timer;
+	timer.start();
+	// NMT_GS_OFF may have been reached before the wait.
+	while (!this->nmtGsOff)
+	{
+		const qint64 elapsed = timer.elapsed();
+		if (elapsed >= (qint64) timeout)
+			return false;
+
+		this->nmtGsOffCondition.wait(&this->mutex, (ulong) (timeout - elapsed));
+	}
+	return true;
+}
+
+void OplkEventHandler::ClearNmtGsOff()
+{
+	QMutexLocker lock(&this->mutex);
+	this->nmtGsOff = false;
+}
+
+bool OplkEventHandler::SetStackInitialised(const bool initialised)
+{
+	QMutexLocker lock(&this->mutex);
+
+	// The replay and the stack would both feed the event handler.
+	if (initialised && (this->replaying.loadAcquire() != 0))
+		return false;
+
+	this->stackInitialised = initialised;
+	return true;
+}
+
+bool OplkEventHandler::BeginReplay()
+{
+	QMutexLocker lock(&this->mutex);
+
+	if (this->stackInitialised || (this->replaying.loadAcquire() != 0))
+		return false;
+
+	this->replaying.storeRelease(1);
+	return true;
+}
+
+void OplkEventHandler::EndReplay()
+{
+	QMutexLocker lock(&this->mutex);
+	this->replaying.storeRelease(0);
 }
 
 tOplkApiCbEvent OplkEventHandler::GetAppEventCbFunc(void)
@@ -64,8 +113,26 @@ tOplkApiCbEvent OplkEventHandler::GetAppEventCbFunc(void)
 /*******************************************************************************
 * PRIVATE Functions
 *******************************************************************************/
-OplkEventHandler::OplkEventHandler()
+OplkEventHandler::OplkEventHandler() :
+		mutex(),
+		nmtGsOffCondition(),
+		nmtGsOff(true),
+		stackInitialised(false),
+		logRecords(),
+		logDrainPending(0),
+		logLevels(),
+		nodeEventBatcher(),
+		nodeStateTable(),
+		pdoMappingModel(),
+		errorStatistics(),
+		journalWriter(),
+		replaying(0)
 {
+	/* qRegisterMetaType<T>() is only required for sending the object
+	 * through queued signals and slots.
+	 */
+	qRegisterMetaType<LogRecord>("LogRecord");
+	qRegisterMetaType<CriticalError>("CriticalError");
 }
 
 OplkEventHandler& OplkEventHandler::GetInstance()
@@ -81,6 +148,9 @@ tOplkError OplkEventHandler::AppCbEvent(tOplkApiEventType eventType,
 {
 	tOplkError oplkRet = kErrorGeneralError;
 
+	if (OplkEventHandler::GetInstance().replaying.loadAcquire() == 0)
+		OplkEventHandler::GetInstance().journalWriter.Record(eventType, *eventArg);
+
 	switch (eventType)
 	{
 		case kOplkApiEventNmtStateChange:
@@ -147,21 +217,24 @@ tOplkError OplkEventHandler::AppCbEvent(tOplkApiEventType eventType,
 void OplkEventHandler::TriggerLocalNodeStateChanged(tNmtState nmtState)
 {
 	emit this->SignalLocalNodeStateChanged(nmtState);
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::LOCAL_NODE_STATE_CHANGED);
 }
 
 void OplkEventHandler::TriggerNodeFound(const int nodeId)
 {
 	emit this->SignalNodeFound(nodeId);
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::NODE_FOUND);
 }
 
 void OplkEventHandler::TriggerNodeStateChanged(const int nodeId,
 							tNmtState nmtState)
 {
 	emit this->SignalNodeStateChanged(nodeId, nmtState);
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::NODE_STATE_CHANGED);
 }
 
 void OplkEventHandler::TriggerSdoTransferFinished(const tSdoComFinished& result,
-							const ReceiverContext* receiverContext)
+							ReceiverContext* receiverContext)
 {
 	SdoTransferResult sdoTransferResult = SdoTransferResult(result.nodeId,
 											result.targetIndex,
@@ -171,54 +244,155 @@ void OplkEventHandler::TriggerSdoTransferFinished(const tSdoComFinished& result,
 											result.sdoComConState,
 											result.abortCode);
 
-	emit this->SignalSdoTransferFinished(sdoTransferResult);
-
-	tOplkError oplkRet = oplk_freeSdoChannel(result.sdoComConHdl);
-	if (oplkRet != kErrorOk)
+	// Free the channel first, so the target can start the next transfer to the node.
+	// The handle of a replayed transfer is not a channel of the stack.
+	if (this->replaying.loadAcquire() == 0)
 	{
-		// TODO throw? freeSdoChannel err.
-		qDebug("free SDO channel fail. Err: 0x%x", oplkRet);
+		tOplkError oplkRet = oplk_freeSdoChannel(result.sdoComConHdl);
+		if (oplkRet != kErrorOk)
+		{
+			// TODO throw? freeSdoChannel err.
+			qDebug("free SDO channel fail. Err: 0x%x", oplkRet);
+		}
 	}
 
 	if (receiverContext)
 	{
-		bool disconnected = QObject::disconnect(&OplkEventHandler::GetInstance(),
-							QMetaMethod::fromSignal(&OplkEventHandler::SignalSdoTransferFinished),
-							receiverContext->GetReceiver(),
-							*(receiverContext->GetReceiverFunction()));
-		if (!disconnected)
-		{
-			qDebug("Disconnect failed ! RetVal %d", disconnected);
-			/* This should not happen concerning the implementation of OplkQtApi::TransferObject
-			 * TODO report error.
-			 */
-		}
-		else
+		SdoStatistics::GetInstance().Record(sdoTransferResult,
+							receiverContext->GetSdoType(),
+							receiverContext->GetLatency());
+
+		// Every transfer carries its own target. No connection is shared.
+		if (!receiverContext->Dispatch(sdoTransferResult))
 		{
-			qDebug("Disconnected Success");
+			qDebug("SDO transfer result of node %d not delivered", result.nodeId);
 		}
-		delete receiverContext;
+		SignalLatencyMonitor::Enqueue(MonitoredSignal::SDO_TRANSFER_FINISHED);
+		SdoTransferPool::GetInstance().Release(receiverContext);
 	}
 	else
 	{
-		qDebug("NULL Receiver Context. Not disconnected");
+		emit this->SignalSdoTransferFinished(sdoTransferResult);
+		SignalLatencyMonitor::Enqueue(MonitoredSignal::SDO_TRANSFER_FINISHED);
 	}
 }
 
-void OplkEventHandler::TriggerPrintLog(QString logStr)
+void OplkEventHandler::TriggerSdoTransferProgress(const tSdoComFinished& progress,
+							const ReceiverContext* receiverContext)
 {
-	QString str;
+	if (receiverContext == NULL)
+		return;
+
+	receiverContext->DispatchProgress(SdoTransferResult(progress.nodeId,
+											progress.targetIndex,
+											progress.targetSubIndex,
+											progress.transferredBytes,
+											progress.sdoAccessType,
+											progress.sdoComConState,
+											progress.abortCode));
+}
 
-	str.append(QDateTime::currentDateTime().toString("yyyy/MM/dd-hh:mm:ss.zzz"));
-	str.append(" - ");
-	str.append(logStr);
+void OplkEventHandler::TriggerPdoChanged(const int nodeId)
+{
+	emit this->SignalPdoChanged(nodeId);
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::PDO_CHANGED);
+}
+
+void OplkEventHandler::SetLogLevel(const LogCategory::LogCategory category,
+		const LogSeverity::LogSeverity minimum)
+{
+	if (category < LogCategory::NUMBER_OF_CATEGORIES)
+		this->logLevels[category].store(minimum);
+}
+
+LogSeverity::LogSeverity OplkEventHandler::GetLogLevel(
+		const LogCategory::LogCategory category) const
+{
+	if (category >= LogCategory::NUMBER_OF_CATEGORIES)
+		return LogSeverity::DISABLED;
 
-	emit this->SignalPrintLog(str);
+	return (LogSeverity::LogSeverity) this->logLevels[category].load();
+}
+
+bool OplkEventHandler::IsLogEnabled(const LogRecordType::LogRecordType type) const
+{
+	const LogCategory::LogCategory category = LogRecord::GetCategory(type);
+	if (LogRecord::GetSeverity(type) < this->logLevels[category].load())
+		return false;
+
+	// Records without a receiver would be discarded by the drain.
+	return (this->isSignalConnected(
+				QMetaMethod::fromSignal(&OplkEventHandler::SignalLogRecord))
+			|| this->isSignalConnected(
+				QMetaMethod::fromSignal(&OplkEventHandler::SignalPrintLog)));
+}
+
+void OplkEventHandler::TriggerLogRecord(const LogRecord& record)
+{
+	this->logRecords.Push(record);
+
+	// Schedule one drain for any number of records queued in the meantime.
+	if (this->logDrainPending.testAndSetOrdered(0, 1))
+	{
+		QMetaObject::invokeMethod(this, "DrainLogRecords", Qt::QueuedConnection);
+	}
 }
 
-void OplkEventHandler::TriggerCriticalError(const QString errorMessage)
+void OplkEventHandler::TriggerErrorsSuppressed(const UINT nodeId,
+								const UINT16 errorCode,
+								const ULONG suppressed)
 {
-	emit this->SignalCriticalError(errorMessage);
+	if ((suppressed == 0) || !this->IsLogEnabled(LogRecordType::ERRORS_SUPPRESSED))
+		return;
+
+	LogRecord record(LogRecordType::ERRORS_SUPPRESSED);
+	record.AddArg(nodeId);
+	record.AddArg(errorCode);
+	record.AddArg((UINT32) suppressed);
+	this->TriggerLogRecord(record);
+}
+
+void OplkEventHandler::DrainLogRecords()
+{
+	// Records pushed after this point schedule another drain.
+	this->logDrainPending.storeRelease(0);
+
+	const bool printLog = this->isSignalConnected(
+			QMetaMethod::fromSignal(&OplkEventHandler::SignalPrintLog));
+	LogRecord record;
+
+	while (this->logRecords.Pop(record))
+	{
+		emit this->SignalLogRecord(record);
+		SignalLatencyMonitor::Enqueue(MonitoredSignal::LOG_RECORD);
+		if (printLog)
+		{
+			emit this->SignalPrintLog(record.ToString());
+			SignalLatencyMonitor::Enqueue(MonitoredSignal::PRINT_LOG);
+		}
+	}
+
+	const UINT dropped = this->logRecords.TakeDropped();
+	if (dropped > 0)
+	{
+		LogRecord droppedRecord(LogRecordType::RECORDS_DROPPED);
+		droppedRecord.AddArg(dropped);
+
+		emit this->SignalLogRecord(droppedRecord);
+		SignalLatencyMonitor::Enqueue(MonitoredSignal::LOG_RECORD);
+		if (printLog)
+		{
+			emit this->SignalPrintLog(droppedRecord.ToString());
+			SignalLatencyMonitor::Enqueue(MonitoredSignal::PRINT_LOG);
+		}
+	}
+}
+
+void OplkEventHandler::TriggerCriticalError(const CriticalError& error)
+{
+	emit this->SignalCriticalError(error.GetMessage());
+	emit this->SignalCriticalErrorOccurred(error);
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::CRITICAL_ERROR);
 }
 
 tOplkError OplkEventHandler::ProcessNmtStateChangeEvent(
@@ -231,6 +405,21 @@ tOplkError OplkEventHandler::ProcessNmtStateChangeEvent(
 
 	this->TriggerLocalNodeStateChanged(nmtStateChange->newNmtState);
 
+	if (nmtStateChange->newNmtState != kNmtGsOff)
+	{
+		QMutexLocker lock(&this->mutex);
+		this->nmtGsOff = false;
+	}
+
+	// The remote nodes are found again after the communication reset.
+	if (nmtStateChange->newNmtState == kNmtGsResetCommunication)
+		this->nodeStateTable.Reset();
+
+	// The PDOs are configured again after the communication reset.
+	if ((nmtStateChange->newNmtState == kNmtGsResetCommunication)
+		|| (nmtStateChange->newNmtState == kNmtGsOff))
+		this->pdoMappingModel.Reset();
+
 	switch (nmtStateChange->newNmtState)
 	{
 		case kNmtGsOff:
@@ -242,14 +431,17 @@ tOplkError OplkEventHandler::ProcessNmtStateChangeEvent(
 
 //			oplk_freeProcessImage(); //jba do we need it here?
 
-			this->TriggerPrintLog(
-				QString("NMTStateChangeEvent(0x%1) originating event = 0x%2 (%3)")
-				 .arg(nmtStateChange->newNmtState, 0, 16, QLatin1Char('0'))
-				 .arg(nmtStateChange->nmtEvent, 0, 16, QLatin1Char('0'))
-				 .arg(debugstr_getNmtEventStr(nmtStateChange->nmtEvent)));
+			if (this->IsLogEnabled(LogRecordType::NMT_SHUTDOWN))
+			{
+				LogRecord record(LogRecordType::NMT_SHUTDOWN);
+				record.AddArg(nmtStateChange->newNmtState);
+				record.AddArg(nmtStateChange->nmtEvent);
+				this->TriggerLogRecord(record);
+			}
 
 			// unblock OplkEventHandler thread
 			this->mutex.lock();
+			this->nmtGsOff = true;
 			this->nmtGsOffCondition.wakeAll();
 			this->mutex.unlock();
 			break;
@@ -273,11 +465,13 @@ tOplkError OplkEventHandler::ProcessNmtStateChangeEvent(
 		case kNmtMsOperational:
 		case kNmtCsStopped:
 		{
-			this->TriggerPrintLog(
-				QString("StateChangeEvent(0x%1) originating event = 0x%2 (%3)")
-				 .arg(nmtStateChange->newNmtState, 4, 16, QLatin1Char('0'))
-				 .arg(nmtStateChange->nmtEvent, 4, 16, QLatin1Char('0'))
-				 .arg(debugstr_getNmtEventStr(nmtStateChange->nmtEvent)));
+			if (this->IsLogEnabled(LogRecordType::NMT_STATE_CHANGE))
+			{
+				LogRecord record(LogRecordType::NMT_STATE_CHANGE);
+				record.AddArg(nmtStateChange->newNmtState);
+				record.AddArg(nmtStateChange->nmtEvent);
+				this->TriggerLogRecord(record);
+			}
 			oplkRet = kErrorOk;
 			break;
 		}
@@ -296,13 +490,14 @@ tOplkError OplkEventHandler::ProcessCriticalErrorEvent(
 {
 	UNUSED_PARAMETER(userArg);
 
-	QString error = QString("Error source = %1 (0x%2) oplkError = %3 (0x%4)")
-			.arg(debugstr_getEventSourceStr(internalError->eventSource))
-			.arg(internalError->eventSource, 2, 16, QLatin1Char('0'))
-			.arg(debugstr_getRetValStr(internalError->oplkError))
-			.arg(internalError->oplkError, 3, 16, QLatin1Char('0'));
+	LogRecord record(LogRecordType::CRITICAL_ERROR);
+	record.AddArg(internalError->eventSource);
+	record.AddArg(internalError->oplkError);
+	if (this->IsLogEnabled(LogRecordType::CRITICAL_ERROR))
+		this->TriggerLogRecord(record);
 
-	this->TriggerPrintLog(error);
+	// Critical errors are rare and reported as text to the application.
+	const QString error = record.GetMessage();
 
 	switch (internalError->eventSource)
 	{
@@ -310,25 +505,36 @@ tOplkError OplkEventHandler::ProcessCriticalErrorEvent(
 		case kEventSourceEventu:
 		{
 			// error occurred within event processing either in kernel or in user part
-			this->TriggerCriticalError(QString("%1, OrgSource: %2(0x%3)")
+			this->TriggerCriticalError(CriticalError(*internalError,
+				   QString("%1, OrgSource: %2(0x%3)")
 				   .arg(error)
 				   .arg(debugstr_getEventSourceStr(internalError->errorArg.eventSource))
-				   .arg(internalError->errorArg.eventSource, 2, 16, QLatin1Char('0')));
-			this->TriggerPrintLog(QString(" OrgSource = %1(0x%2)")
-				.arg(debugstr_getEventSourceStr(internalError->errorArg.eventSource))
-				.arg(internalError->errorArg.eventSource, 2, 16, QLatin1Char('0')));
+				   .arg(internalError->errorArg.eventSource, 2, 16, QLatin1Char('0'))));
+			if (this->IsLogEnabled(LogRecordType::CRITICAL_ERROR_ORG_SOURCE))
+			{
+				LogRecord orgSourceRecord(LogRecordType::CRITICAL_ERROR_ORG_SOURCE);
+				orgSourceRecord.AddArg(internalError->errorArg.eventSource);
+				this->TriggerLogRecord(orgSourceRecord);
+			}
 			break;
 		}
 		case kEventSourceDllk:
+		{
 			// error occurred within the data link layer (e.g. interrupt processing)
 			// the uintArg argument contains the DLL state and the NMT event
-			this->TriggerCriticalError(QString("%1, value: %2")
+			this->TriggerCriticalError(CriticalError(*internalError,
+									   QString("%1, value: %2")
 									   .arg(error)
-									   .arg(internalError->errorArg.uintArg, 0, 16));
+									   .arg(internalError->errorArg.uintArg, 0, 16)));
 
-			this->TriggerPrintLog(QString(" val = %1")
-				.arg(internalError->errorArg.uintArg, 0, 16));
+			if (this->IsLogEnabled(LogRecordType::CRITICAL_ERROR_VALUE))
+			{
+				LogRecord valueRecord(LogRecordType::CRITICAL_ERROR_VALUE);
+				valueRecord.AddArg(internalError->errorArg.uintArg);
+				this->TriggerLogRecord(valueRecord);
+			}
 			break;
+		}
 
 	// other errors are considered as warnings and are ignored as per stack 2.0
 
@@ -346,12 +552,13 @@ tOplkError OplkEventHandler::ProcessWarningEvent(tEventError* internalError,
 
 	UNUSED_PARAMETER(userArg);
 
-	this->TriggerPrintLog(
-		QString("Warning: source = %1 (0x%2) oplkError = %3 (0x%4)")
-		.arg(debugstr_getEventSourceStr(internalError->eventSource))
-		.arg(internalError->eventSource, 2, 16, QLatin1Char('0'))
-		.arg(debugstr_getRetValStr(internalError->oplkError))
-		.arg(internalError->oplkError, 3, 16, QLatin1Char('0')));
+	if (this->IsLogEnabled(LogRecordType::WARNING))
+	{
+		LogRecord record(LogRecordType::WARNING);
+		record.AddArg(internalError->eventSource);
+		record.AddArg(internalError->oplkError);
+		this->TriggerLogRecord(record);
+	}
 
 	// TODO: process internal structure of tEventError to provide appropriate warning messages.
 
@@ -363,18 +570,25 @@ tOplkError OplkEventHandler::ProcessHistoryEvent(tErrHistoryEntry* historyEntry,
 {
 	UNUSED_PARAMETER(userArg);
 
-	this->TriggerPrintLog(
-		QString("HistoryEntry: Type=0x%1 Code=0x%2 (0x%3 %4 %5 %6 %7 %8 %9 %10)")
-		.arg(historyEntry->entryType, 4, 16, QLatin1Char('0'))
-		.arg(historyEntry->errorCode, 4, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[0], 2, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[1], 2, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[2], 2, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[3], 2, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[4], 2, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[5], 2, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[6], 2, 16, QLatin1Char('0'))
-		.arg((WORD)historyEntry->aAddInfo[7], 2, 16, QLatin1Char('0')));
+	// The error history belongs to the local node.
+	ULONG suppressed = 0;
+	const bool logEntry = this->errorStatistics.AddError(0,
+											historyEntry->errorCode,
+											suppressed);
+
+	if (logEntry && this->IsLogEnabled(LogRecordType::HISTORY_ENTRY))
+	{
+		this->TriggerErrorsSuppressed(0, historyEntry->errorCode, suppressed);
+
+		LogRecord record(LogRecordType::HISTORY_ENTRY);
+		record.AddArg(historyEntry->entryType);
+		record.AddArg(historyEntry->errorCode);
+		for (UINT i = 0; i < 8; ++i)
+		{
+			record.AddArg((WORD) historyEntry->aAddInfo[i]);
+		}
+		this->TriggerLogRecord(record);
+	}
 
 	return kErrorOk;
 }
@@ -387,32 +601,70 @@ tOplkError OplkEventHandler::ProcessNodeEvent(tOplkApiEventNode* nodeEvent,
 	switch (nodeEvent->nodeEvent)
 	{
 		case kNmtNodeEventCheckConf:
-			this->TriggerPrintLog(QString("Node Event: (Node=%2, CheckConf)")
-									.arg(nodeEvent->nodeId));
+		{
+			if (this->IsLogEnabled(LogRecordType::NODE_CHECK_CONF))
+			{
+				LogRecord record(LogRecordType::NODE_CHECK_CONF);
+				record.AddArg(nodeEvent->nodeId);
+				this->TriggerLogRecord(record);
+			}
 			break;
+		}
 
 		case kNmtNodeEventUpdateConf:
-			this->TriggerPrintLog(QString("Node Event: (Node=%1, UpdateConf)")
-									.arg(nodeEvent->nodeId));
+		{
+			if (this->IsLogEnabled(LogRecordType::NODE_UPDATE_CONF))
+			{
+				LogRecord record(LogRecordType::NODE_UPDATE_CONF);
+				record.AddArg(nodeEvent->nodeId);
+				this->TriggerLogRecord(record);
+			}
 			break;
+		}
 
 		case kNmtNodeEventFound:
 			this->TriggerNodeFound(nodeEvent->nodeId);
+			this->nodeStateTable.SetFound(nodeEvent->nodeId);
+			this->nodeEventBatcher.AddNodeFound(nodeEvent->nodeId);
 			break;
 
 		case kNmtNodeEventNmtState:
+		{
 			this->TriggerNodeStateChanged(nodeEvent->nodeId, nodeEvent->nmtState);
-			this->TriggerPrintLog(QString("Node Event: (Node=%1, State: %2)")
-							.arg(nodeEvent->nodeId)
-							.arg(debugstr_getNmtStateStr(nodeEvent->nmtState)));
+			this->nodeStateTable.SetNmtState(nodeEvent->nodeId, nodeEvent->nmtState);
+			this->nodeEventBatcher.AddNodeStateChanged(nodeEvent->nodeId,
+													   nodeEvent->nmtState);
+			if (this->IsLogEnabled(LogRecordType::NODE_STATE))
+			{
+				LogRecord record(LogRecordType::NODE_STATE);
+				record.AddArg(nodeEvent->nodeId);
+				record.AddArg(nodeEvent->nmtState);
+				this->TriggerLogRecord(record);
+			}
 			break;
+		}
 
 		case kNmtNodeEventError:
-			this->TriggerPrintLog(QString("AppCbEvent (Node=%1): Error = %2 (0x%3)")
-						.arg(nodeEvent->nodeId)
-						.arg(debugstr_getEmergErrCodeStr(nodeEvent->errorCode))
-						.arg(nodeEvent->errorCode, 4, 16, QLatin1Char('0')));
+		{
+			this->nodeStateTable.AddError(nodeEvent->nodeId, nodeEvent->errorCode);
+
+			ULONG suppressed = 0;
+			const bool logError = this->errorStatistics.AddError(nodeEvent->nodeId,
+														nodeEvent->errorCode,
+														suppressed);
+			if (logError && this->IsLogEnabled(LogRecordType::NODE_ERROR))
+			{
+				this->TriggerErrorsSuppressed(nodeEvent->nodeId,
+											nodeEvent->errorCode,
+											suppressed);
+
+				LogRecord record(LogRecordType::NODE_ERROR);
+				record.AddArg(nodeEvent->nodeId);
+				record.AddArg(nodeEvent->errorCode);
+				this->TriggerLogRecord(record);
+			}
 			break;
+		}
 
 		default:
 			qDebug("%s  Default case", __FUNCTION__);
@@ -436,16 +688,45 @@ tOplkError OplkEventHandler::ProcessSdoEvent(tSdoComFinished* sdoEvent,
 		case kSdoComTransferFinished:
 		case kSdoComTransferLowerLayerAbort:
 		{
+			if ((sdoEvent->sdoComConState == kSdoComTransferFinished)
+				&& this->IsLogEnabled(LogRecordType::SDO_TRANSFER_FINISHED))
+			{
+				LogRecord record(LogRecordType::SDO_TRANSFER_FINISHED);
+				record.AddArg(sdoEvent->nodeId);
+				record.AddArg(sdoEvent->targetIndex);
+				record.AddArg(sdoEvent->targetSubIndex);
+				record.AddArg(sdoEvent->transferredBytes);
+				this->TriggerLogRecord(record);
+			}
+			else if ((sdoEvent->sdoComConState != kSdoComTransferFinished)
+				&& this->IsLogEnabled(LogRecordType::SDO_TRANSFER_ABORTED))
+			{
+				LogRecord record(LogRecordType::SDO_TRANSFER_ABORTED);
+				record.AddArg(sdoEvent->nodeId);
+				record.AddArg(sdoEvent->targetIndex);
+				record.AddArg(sdoEvent->targetSubIndex);
+				record.AddArg(sdoEvent->abortCode);
+				record.AddArg(sdoEvent->sdoComConState);
+				this->TriggerLogRecord(record);
+			}
+
 			this->TriggerSdoTransferFinished(*sdoEvent,
-						(const ReceiverContext*)sdoEvent->pUserArg);
+						(ReceiverContext*)sdoEvent->pUserArg);
 			oplkRet = kErrorOk;
 			break;
 		}
 
-		case kSdoComTransferNotActive:
 		case kSdoComTransferRunning:
 		{
 			//Segmented transfer
+			this->TriggerSdoTransferProgress(*sdoEvent,
+						(const ReceiverContext*)sdoEvent->pUserArg);
+			oplkRet = kErrorOk;
+			break;
+		}
+
+		case kSdoComTransferNotActive:
+		{
 			oplkRet = kErrorOk;
 			break;
 		}
@@ -463,19 +744,26 @@ tOplkError OplkEventHandler::ProcessCfmProgressEvent(
 {
 	UNUSED_PARAMETER(userArg);
 
-	this->TriggerPrintLog(
-			QString("CFM Progress: (Node=%1, CFM-Progress: Object 0x%2/%3,  %4/%5 Bytes")
-			.arg(cfmProgress->nodeId)
-			.arg(cfmProgress->objectIndex, 4, 16, QLatin1Char('0'))
-			.arg(cfmProgress->objectSubIndex)
-			.arg((ULONG)cfmProgress->bytesDownloaded)
-			.arg((ULONG)cfmProgress->totalNumberOfBytes));
+	if (this->IsLogEnabled(LogRecordType::CFM_PROGRESS))
+	{
+		LogRecord record(LogRecordType::CFM_PROGRESS);
+		record.AddArg(cfmProgress->nodeId);
+		record.AddArg(cfmProgress->objectIndex);
+		record.AddArg(cfmProgress->objectSubIndex);
+		record.AddArg(cfmProgress->bytesDownloaded);
+		record.AddArg(cfmProgress->totalNumberOfBytes);
+		this->TriggerLogRecord(record);
+	}
 
 	if ((cfmProgress->sdoAbortCode != 0) || (cfmProgress->error != kErrorOk))
 	{
-		 this->TriggerPrintLog(QString("	-> SDO Abort=0x%1, Error=0x%2)")
-			.arg((ULONG) cfmProgress->sdoAbortCode, 0, 16, QLatin1Char('0'))
-			.arg(cfmProgress->error, 0, 16, QLatin1Char('0')));
+		if (this->IsLogEnabled(LogRecordType::CFM_PROGRESS_ERROR))
+		{
+			LogRecord errorRecord(LogRecordType::CFM_PROGRESS_ERROR);
+			errorRecord.AddArg(cfmProgress->sdoAbortCode);
+			errorRecord.AddArg(cfmProgress->error);
+			this->TriggerLogRecord(errorRecord);
+		}
 	}
 
 	return kErrorOk;
@@ -487,45 +775,12 @@ tOplkError OplkEventHandler::ProcessCfmResultEvent(
 {
 	UNUSED_PARAMETER(userArg);
 
-	switch (cfmResult->nodeCommand)
+	if (this->IsLogEnabled(LogRecordType::CFM_RESULT))
 	{
-		case kNmtNodeCommandConfOk:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, ConfOk)")
-								.arg(cfmResult->nodeId));
-			break;
-		case kNmtNodeCommandConfErr:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, ConfErr)")
-								.arg(cfmResult->nodeId));
-			break;
-		case kNmtNodeCommandConfReset:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, ConfReset)")
-								.arg(cfmResult->nodeId));
-			break;
-		case kNmtNodeCommandConfRestored:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, ConfRestored)")
-								.arg(cfmResult->nodeId));
-			break;
-		case kNmtNodeCommandBoot:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, BootCommand)")
-								.arg(cfmResult->nodeId));
-			break;
-		case kNmtNodeCommandSwOk:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, Sw-Ok)")
-								.arg(cfmResult->nodeId));
-			break;
-		case kNmtNodeCommandSwUpdated:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, Sw-Updated)")
-								.arg(cfmResult->nodeId));
-			break;
-		case kNmtNodeCommandStart:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%1, NodeStart)")
-								.arg(cfmResult->nodeId));
-			break;
-		default:
-			this->TriggerPrintLog(QString("CFM Result: (Node=%d, CfmResult=0x%X)")
-								.arg(cfmResult->nodeId)
-						.arg(cfmResult->nodeCommand, 4, 16, QLatin1Char('0')));
-			break;
+		LogRecord record(LogRecordType::CFM_RESULT);
+		record.AddArg(cfmResult->nodeId);
+		record.AddArg(cfmResult->nodeCommand);
+		this->TriggerLogRecord(record);
 	}
 
 	return kErrorOk;
@@ -536,35 +791,23 @@ tOplkError OplkEventHandler::ProcessPdoChangeEvent(tOplkApiEventPdoChange* pdoCh
 {
 	UNUSED_PARAMETER(userArg);
 
-	this->TriggerPrintLog(
-		QString("PDO change event: (%1PDO = 0x%2 to node 0x%3 with %4 objects %5)")
-				.arg(pdoChange->fTx ? "T" : "R")
-				.arg(pdoChange->mappParamIndex, 4, 16, QLatin1Char('0'))
-				.arg(pdoChange->nodeId, 2, 16, QLatin1Char('0'))
-				.arg(pdoChange->mappObjectCount)
-				.arg(pdoChange->fActivated ? "activated" : "deleted"));
-
-	UINT64 mappObject;
-	UINT varLen = sizeof(mappObject);
-	tOplkError oplkRet = kErrorGeneralError;
-
-	for (UINT subIndex = 1; subIndex <= pdoChange->mappObjectCount; ++subIndex)
+	if (this->IsLogEnabled(LogRecordType::PDO_CHANGE))
 	{
-		oplkRet = oplk_readLocalObject(pdoChange->mappParamIndex, subIndex, &mappObject, &varLen);
-		if (oplkRet != kErrorOk)
-		{
-			this->TriggerPrintLog(QString("  Reading 0x%1/%2 failed with 0x%3")
-						.arg(pdoChange->mappParamIndex, 4, 16, QLatin1Char('0'))
-						.arg(subIndex)
-						.arg(oplkRet, 4, 16, QLatin1Char('0')));
-			continue;
-		}
-
-		this->TriggerPrintLog(QString("  %1. mapped object 0x%2/%3")
-					.arg(subIndex)
-					.arg(mappObject & 0x00FFFFULL, 4, 16, QLatin1Char('0'))
-					.arg((mappObject & 0xFF0000ULL) >> 16, 4, 16, QLatin1Char('0')));
+		LogRecord record(LogRecordType::PDO_CHANGE);
+		record.AddArg(pdoChange->fTx ? 1 : 0);
+		record.AddArg(pdoChange->mappParamIndex);
+		record.AddArg(pdoChange->nodeId);
+		record.AddArg(pdoChange->mappObjectCount);
+		record.AddArg(pdoChange->fActivated ? 1 : 0);
+		this->TriggerLogRecord(record);
 	}
 
+	// The mapping is read by the model outside of the event callback.
+	// A replayed mapping cannot be read from the object dictionary.
+	if (this->replaying.loadAcquire() == 0)
+		this->pdoMappingModel.AddPdoChange(*pdoChange);
+
+	this->TriggerPdoChanged(pdoChange->nodeId);
+
 	return kErrorOk;
 }
@@ -41,6 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "api/OplkQtApi.h"
 #include "api/OplkEventHandler.h"
 #include "api/OplkSyncEventHandler.h"
+#include "api/ObjectDictionaryCache.h"
+#include "api/SdoScheduler.h"
+#include "api/SdoTransferPool.h"
+#include "api/ShutdownSequencer.h"
+#include "api/LocalObjectDictionary.h"
 
 /*******************************************************************************
 * Module global variables
@@ -58,6 +63,8 @@ static const std::string kDefaultCdcFilename = CONFIG_OBD_DEF_CONCISEDCF_FILENAM
 *******************************************************************************/
 tOplkApiInitParam OplkQtApi::initParam; ///< initparam.
 bool OplkQtApi::cdcSet = false;  ///< Flag to detect CDC has been set or not.
+UINT OplkQtApi::allocatedInSize = 0;  ///< Size of the allocated input ProcessImage.
+UINT OplkQtApi::allocatedOutSize = 0; ///< Size of the allocated output ProcessImage.
 
 /*******************************************************************************
 * Private functions
@@ -131,6 +138,12 @@ void OplkQtApi::SetInitParam()
 //	OplkQtApi::initParam.aVendorSpecificExt2[48] = 0;
 }
 
+bool OplkQtApi::IsLocalTransfer(const SdoTransferJob& sdoTransferJob)
+{
+	return ((sdoTransferJob.GetNodeId() == OplkQtApi::initParam.nodeId)
+			|| (sdoTransferJob.GetNodeId() == 0));
+}
+
 /*******************************************************************************
 * Public functions
 *******************************************************************************/
@@ -144,7 +157,19 @@ tOplkError OplkQtApi::InitStack(const UINT nodeId,
 
 	OplkQtApi::initParam.hwParam.pDevName = networkInterface.c_str();
 
-	return (oplk_init(&OplkQtApi::initParam));
+	if (!OplkEventHandler::GetInstance().SetStackInitialised(true))
+	{
+		qDebug("InitStack: An event journal is being replayed");
+		return kErrorInvalidOperation;
+	}
+
+	tOplkError oplkRet = oplk_init(&OplkQtApi::initParam);
+	if (oplkRet != kErrorOk)
+	{
+		OplkEventHandler::GetInstance().SetStackInitialised(false);
+	}
+
+	return oplkRet;
 }
 
 tOplkError OplkQtApi::StartStack()
@@ -175,11 +200,14 @@ tOplkError OplkQtApi::StartStack()
 	OplkEventHandler::GetInstance().start();
 
 	// Start the OPLK stack by sending NMT s/w reset
+	OplkEventHandler::GetInstance().ClearNmtGsOff();
 	oplkRet = oplk_execNmtCommand(kNmtEventSwReset);
 	if (oplkRet != kErrorOk)
 		qDebug("kNmtEventSwReset Ret: %d", oplkRet);
 
 #if !defined(CONFIG_KERNELSTACK_DIRECTLINK)
+	// The exchange has been paused by the last shutdown.
+	OplkSyncEventHandler::GetInstance().SetPaused(false);
 	OplkSyncEventHandler::GetInstance().start();
 #endif
 
@@ -188,28 +216,54 @@ tOplkError OplkQtApi::StartStack()
 
 tOplkError OplkQtApi::StopStack()
 {
-	tOplkError oplkRet = kErrorGeneralError;
+	ShutdownSequencer shutdown;
+	const tOplkError oplkRet = shutdown.Run();
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("Shutdown phase '%s' failed. Ret: %d",
+			ShutdownPhase::GetShutdownPhaseString(shutdown.GetFailedPhase()).c_str(),
+			oplkRet);
+	}
 
-	// cdcSet should be set to false.
-	OplkQtApi::cdcSet = false;
+	return oplkRet;
+}
+
+tOplkError OplkQtApi::RestartStack()
+{
+	// The stack instance, the CDC, the ProcessImage and the threads are kept.
+	SdoScheduler::GetInstance().Clear();
 
-	oplkRet = oplk_execNmtCommand(kNmtEventSwitchOff);
+	OplkEventHandler::GetInstance().ClearNmtGsOff();
+	tOplkError oplkRet = oplk_execNmtCommand(kNmtEventSwReset);
 	if (oplkRet != kErrorOk)
 	{
-		qDebug("kNmtEventSwitchOff Ret: %d", oplkRet);
+		qDebug("kNmtEventSwReset Ret: %d", oplkRet);
 		return oplkRet;
 	}
 
-	OplkEventHandler::GetInstance().AwaitNmtGsOff();
+#if !defined(CONFIG_KERNELSTACK_DIRECTLINK)
+	// Restarts the sync thread if it has stopped on an error.
+	OplkSyncEventHandler::GetInstance().SetPaused(false);
+	OplkSyncEventHandler::GetInstance().start();
+#endif
 
-	OplkSyncEventHandler::GetInstance().requestInterruption();
+	return oplkRet;
+}
 
-	// TODO Set ProcessImage::data to NULL;
-	oplkRet = oplk_freeProcessImage();
-	if (oplkRet != kErrorOk)
+tOplkError OplkQtApi::ShutdownStack()
+{
+	tOplkError oplkRet = kErrorOk;
+
+	OplkQtApi::cdcSet = false;
+
+	if ((OplkQtApi::allocatedInSize != 0) || (OplkQtApi::allocatedOutSize != 0))
 	{
-		qDebug("freeProcessImage Ret: %d", oplkRet);
-		return oplkRet;
+		oplkRet = oplk_freeProcessImage();
+		if (oplkRet != kErrorOk)
+			qDebug("freeProcessImage Ret: %d", oplkRet);
+
+		OplkQtApi::allocatedInSize = 0;
+		OplkQtApi::allocatedOutSize = 0;
 	}
 
 	oplkRet = oplk_shutdown();
@@ -217,6 +271,109 @@ tOplkError OplkQtApi::StopStack()
 	{
 		qDebug("shutdown Ret: %d", oplkRet);
 	}
+	OplkEventHandler::GetInstance().SetStackInitialised(false);
+
+	// The results of the pending transfers will never be reported.
+	SdoTransferPool::GetInstance().ReleaseAll();
+
+	return oplkRet;
+}
+
+tOplkError OplkQtApi::ReloadConfiguration(const std::string& cdcFileName,
+						ProcessImageIn& in,
+						ProcessImageOut& out,
+						ReloadOutcome::ReloadOutcome& outcome)
+{
+	tOplkError oplkRet = kErrorGeneralError;
+	const bool reallocate = ((in.GetSize() != OplkQtApi::allocatedInSize)
+							|| (out.GetSize() != OplkQtApi::allocatedOutSize));
+
+	outcome = ReloadOutcome::UNCHANGED;
+
+	// Hold the ProcessImage exchange until the new configuration is active.
+	OplkSyncEventHandler::GetInstance().SetPaused(true);
+
+	if (reallocate)
+	{
+		// The ProcessImage is linked to the object dictionary.
+		// It can only be exchanged while the local node is switched off.
+		oplkRet = oplk_execNmtCommand(kNmtEventSwitchOff);
+		if (oplkRet != kErrorOk)
+		{
+			qDebug("kNmtEventSwitchOff Ret: %d", oplkRet);
+			OplkSyncEventHandler::GetInstance().SetPaused(false);
+			return oplkRet;
+		}
+
+		if (!OplkEventHandler::GetInstance().AwaitNmtGsOff(
+				ShutdownSequencer::kDefaultSwitchOffDeadline))
+		{
+			qDebug("NMT_GS_OFF not reached within %lu ms",
+				(ULONG) ShutdownSequencer::kDefaultSwitchOffDeadline);
+			OplkSyncEventHandler::GetInstance().SetPaused(false);
+			return kErrorGeneralError;
+		}
+
+		// The old ProcessImage is released from here on. Any failure shuts down the stack.
+		oplkRet = oplk_freeProcessImage();
+		if (oplkRet == kErrorOk)
+		{
+			OplkQtApi::allocatedInSize = 0;
+			OplkQtApi::allocatedOutSize = 0;
+			oplkRet = OplkQtApi::AllocateProcessImage(in, out);
+		}
+
+		if (oplkRet != kErrorOk)
+		{
+			qDebug("Reallocate ProcessImage Ret: %d", oplkRet);
+		}
+		else
+		{
+			outcome = ReloadOutcome::REALLOCATED;
+		}
+	}
+	else
+	{
+		// Same ProcessImage memory, only the channel table has changed.
+		in.SetProcessImageDataPtr((const BYTE*)oplk_getProcessImageIn());
+		out.SetProcessImageDataPtr((const BYTE*)oplk_getProcessImageOut());
+		oplkRet = kErrorOk;
+	}
+
+	if (oplkRet == kErrorOk)
+	{
+		oplkRet = OplkQtApi::SetCdc(cdcFileName);
+		if (oplkRet != kErrorOk)
+		{
+			qDebug("Set CDC File. Ret: %d", oplkRet);
+		}
+		else
+		{
+			// The CDC is reloaded while passing through NMT_GS_RESET_CONFIGURATION.
+			if (reallocate)
+			{
+				OplkEventHandler::GetInstance().ClearNmtGsOff();
+			}
+			oplkRet = oplk_execNmtCommand(reallocate ? kNmtEventSwReset : kNmtEventResetConfig);
+			if (oplkRet != kErrorOk)
+				qDebug("Reload configuration NMT event Ret: %d", oplkRet);
+		}
+	}
+
+	if ((oplkRet != kErrorOk) && reallocate)
+	{
+		// The sync thread stays paused until the sequencer has stopped it.
+		ShutdownSequencer shutdown;
+		if (shutdown.Run() != kErrorOk)
+		{
+			qDebug("Shutdown phase '%s' failed",
+				ShutdownPhase::GetShutdownPhaseString(shutdown.GetFailedPhase()).c_str());
+		}
+		outcome = ReloadOutcome::SHUT_DOWN;
+		return oplkRet;
+	}
+
+	OplkSyncEventHandler::GetInstance().SetPaused(false);
 
 	return oplkRet;
 }
@@ -285,6 +442,86 @@ bool OplkQtApi::UnregisterLocalNodeStateChangedEventHandler(
 		receiverFunction);
 }
 
+NodeState OplkQtApi::GetNodeState(const UINT nodeId)
+{
+	return OplkEventHandler::GetInstance().nodeStateTable.GetNodeState(nodeId);
+}
+
+QVector<NodeState> OplkQtApi::SnapshotNodes()
+{
+	return OplkEventHandler::GetInstance().nodeStateTable.SnapshotNodes();
+}
+
+UINT OplkQtApi::GetNodeStateGeneration()
+{
+	return OplkEventHandler::GetInstance().nodeStateTable.GetGeneration();
+}
+
+std::vector<ErrorStatisticsEntry> OplkQtApi::GetErrorStatistics()
+{
+	return OplkEventHandler::GetInstance().errorStatistics.GetEntries();
+}
+
+std::vector<ErrorStatisticsEntry> OplkQtApi::GetErrorStatistics(const UINT nodeId)
+{
+	return OplkEventHandler::GetInstance().errorStatistics.GetEntries(nodeId);
+}
+
+std::vector<ErrorStatisticsEntry> OplkQtApi::GetTopErrorOffenders(const UINT count)
+{
+	return OplkEventHandler::GetInstance().errorStatistics.GetTopOffenders(count);
+}
+
+ULONG OplkQtApi::GetErrorStatisticsOverflowCount()
+{
+	return OplkEventHandler::GetInstance().errorStatistics.GetOverflowCount();
+}
+
+void OplkQtApi::ResetErrorStatistics()
+{
+	OplkEventHandler::GetInstance().errorStatistics.Reset();
+}
+
+void OplkQtApi::EnableNodeEventBatching(const UINT window, const UINT maxCount)
+{
+	OplkEventHandler::GetInstance().nodeEventBatcher.Enable(window, maxCount);
+}
+
+void OplkQtApi::DisableNodeEventBatching()
+{
+	OplkEventHandler::GetInstance().nodeEventBatcher.Disable();
+}
+
+bool OplkQtApi::RegisterNodeEventBatchHandler(const QObject& receiver,
+					const QMetaMethod& receiverFunction)
+{
+	return QObject::connect(&OplkEventHandler::GetInstance().nodeEventBatcher,
+		QMetaMethod::fromSignal(&NodeEventBatcher::SignalNodeEvents),
+		&receiver,
+		receiverFunction,
+		(Qt::ConnectionType) (Qt::QueuedConnection | Qt::UniqueConnection));
+}
+
+bool OplkQtApi::UnregisterNodeEventBatchHandler(const QObject& receiver,
+					const QMetaMethod& receiverFunction)
+{
+	return QObject::disconnect(&OplkEventHandler::GetInstance().nodeEventBatcher,
+		QMetaMethod::fromSignal(&NodeEventBatcher::SignalNodeEvents),
+		&receiver,
+		receiverFunction);
+}
+
+bool OplkQtApi::StartEventJournal(const QString& fileName)
+{
+	return OplkEventHandler::GetInstance().journalWriter.Open(fileName);
+}
+
+ULONG OplkQtApi::StopEventJournal()
+{
+	OplkEventHandler::GetInstance().journalWriter.Close();
+	return OplkEventHandler::GetInstance().journalWriter.GetDroppedEvents();
+}
+
 bool OplkQtApi::RegisterEventLogger(const QObject& receiver,
 					const QMetaMethod& receiverFunction)
 {
@@ -304,6 +541,36 @@ bool OplkQtApi::UnregisterEventLogger(const QObject& receiver,
 		receiverFunction);
 }
 
+bool OplkQtApi::RegisterLogRecordHandler(const QObject& receiver,
+					const QMetaMethod& receiverFunction)
+{
+	return QObject::connect(&OplkEventHandler::GetInstance(),
+		QMetaMethod::fromSignal(&OplkEventHandler::SignalLogRecord),
+		&receiver,
+		receiverFunction,
+		(Qt::ConnectionType) (Qt::QueuedConnection | Qt::UniqueConnection));
+}
+
+bool OplkQtApi::UnregisterLogRecordHandler(const QObject& receiver,
+					const QMetaMethod& receiverFunction)
+{
+	return QObject::disconnect(&OplkEventHandler::GetInstance(),
+		QMetaMethod::fromSignal(&OplkEventHandler::SignalLogRecord),
+		&receiver,
+		receiverFunction);
+}
+
+void OplkQtApi::SetLogLevel(const LogCategory::LogCategory category,
+					const LogSeverity::LogSeverity minimum)
+{
+	OplkEventHandler::GetInstance().SetLogLevel(category, minimum);
+}
+
+LogSeverity::LogSeverity OplkQtApi::GetLogLevel(const LogCategory::LogCategory category)
+{
+	return OplkEventHandler::GetInstance().GetLogLevel(category);
+}
+
 bool OplkQtApi::RegisterSyncEventHandler(Direction::Direction direction,
 										const QObject& receiver,
 										const QMetaMethod& receiverFunction)
@@ -391,16 +658,15 @@ tOplkError OplkQtApi::ExecuteNmtCommand(UINT nodeId,
 	else
 	{
 		tOplkError ret = kErrorOk;
-		BOOL releaseCmd = TRUE;
 
-		ret = oplk_writeLocalObject(0x1F9F, 0x03, &nodeId, 0x01);
+		ret = LocalObjectDictionary::WriteLocal(0x1F9F, 0x03, (UINT8) nodeId);
 		if (ret != kErrorOk)
 		{
 			qDebug("%s() Error: 1F9F/03 : %x\n", __func__, ret);
 			return ret;
 		}
 
-		ret = oplk_writeLocalObject(0x1F9F, 0x02, &nmtCommand, 0x01);
+		ret = LocalObjectDictionary::WriteLocal(0x1F9F, 0x02, (UINT8) nmtCommand);
 		if (ret != kErrorOk)
 		{
 			qDebug("%s() Error: 1F9F/02 : %x\n", __func__, ret);
@@ -414,7 +680,7 @@ tOplkError OplkQtApi::ExecuteNmtCommand(UINT nodeId,
 		//   return ret;
 		//}
 
-		return oplk_writeLocalObject(0x1F9F, 0x01, &releaseCmd, 0x01);
+		return LocalObjectDictionary::WriteLocal(0x1F9F, 0x01, (UINT8) TRUE);
 	}
 }
 
@@ -422,39 +688,68 @@ tOplkError OplkQtApi::TransferObject(const SdoTransferJob& sdoTransferJob,
 						const QObject& receiver,
 						const QMetaMethod& receiverFunction)
 {
-	ReceiverContext *receiverContext = NULL;
-
 	/* qRegisterMetaType<T>() is only required for sending the object
 	 * through queued signal/slot connections.
 	 */
 	qRegisterMetaType<SdoTransferResult>("SdoTransferResult");
 
-	if ( ((sdoTransferJob.GetNodeId() != initParam.nodeId)
-		 && (sdoTransferJob.GetNodeId() != 0)) )
+	ReceiverContext* receiverContext = NULL;
+	if (!OplkQtApi::IsLocalTransfer(sdoTransferJob))
 	{
-		receiverContext = new ReceiverContext(&receiver, &receiverFunction);
-		bool conSuccess = false;
-		// Non-Local OD access
-		qDebug("Remote OD access, connecting signal.");
-		conSuccess = QObject::connect(&OplkEventHandler::GetInstance(),
-					QMetaMethod::fromSignal(&OplkEventHandler::SignalSdoTransferFinished),
-					&receiver,
-					receiverFunction,
-					(Qt::ConnectionType) (Qt::QueuedConnection | Qt::UniqueConnection));
-		if (!conSuccess)
+		receiverContext = SdoTransferPool::GetInstance().Acquire();
+		if (receiverContext == NULL)
+			return kErrorNoResource;
+
+		if (!receiverContext->SetReceiver(&receiver, receiverFunction))
 		{
-			qDebug("Connection failed !");
+			qDebug("TransferObject: Invalid receiver function");
+			SdoTransferPool::GetInstance().Release(receiverContext);
 			return kErrorApiInvalidParam;
 		}
-		qDebug("Connection success");
 	}
-	else
+
+	return OplkQtApi::TransferObject(sdoTransferJob, receiverContext, NULL);
+}
+
+tOplkError OplkQtApi::TransferObject(const SdoTransferJob& sdoTransferJob,
+						SdoTransferCallback* callback,
+						tSdoComConHdl* sdoComConHdl)
+{
+	if (OplkQtApi::IsLocalTransfer(sdoTransferJob))
+	{
+		// Local OD access finishes immediately, nothing to be reported.
+		delete callback;
+		return OplkQtApi::TransferObject(sdoTransferJob, (ReceiverContext*) NULL, sdoComConHdl);
+	}
+
+	ReceiverContext* receiverContext = SdoTransferPool::GetInstance().Acquire();
+	if (receiverContext == NULL)
+	{
+		delete callback;
+		return kErrorNoResource;
+	}
+
+	receiverContext->SetCallback(callback);
+	return OplkQtApi::TransferObject(sdoTransferJob, receiverContext, sdoComConHdl);
+}
+
+tOplkError OplkQtApi::TransferObject(const SdoTransferJob& sdoTransferJob,
+						ReceiverContext* receiverContext,
+						tSdoComConHdl* sdoComConHdl)
+{
+	// The handle is written before the transfer is started, so it is valid
+	// even if the transfer finishes before the function returns.
+	tSdoComConHdl localSdoComConHdl = 0;
+	if (sdoComConHdl == NULL)
+	{
+		sdoComConHdl = &localSdoComConHdl;
+	}
+
+	if (receiverContext != NULL)
 	{
-		//Local OD access
-		qDebug("Local OD access, not connecting signal.");
+		receiverContext->Start(sdoTransferJob.GetSdoType());
 	}
 
-	tSdoComConHdl *sdoComConHdl = new tSdoComConHdl;
 	tOplkError oplkRet = kErrorGeneralError;
 	UINT dataSize =  sdoTransferJob.GetDataSize();
 	switch (sdoTransferJob.GetSdoAccessType())
@@ -490,28 +785,10 @@ tOplkError OplkQtApi::TransferObject(const SdoTransferJob& sdoTransferJob,
 	}
 
 	if ((oplkRet != kErrorApiTaskDeferred)
-		&& ((sdoTransferJob.GetNodeId() != initParam.nodeId)
-		&& (sdoTransferJob.GetNodeId() != 0)))
+		&& (receiverContext != NULL))
 	{
-		// Non-Local OD access: error case
-
-		// Delete the receiver context.
-		delete receiverContext;
-		delete sdoComConHdl;
-
-		qDebug("Remote OD access, disconnecting signal.");
-		bool disconnected = QObject::disconnect(&OplkEventHandler::GetInstance(),
-					QMetaMethod::fromSignal(&OplkEventHandler::SignalSdoTransferFinished),
-					&receiver,
-					receiverFunction);
-
-		if (!disconnected)
-		{
-			// This is not supposed to happen.
-			qDebug("Disconnect failed !");
-			return kErrorApiInvalidParam;
-		}
-		qDebug("Disconnected success");
+		// Non-Local OD access: error case. No result will be reported.
+		SdoTransferPool::GetInstance().Release(receiverContext);
 	}
 
 	return oplkRet;
@@ -529,6 +806,8 @@ tOplkError OplkQtApi::AllocateProcessImage(ProcessImageIn& in,
 		qDebug("allocProcessImage retCode %x", oplkRet);
 		return oplkRet;
 	}
+	OplkQtApi::allocatedInSize = in.GetSize();
+	OplkQtApi::allocatedOutSize = out.GetSize();
 
 	/* sets the ProcessImage pointer from the allocated memory to the ProcessImage::data */
 	in.SetProcessImageDataPtr((const BYTE*)oplk_getProcessImageIn());
@@ -559,7 +838,9 @@ tOplkError OplkQtApi::SetCdc(const std::string& cdcFileName)
 
 tOplkError OplkQtApi::SetCycleTime(const ULONG cycleTime)
 {
-	return (oplk_writeLocalObject(0x1006, 0x00, (void*)&cycleTime, 4));
+	tOplkError oplkRet = LocalObjectDictionary::WriteLocal(0x1006, 0x00, (UINT32) cycleTime);
+	ObjectDictionaryCache::GetInstance().Invalidate(0, 0x1006, 0x00);
+	return oplkRet;
 	// If this is a demo CN. It has to do remote SDO write?.
 }
 
@@ -610,3 +891,92 @@ bool OplkQtApi::UnregisterCriticalErrorEventHandler(const QObject &receiver,
 			&receiver,
 			receiverFunction);
 }
+
+bool OplkQtApi::RegisterCriticalErrorOccurredEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::connect(&OplkEventHandler::GetInstance(),
+			QMetaMethod::fromSignal(&OplkEventHandler::SignalCriticalErrorOccurred),
+			&receiver,
+			receiverFunction,
+			(Qt::ConnectionType) (Qt::QueuedConnection | Qt::UniqueConnection));
+}
+
+bool OplkQtApi::UnregisterCriticalErrorOccurredEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::disconnect(&OplkEventHandler::GetInstance(),
+			QMetaMethod::fromSignal(&OplkEventHandler::SignalCriticalErrorOccurred),
+			&receiver,
+			receiverFunction);
+}
+
+bool OplkQtApi::RegisterPdoChangedEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::connect(&OplkEventHandler::GetInstance(),
+			QMetaMethod::fromSignal(&OplkEventHandler::SignalPdoChanged),
+			&receiver,
+			receiverFunction,
+			(Qt::ConnectionType) (Qt::QueuedConnection | Qt::UniqueConnection));
+}
+
+bool OplkQtApi::UnregisterPdoChangedEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::disconnect(&OplkEventHandler::GetInstance(),
+			QMetaMethod::fromSignal(&OplkEventHandler::SignalPdoChanged),
+			&receiver,
+			receiverFunction);
+}
+
+std::vector<PdoMapping> OplkQtApi::GetPdoMappings(const UINT nodeId,
+										const Direction::Direction direction)
+{
+	return OplkEventHandler::GetInstance().pdoMappingModel.GetPdoMappings(nodeId,
+																direction);
+}
+
+std::vector<PdoChannelLocation> OplkQtApi::GetPdoChannelLocations(
+										const ProcessImage& processImage)
+{
+	return OplkEventHandler::GetInstance().pdoMappingModel.EstimateChannelLocations(processImage);
+}
+
+bool OplkQtApi::RegisterPdoMappingChangedEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::connect(&OplkEventHandler::GetInstance().pdoMappingModel,
+			QMetaMethod::fromSignal(&PdoMappingModel::SignalPdoMappingChanged),
+			&receiver,
+			receiverFunction,
+			(Qt::ConnectionType) (Qt::QueuedConnection | Qt::UniqueConnection));
+}
+
+bool OplkQtApi::UnregisterPdoMappingChangedEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::disconnect(&OplkEventHandler::GetInstance().pdoMappingModel,
+			QMetaMethod::fromSignal(&PdoMappingModel::SignalPdoMappingChanged),
+			&receiver,
+			receiverFunction);
+}
+
+bool OplkQtApi::RegisterSdoTransferRetryEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::connect(&SdoScheduler::GetInstance(),
+			QMetaMethod::fromSignal(&SdoScheduler::SignalSdoTransferRetry),
+			&receiver,
+			receiverFunction,
+			(Qt::ConnectionType) (Qt::QueuedConnection | Qt::UniqueConnection));
+}
+
+bool OplkQtApi::UnregisterSdoTransferRetryEventHandler(const QObject &receiver,
+										const QMetaMethod &receiverFunction)
+{
+	return QObject::disconnect(&SdoScheduler::GetInstance(),
+			QMetaMethod::fromSignal(&SdoScheduler::SignalSdoTransferRetry),
+			&receiver,
+			receiverFunction);
+}
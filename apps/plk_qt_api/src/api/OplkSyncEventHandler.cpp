@@ -40,6 +40,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 * INCLUDES
 *******************************************************************************/
 #include "api/OplkSyncEventHandler.h"
+#include "api/SignalLatencyMonitor.h"
 #include <oplk/oplk.h>
 
 /*******************************************************************************
@@ -66,7 +67,9 @@ void OplkSyncEventHandler::run()
 * Private functions
 *******************************************************************************/
 OplkSyncEventHandler::OplkSyncEventHandler() :
-	sleepTime(4)
+	sleepTime(4),
+	paused(false),
+	exchangeMutex()
 {
 }
 
@@ -98,6 +101,10 @@ tOplkError OplkSyncEventHandler::ProcessSyncEvent()
 		return oplkRet;
 	}
 
+	QMutexLocker locker(&this->exchangeMutex);
+	if (this->paused)
+		return kErrorOk;
+
 	oplkRet = oplk_exchangeProcessImageOut();
 	if (oplkRet != kErrorOk)
 	{
@@ -106,10 +113,12 @@ tOplkError OplkSyncEventHandler::ProcessSyncEvent()
 	}
 
 	emit SignalUpdatedOutputValues();
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::UPDATED_OUTPUT_VALUES);
 
 	QThread::msleep(this->sleepTime);
 
 	emit SignalUpdateInputValues();
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::UPDATE_INPUT_VALUES);
 
 	oplkRet = oplk_exchangeProcessImageIn();
 	if (oplkRet != kErrorOk)
@@ -128,4 +137,11 @@ void OplkSyncEventHandler::SetSleepTime(const ULONG sleepTime)
 {
 	this->sleepTime = sleepTime;
 	emit SignalSyncWaitTimeChanged((ulong)this->sleepTime);
+	SignalLatencyMonitor::Enqueue(MonitoredSignal::SYNC_WAIT_TIME_CHANGED);
+}
+
+void OplkSyncEventHandler::SetPaused(const bool paused)
+{
+	QMutexLocker locker(&this->exchangeMutex);
+	this->paused = paused;
 }
@@ -0,0 +1,337 @@
+/**
+********************************************************************************
+\file   PdoMappingModel.cpp
+
+\brief  Model of the PDO mapping of the local node.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <algorithm>
+#include <set>
+
+#include "api/PdoMappingModel.h"
+#include "api/LocalObjectDictionary.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Orders the channels by their position in the process image.
+	 */
+	bool IsBeforeInProcessImage(const Channel& first, const Channel& second)
+	{
+		return (((first.GetByteOffset() * 8) + first.GetBitOffset())
+				< ((second.GetByteOffset() * 8) + second.GetBitOffset()));
+	}
+
+	/**
+	 * \brief A mapped object with the mapping parameter object of its PDO.
+	 */
+	struct MappedObject
+	{
+		UINT mappingIndex;
+		PdoMappingObject object;
+	};
+
+	/**
+	 * \brief Orders the mapped objects by their index and subindex.
+	 */
+	bool IsBeforeInObjectDictionary(const MappedObject& first, const MappedObject& second)
+	{
+		if (first.object.GetIndex() != second.object.GetIndex())
+			return (first.object.GetIndex() < second.object.GetIndex());
+
+		return (first.object.GetSubIndex() < second.object.GetSubIndex());
+	}
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+PdoMappingModel::PdoMappingModel() :
+		QObject(),
+		mutex(),
+		updateScheduled(false),
+		resetPending(false),
+		pendingChanges(),
+		mappings()
+{
+	for (UINT slot = 0; slot < (2 * PdoMappingModel::kMappingsPerDirection); ++slot)
+	{
+		this->pendingChanges[slot].pending = false;
+		this->pendingChanges[slot].activated = false;
+		this->pendingChanges[slot].nodeId = 0;
+		this->pendingChanges[slot].objectCount = 0;
+	}
+}
+
+void PdoMappingModel::AddPdoChange(const tOplkApiEventPdoChange& pdoChange)
+{
+	const UINT mappingBase = pdoChange.fTx ? 0x1A00 : 0x1600;
+	if ((pdoChange.mappParamIndex & 0xFF00) != mappingBase)
+		return;
+
+	UINT slot = pdoChange.mappParamIndex & 0xFF;
+	if (pdoChange.fTx)
+		slot += PdoMappingModel::kMappingsPerDirection;
+
+	QMutexLocker lock(&this->mutex);
+	PendingChange& change = this->pendingChanges[slot];
+	change.pending = true;
+	change.activated = (pdoChange.fActivated != FALSE);
+	change.nodeId = pdoChange.nodeId;
+	change.objectCount = pdoChange.mappObjectCount;
+
+	if (!this->updateScheduled)
+	{
+		this->updateScheduled = true;
+		QMetaObject::invokeMethod(this, "Update", Qt::QueuedConnection);
+	}
+}
+
+void PdoMappingModel::Reset()
+{
+	QMutexLocker lock(&this->mutex);
+	for (UINT slot = 0; slot < (2 * PdoMappingModel::kMappingsPerDirection); ++slot)
+	{
+		this->pendingChanges[slot].pending = false;
+	}
+	this->resetPending = true;
+
+	if (!this->updateScheduled)
+	{
+		this->updateScheduled = true;
+		QMetaObject::invokeMethod(this, "Update", Qt::QueuedConnection);
+	}
+}
+
+std::vector<PdoMapping> PdoMappingModel::GetPdoMappings() const
+{
+	QMutexLocker lock(&this->mutex);
+
+	std::vector<PdoMapping> result;
+	for (std::map<UINT, PdoMapping>::const_iterator it = this->mappings.begin();
+		 it != this->mappings.end(); ++it)
+	{
+		result.push_back(it->second);
+	}
+	return result;
+}
+
+std::vector<PdoMapping> PdoMappingModel::GetPdoMappings(const UINT nodeId,
+						const Direction::Direction direction) const
+{
+	QMutexLocker lock(&this->mutex);
+
+	std::vector<PdoMapping> result;
+	for (std::map<UINT, PdoMapping>::const_iterator it = this->mappings.begin();
+		 it != this->mappings.end(); ++it)
+	{
+		if ((it->second.GetNodeId() == nodeId)
+			&& (it->second.GetDirection() == direction))
+		{
+			result.push_back(it->second);
+		}
+	}
+	return result;
+}
+
+std::vector<PdoChannelLocation> PdoMappingModel::EstimateChannelLocations(
+						const ProcessImage& processImage) const
+{
+	std::vector<PdoChannelLocation> locations;
+
+	std::set<UINT> nodeIds;
+	const std::vector<PdoMapping> allMappings = this->GetPdoMappings();
+	for (std::vector<PdoMapping>::const_iterator it = allMappings.begin();
+		 it != allMappings.end(); ++it)
+	{
+		if (it->GetDirection() == processImage.GetDirection())
+			nodeIds.insert(it->GetNodeId());
+	}
+
+	for (std::set<UINT>::const_iterator nodeId = nodeIds.begin();
+		 nodeId != nodeIds.end(); ++nodeId)
+	{
+		std::vector<Channel> channels = processImage.GetChannelsByNodeId(*nodeId);
+		std::stable_sort(channels.begin(), channels.end(), IsBeforeInProcessImage);
+		std::vector<bool> assigned(channels.size(), false);
+
+		// The process image variables of a node are allocated in the order of
+		// their objects, independent of the PDOs they are mapped to.
+		std::vector<MappedObject> objects;
+		const std::vector<PdoMapping> nodeMappings = this->GetPdoMappings(*nodeId,
+											processImage.GetDirection());
+		for (std::vector<PdoMapping>::const_iterator mapping = nodeMappings.begin();
+			 mapping != nodeMappings.end(); ++mapping)
+		{
+			for (std::vector<PdoMappingObject>::const_iterator object = mapping->GetObjects().begin();
+				 object != mapping->GetObjects().end(); ++object)
+			{
+				if ((object->GetIndex() < PdoMappingModel::kProcessImageFirstIndex)
+					|| (object->GetIndex() > PdoMappingModel::kProcessImageLastIndex))
+					continue;
+
+				const MappedObject mappedObject = {mapping->GetMappingIndex(), *object};
+				objects.push_back(mappedObject);
+			}
+		}
+		std::stable_sort(objects.begin(), objects.end(), IsBeforeInObjectDictionary);
+
+		for (std::vector<MappedObject>::const_iterator object = objects.begin();
+			 object != objects.end(); ++object)
+		{
+			for (UINT i = 0; i < channels.size(); ++i)
+			{
+				if (assigned[i] || (channels[i].GetBitSize() != object->object.GetBitSize()))
+					continue;
+
+				assigned[i] = true;
+				locations.push_back(PdoChannelLocation(channels[i],
+											*nodeId,
+											object->mappingIndex,
+											object->object));
+				break;
+			}
+		}
+	}
+	return locations;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void PdoMappingModel::Update()
+{
+	PendingChange changes[2 * PdoMappingModel::kMappingsPerDirection];
+	bool reset = false;
+	{
+		QMutexLocker lock(&this->mutex);
+		for (UINT slot = 0; slot < (2 * PdoMappingModel::kMappingsPerDirection); ++slot)
+		{
+			changes[slot] = this->pendingChanges[slot];
+			this->pendingChanges[slot].pending = false;
+		}
+		reset = this->resetPending;
+		this->resetPending = false;
+		this->updateScheduled = false;
+	}
+
+	std::set<UINT> changedNodes;
+	std::map<UINT, PdoMapping> readMappings;
+	for (UINT slot = 0; slot < (2 * PdoMappingModel::kMappingsPerDirection); ++slot)
+	{
+		if (!changes[slot].pending)
+			continue;
+
+		changedNodes.insert(changes[slot].nodeId);
+		if (changes[slot].activated)
+		{
+			const UINT mappingIndex = PdoMappingModel::GetMappingIndex(slot);
+			readMappings[mappingIndex] = PdoMappingModel::ReadMapping(mappingIndex,
+																changes[slot]);
+		}
+	}
+
+	{
+		QMutexLocker lock(&this->mutex);
+		if (reset)
+		{
+			for (std::map<UINT, PdoMapping>::const_iterator it = this->mappings.begin();
+				 it != this->mappings.end(); ++it)
+			{
+				changedNodes.insert(it->second.GetNodeId());
+			}
+			this->mappings.clear();
+		}
+
+		for (UINT slot = 0; slot < (2 * PdoMappingModel::kMappingsPerDirection); ++slot)
+		{
+			if (!changes[slot].pending)
+				continue;
+
+			const UINT mappingIndex = PdoMappingModel::GetMappingIndex(slot);
+			std::map<UINT, PdoMapping>::iterator previous = this->mappings.find(mappingIndex);
+			if (previous != this->mappings.end())
+			{
+				// The PDO may have been assigned to another node.
+				changedNodes.insert(previous->second.GetNodeId());
+				this->mappings.erase(previous);
+			}
+
+			if (changes[slot].activated)
+				this->mappings[mappingIndex] = readMappings[mappingIndex];
+		}
+	}
+
+	for (std::set<UINT>::const_iterator nodeId = changedNodes.begin();
+		 nodeId != changedNodes.end(); ++nodeId)
+	{
+		emit this->SignalPdoMappingChanged(*nodeId);
+	}
+}
+
+UINT PdoMappingModel::GetMappingIndex(const UINT slot)
+{
+	if (slot < PdoMappingModel::kMappingsPerDirection)
+		return (0x1600 + slot);
+
+	return (0x1A00 + (slot - PdoMappingModel::kMappingsPerDirection));
+}
+
+PdoMapping PdoMappingModel::ReadMapping(const UINT mappingIndex,
+						const PendingChange& change)
+{
+	PdoMapping mapping(change.nodeId,
+				((mappingIndex & 0xFF00) == 0x1A00) ? Direction::PI_OUT : Direction::PI_IN,
+				mappingIndex);
+
+	for (UINT subIndex = 1; subIndex <= change.objectCount; ++subIndex)
+	{
+		ULONGLONG mappingEntry = 0;
+		const tOplkError oplkRet = LocalObjectDictionary::ReadLocal(mappingIndex,
+															subIndex,
+															mappingEntry);
+		if (oplkRet != kErrorOk)
+		{
+			mapping.SetReadError(oplkRet);
+			break;
+		}
+
+		const PdoMappingObject object(mappingEntry);
+		if (object.IsValid())
+			mapping.AddObject(object);
+	}
+	return mapping;
+}
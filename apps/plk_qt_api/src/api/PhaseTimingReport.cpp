@@ -0,0 +1,152 @@
+/**
+********************************************************************************
+\file   PhaseTimingReport.cpp
+
+\brief  Implementation of the start-up phase timing report
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <iomanip>
+#include <sstream>
+
+#include "api/PhaseTimingReport.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+PhaseTimingReport::PhaseTimingReport() :
+	timer(),
+	phaseStart(),
+	phaseEnd()
+{
+	this->Start();
+}
+
+void PhaseTimingReport::Start()
+{
+	for (UINT phase = 0; phase < PhaseTimingReport::kNumberOfPhases; ++phase)
+	{
+		this->phaseStart[phase] = -1;
+		this->phaseEnd[phase] = -1;
+	}
+
+	this->timer.start();
+}
+
+void PhaseTimingReport::BeginPhase(const StartupPhase::StartupPhase phase)
+{
+	this->phaseStart[phase] = this->GetElapsedTime();
+	this->phaseEnd[phase] = -1;
+}
+
+void PhaseTimingReport::EndPhase(const StartupPhase::StartupPhase phase)
+{
+	if (this->phaseStart[phase] >= 0)
+	{
+		this->phaseEnd[phase] = this->GetElapsedTime();
+	}
+}
+
+bool PhaseTimingReport::IsPhaseCompleted(const StartupPhase::StartupPhase phase) const
+{
+	return (this->phaseEnd[phase] >= 0);
+}
+
+qint64 PhaseTimingReport::GetPhaseStart(const StartupPhase::StartupPhase phase) const
+{
+	return this->phaseStart[phase];
+}
+
+qint64 PhaseTimingReport::GetPhaseDuration(const StartupPhase::StartupPhase phase) const
+{
+	if (!this->IsPhaseCompleted(phase))
+		return -1;
+
+	return (this->phaseEnd[phase] - this->phaseStart[phase]);
+}
+
+qint64 PhaseTimingReport::GetTotalDuration() const
+{
+	qint64 total = 0;
+	for (UINT phase = 0; phase < PhaseTimingReport::kNumberOfPhases; ++phase)
+	{
+		if (this->phaseEnd[phase] > total)
+			total = this->phaseEnd[phase];
+	}
+
+	return total;
+}
+
+qint64 PhaseTimingReport::GetSequentialDuration() const
+{
+	qint64 total = 0;
+	for (UINT phase = 0; phase < PhaseTimingReport::kNumberOfPhases; ++phase)
+	{
+		if (this->phaseEnd[phase] >= 0)
+			total += (this->phaseEnd[phase] - this->phaseStart[phase]);
+	}
+
+	return total;
+}
+
+std::string PhaseTimingReport::ToString() const
+{
+	std::ostringstream report;
+	report << std::fixed << std::setprecision(3);
+	for (UINT phase = 0; phase < PhaseTimingReport::kNumberOfPhases; ++phase)
+	{
+		if (this->phaseEnd[phase] < 0)
+			continue;
+
+		report << std::left << std::setw(24)
+			   << StartupPhase::GetStartupPhaseString((StartupPhase::StartupPhase) phase)
+			   << std::right
+			   << " start: " << std::setw(10) << (this->phaseStart[phase] / 1000.0) << " ms"
+			   << " duration: " << std::setw(10)
+			   << ((this->phaseEnd[phase] - this->phaseStart[phase]) / 1000.0) << " ms"
+			   << std::endl;
+	}
+
+	report << std::left << std::setw(24) << "Total" << std::right
+		   << " elapsed: " << std::setw(8) << (this->GetTotalDuration() / 1000.0) << " ms"
+		   << " sequential: " << std::setw(8) << (this->GetSequentialDuration() / 1000.0) << " ms";
+
+	return report.str();
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+qint64 PhaseTimingReport::GetElapsedTime() const
+{
+	return (this->timer.nsecsElapsed() / 1000);
+}
@@ -37,25 +37,116 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*******************************************************************************
 * INCLUDES
 *******************************************************************************/
+#include <QtCore/QtDebug>
+
 #include "api/ReceiverContext.h"
 
 /*******************************************************************************
 * PUBLIC Functions
 *******************************************************************************/
-ReceiverContext::ReceiverContext(const QObject* receiver,
-		const QMetaMethod* receiverFunction) :
-		receiver(receiver),
-		receiverFunction(receiverFunction)
+ReceiverRelay::ReceiverRelay() :
+		QObject()
+{
+}
+
+ReceiverContext::ReceiverContext() :
+		relay(),
+		connected(false),
+		receiverFunction(),
+		callback(NULL),
+		sdoType(kSdoTypeAuto),
+		timer()
+{
+
+}
+
+ReceiverContext::~ReceiverContext()
+{
+	delete this->callback;
+}
+
+bool ReceiverContext::SetReceiver(const QObject* receiver,
+		const QMetaMethod& receiverFunction)
+{
+	this->Reset();
+	this->receiverFunction = receiverFunction;
+
+	// Connected in the thread of the requester, while the receiver is alive.
+	this->connected = QObject::connect(&this->relay,
+			QMetaMethod::fromSignal(&ReceiverRelay::SignalSdoTransferFinished),
+			receiver,
+			receiverFunction,
+			Qt::QueuedConnection);
+	return this->connected;
+}
+
+void ReceiverContext::SetCallback(SdoTransferCallback* callback)
+{
+	this->Reset();
+	this->callback = callback;
+}
+
+void ReceiverContext::Reset()
+{
+	delete this->callback;
+	this->callback = NULL;
+	if (this->connected)
+	{
+		// Results emitted already are still delivered.
+		this->relay.disconnect();
+		this->connected = false;
+	}
+	this->receiverFunction = QMetaMethod();
+	this->sdoType = kSdoTypeAuto;
+	this->timer.invalidate();
+}
+
+void ReceiverContext::Start(tSdoType sdoType)
 {
+	this->sdoType = sdoType;
+	this->timer.start();
+}
 
+tSdoType ReceiverContext::GetSdoType() const
+{
+	return this->sdoType;
 }
 
-const QObject* ReceiverContext::GetReceiver() const
+quint64 ReceiverContext::GetLatency() const
 {
-	return this->receiver;
+	if (!this->timer.isValid())
+		return 0;
+
+	return (quint64) (this->timer.nsecsElapsed() / 1000);
 }
 
-const QMetaMethod* ReceiverContext::GetReceiverFunction() const
+const QMetaMethod& ReceiverContext::GetReceiverFunction() const
 {
 	return this->receiverFunction;
 }
+
+bool ReceiverContext::Dispatch(const SdoTransferResult& result)
+{
+	if (this->callback)
+	{
+		this->callback->OnSdoTransferFinished(result);
+		return true;
+	}
+
+	if (!this->connected)
+	{
+		qDebug("ReceiverContext: No receiver");
+		return false;
+	}
+
+	emit this->relay.SignalSdoTransferFinished(result);
+	return true;
+}
+
+void ReceiverContext::DispatchProgress(const SdoTransferResult& progress) const
+{
+	if (this->callback)
+	{
+		this->callback->OnSdoTransferProgress(progress);
+	}
+}
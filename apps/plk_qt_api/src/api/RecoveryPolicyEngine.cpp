@@ -0,0 +1,330 @@
+/**
+********************************************************************************
+\file   RecoveryPolicyEngine.cpp
+
+\brief  Automatic recovery from critical errors of the stack.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "api/RecoveryPolicyEngine.h"
+#include "api/OplkQtApi.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+RecoveryPolicyEngine::RecoveryPolicyEngine(QObject* parent) :
+		QObject(parent),
+		attemptTimer(),
+		recoveryTimer(),
+		enabled(false),
+		recovering(false),
+		awaitingOperational(false),
+		nodeReset(false),
+		error(),
+		errorTimer(),
+		attempt(0),
+		lastAction(RecoveryAction::NONE),
+		lastTimeToRecover(0),
+		maxTimeToRecover(0),
+		recoveredCount(0),
+		failedCount(0)
+{
+	/* qRegisterMetaType<T>() is only required for sending the object
+	 * through queued signals and slots.
+	 */
+	qRegisterMetaType<RecoveryEvent>("RecoveryEvent");
+	qRegisterMetaType<CriticalError>("CriticalError");
+
+	// Try the actions with the least downtime first.
+	this->policies[Recoverability::TRANSIENT].AddAction(RecoveryAction::RESET_COMMUNICATION);
+	this->policies[Recoverability::TRANSIENT].AddAction(RecoveryAction::RESET_NODE);
+	for (UINT i = 0; i < 3; ++i)
+	{
+		this->policies[Recoverability::TRANSIENT].AddAction(RecoveryAction::RESTART_STACK);
+		this->policies[Recoverability::RECOVERABLE].AddAction(RecoveryAction::RESTART_STACK);
+	}
+
+	this->attemptTimer.setSingleShot(true);
+	bool ret = connect(&(this->attemptTimer), SIGNAL(timeout()),
+					   this, SLOT(ExecuteNextAction()));
+	Q_ASSERT(ret != false);
+
+	this->recoveryTimer.setSingleShot(true);
+	ret = connect(&(this->recoveryTimer), SIGNAL(timeout()),
+				  this, SLOT(HandleRecoveryTimeout()));
+	Q_ASSERT(ret != false);
+}
+
+RecoveryPolicyEngine::~RecoveryPolicyEngine()
+{
+	this->Disable();
+}
+
+void RecoveryPolicyEngine::SetPolicy(const Recoverability::Recoverability recoverability,
+								const RecoveryPolicy& policy)
+{
+	Q_ASSERT(recoverability < Recoverability::NUMBER_OF_CLASSES);
+	this->policies[recoverability] = policy;
+}
+
+const RecoveryPolicy& RecoveryPolicyEngine::GetPolicy(
+						const Recoverability::Recoverability recoverability) const
+{
+	Q_ASSERT(recoverability < Recoverability::NUMBER_OF_CLASSES);
+	return this->policies[recoverability];
+}
+
+bool RecoveryPolicyEngine::Enable()
+{
+	if (this->enabled)
+		return true;
+
+	bool ret = OplkQtApi::RegisterCriticalErrorOccurredEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandleCriticalError(const CriticalError)").constData())));
+	if (!ret)
+		return false;
+
+	ret = OplkQtApi::RegisterLocalNodeStateChangedEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandleLocalNodeStateChanged(tNmtState)").constData())));
+	if (!ret)
+	{
+		OplkQtApi::UnregisterCriticalErrorOccurredEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandleCriticalError(const CriticalError)").constData())));
+		return false;
+	}
+
+	this->enabled = true;
+	return true;
+}
+
+void RecoveryPolicyEngine::Disable()
+{
+	this->attemptTimer.stop();
+	this->recoveryTimer.stop();
+	this->recovering = false;
+	this->awaitingOperational = false;
+
+	if (!this->enabled)
+		return;
+
+	OplkQtApi::UnregisterCriticalErrorOccurredEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandleCriticalError(const CriticalError)").constData())));
+	OplkQtApi::UnregisterLocalNodeStateChangedEventHandler(*this,
+			this->metaObject()->method(this->metaObject()->indexOfSlot(
+				QMetaObject::normalizedSignature(
+				"HandleLocalNodeStateChanged(tNmtState)").constData())));
+	this->enabled = false;
+}
+
+bool RecoveryPolicyEngine::IsEnabled() const
+{
+	return this->enabled;
+}
+
+bool RecoveryPolicyEngine::IsRecovering() const
+{
+	return this->recovering;
+}
+
+qint64 RecoveryPolicyEngine::GetLastTimeToRecover() const
+{
+	return this->lastTimeToRecover;
+}
+
+qint64 RecoveryPolicyEngine::GetMaxTimeToRecover() const
+{
+	return this->maxTimeToRecover;
+}
+
+ULONG RecoveryPolicyEngine::GetRecoveredCount() const
+{
+	return this->recoveredCount;
+}
+
+ULONG RecoveryPolicyEngine::GetFailedCount() const
+{
+	return this->failedCount;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void RecoveryPolicyEngine::HandleCriticalError(const CriticalError error)
+{
+	if (this->recovering)
+	{
+		// The actions may cause further critical errors. Only a fatal
+		// error ends the recovery, further actions would not help.
+		if (error.GetRecoverability() == Recoverability::FATAL)
+		{
+			this->attemptTimer.stop();
+			this->recoveryTimer.stop();
+			this->awaitingOperational = false;
+			this->error = error;
+			this->FailRecovery();
+		}
+		return;
+	}
+
+	this->recovering = true;
+	this->awaitingOperational = false;
+	this->error = error;
+	this->errorTimer.start();
+	this->attempt = 0;
+	this->lastAction = RecoveryAction::NONE;
+	this->TriggerRecoveryEvent(RecoveryEventType::RECOVERY_STARTED,
+							RecoveryAction::NONE, kErrorOk);
+
+	const RecoveryPolicy& policy = this->policies[error.GetRecoverability()];
+	if (policy.GetActions().empty())
+	{
+		this->FailRecovery();
+		return;
+	}
+
+	this->attemptTimer.start(policy.GetBackoff(0));
+}
+
+void RecoveryPolicyEngine::HandleLocalNodeStateChanged(tNmtState nmtState)
+{
+	if (!this->awaitingOperational)
+		return;
+
+	if ((nmtState != kNmtMsOperational) && (nmtState != kNmtCsOperational))
+	{
+		this->nodeReset = true;
+		return;
+	}
+
+	// A state change queued before the action does not complete the recovery.
+	if (!this->nodeReset)
+		return;
+
+	this->recoveryTimer.stop();
+	this->awaitingOperational = false;
+
+	const qint64 timeToRecover = this->GetElapsed();
+	this->lastTimeToRecover = timeToRecover;
+	if (timeToRecover > this->maxTimeToRecover)
+		this->maxTimeToRecover = timeToRecover;
+	++this->recoveredCount;
+
+	this->TriggerRecoveryEvent(RecoveryEventType::RECOVERED,
+							this->lastAction, kErrorOk);
+	this->recovering = false;
+}
+
+void RecoveryPolicyEngine::ExecuteNextAction()
+{
+	if (!this->recovering)
+		return;
+
+	const RecoveryPolicy& policy = this->policies[this->error.GetRecoverability()];
+	this->lastAction = policy.GetActions().at(this->attempt);
+	++this->attempt;
+
+	const tOplkError result = RecoveryPolicyEngine::Execute(this->lastAction);
+	this->TriggerRecoveryEvent(RecoveryEventType::ACTION_EXECUTED,
+							this->lastAction, result);
+	if (result != kErrorOk)
+	{
+		this->HandleRecoveryTimeout();
+		return;
+	}
+
+	this->awaitingOperational = true;
+	this->nodeReset = false;
+	this->recoveryTimer.start(policy.GetRecoveryTimeout());
+}
+
+void RecoveryPolicyEngine::HandleRecoveryTimeout()
+{
+	if (!this->recovering)
+		return;
+
+	this->awaitingOperational = false;
+
+	const RecoveryPolicy& policy = this->policies[this->error.GetRecoverability()];
+	if (this->attempt >= policy.GetActions().size())
+	{
+		this->FailRecovery();
+		return;
+	}
+
+	this->attemptTimer.start(policy.GetBackoff(this->attempt));
+}
+
+tOplkError RecoveryPolicyEngine::Execute(const RecoveryAction::RecoveryAction action)
+{
+	switch (action)
+	{
+		case RecoveryAction::RESET_COMMUNICATION:
+			return oplk_execNmtCommand(kNmtEventResetCom);
+		case RecoveryAction::RESET_NODE:
+			return oplk_execNmtCommand(kNmtEventResetNode);
+		case RecoveryAction::RESTART_STACK:
+			return OplkQtApi::RestartStack();
+		case RecoveryAction::NONE:
+		default:
+			return kErrorOk;
+	}
+}
+
+void RecoveryPolicyEngine::TriggerRecoveryEvent(
+						const RecoveryEventType::RecoveryEventType type,
+						const RecoveryAction::RecoveryAction action,
+						const tOplkError result)
+{
+	emit this->SignalRecoveryEvent(RecoveryEvent(type, this->error, action,
+							this->attempt, result, this->GetElapsed()));
+}
+
+void RecoveryPolicyEngine::FailRecovery()
+{
+	++this->failedCount;
+	this->TriggerRecoveryEvent(RecoveryEventType::RECOVERY_FAILED,
+							this->lastAction, kErrorOk);
+	this->recovering = false;
+}
+
+qint64 RecoveryPolicyEngine::GetElapsed() const
+{
+	return this->errorTimer.elapsed();
+}
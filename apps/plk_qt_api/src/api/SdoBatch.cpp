@@ -0,0 +1,274 @@
+/**
+********************************************************************************
+\file   SdoBatch.cpp
+
+\brief  Implementation of a batch of SDO transfers with an aggregated result
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#include <QtCore/QMetaMethod>
+
+#include "api/SdoBatch.h"
+#include "api/SdoScheduler.h"
+#include "user/SdoTransferJob.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SdoBatch::SdoBatch(const std::vector<SdoBatchRequest>& requests,
+				QObject* parent) :
+		QObject(parent),
+		items(),
+		issueOrder(),
+		deadlineTimer(),
+		finishedItems(0),
+		started(false)
+{
+	this->items.reserve(requests.size());
+	std::map<UINT, std::vector<UINT> > itemsPerNode;
+	for (std::vector<SdoBatchRequest>::const_iterator it = requests.begin();
+		 it != requests.end(); ++it)
+	{
+		const Item item = {*it,
+						(it->GetSdoAccessType() == kSdoAccessTypeWrite)
+							? it->GetWriteData() : std::vector<BYTE>(it->GetDataSize(), 0),
+						0,
+						SdoBatchItemState::PENDING,
+						SdoTransferResult(it->GetNodeId(),
+										it->GetIndex(),
+										it->GetSubIndex(),
+										0,
+										it->GetSdoAccessType(),
+										kSdoComTransferNotActive,
+										0)};
+		itemsPerNode[it->GetNodeId()].push_back(this->items.size());
+		this->items.push_back(item);
+	}
+
+	// One request per node and round, so every node has a transfer in flight.
+	this->issueOrder.reserve(this->items.size());
+	for (std::size_t round = 0; this->issueOrder.size() < this->items.size(); ++round)
+	{
+		for (std::map<UINT, std::vector<UINT> >::const_iterator it = itemsPerNode.begin();
+			 it != itemsPerNode.end(); ++it)
+		{
+			if (round < it->second.size())
+				this->issueOrder.push_back(it->second[round]);
+		}
+	}
+
+	this->deadlineTimer.setSingleShot(true);
+	bool ret = connect(&(this->deadlineTimer), SIGNAL(timeout()),
+					   this, SLOT(HandleDeadlineExpired()));
+	Q_ASSERT(ret != false);
+}
+
+SdoBatch::~SdoBatch()
+{
+	if (!this->started)
+		return;
+
+	// The scheduler must not write into the buffers any more.
+	for (std::vector<Item>::const_iterator it = this->items.begin();
+		 it != this->items.end(); ++it)
+	{
+		if (it->state == SdoBatchItemState::PENDING)
+			SdoScheduler::GetInstance().Cancel(it->transferId);
+	}
+}
+
+bool SdoBatch::Start(const int deadline)
+{
+	if (this->started)
+		return false;
+
+	this->started = true;
+
+	if (this->items.empty())
+	{
+		emit this->SignalFinished();
+		return true;
+	}
+
+	const QMetaMethod receiverFunction = this->metaObject()->method(
+				this->metaObject()->indexOfMethod(
+				QMetaObject::normalizedSignature(
+				"HandleSdoTransferFinished(const ULONG,const SdoTransferResult)").constData()));
+
+	for (std::vector<UINT>::const_iterator it = this->issueOrder.begin();
+		 it != this->issueOrder.end(); ++it)
+	{
+		Item& item = this->items[*it];
+		const SdoTransferJob job(item.request.GetNodeId(),
+								item.request.GetIndex(),
+								item.request.GetSubIndex(),
+								item.data.empty() ? NULL : &(item.data[0]),
+								item.data.size(),
+								item.request.GetSdoType(),
+								item.request.GetSdoAccessType());
+		item.transferId = SdoScheduler::GetInstance().Enqueue(job,
+											*this, receiverFunction);
+	}
+
+	if (deadline > 0)
+	{
+		this->deadlineTimer.start(deadline);
+	}
+
+	return true;
+}
+
+void SdoBatch::Cancel()
+{
+	this->CancelPending(SdoBatchItemState::CANCELLED,
+						SDO_AC_DATA_NOT_TRANSF_DUE_LOCAL_CONTROL);
+}
+
+bool SdoBatch::IsFinished() const
+{
+	return (this->finishedItems == this->items.size());
+}
+
+UINT SdoBatch::GetItemCount() const
+{
+	return this->items.size();
+}
+
+UINT SdoBatch::GetFinishedItemCount() const
+{
+	return this->finishedItems;
+}
+
+const SdoBatchRequest& SdoBatch::GetRequest(const UINT item) const
+{
+	return this->GetItem(item).request;
+}
+
+SdoBatchItemState::SdoBatchItemState SdoBatch::GetItemState(const UINT item) const
+{
+	return this->GetItem(item).state;
+}
+
+const SdoTransferResult& SdoBatch::GetResult(const UINT item) const
+{
+	return this->GetItem(item).result;
+}
+
+const std::vector<BYTE>& SdoBatch::GetData(const UINT item) const
+{
+	return this->GetItem(item).data;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void SdoBatch::HandleSdoTransferFinished(const ULONG transferId,
+						const SdoTransferResult result)
+{
+	for (UINT item = 0; item < this->items.size(); ++item)
+	{
+		if ((this->items[item].transferId == transferId)
+			&& (this->items[item].state == SdoBatchItemState::PENDING))
+		{
+			const bool success = (result.GetSdoComConState() == kSdoComTransferFinished)
+								 && (result.GetAbortCode() == 0);
+			this->FinishItem(item,
+					success ? SdoBatchItemState::FINISHED : SdoBatchItemState::ABORTED,
+					result);
+			break;
+		}
+	}
+}
+
+void SdoBatch::HandleDeadlineExpired()
+{
+	this->CancelPending(SdoBatchItemState::TIMED_OUT, SDO_AC_TIME_OUT);
+}
+
+const SdoBatch::Item& SdoBatch::GetItem(const UINT item) const
+{
+	if (item >= this->items.size())
+	{
+		std::ostringstream message;
+		message << "Item " << item << " is not in the batch of "
+				<< this->items.size() << " items";
+		throw std::out_of_range(message.str());
+	}
+
+	return this->items[item];
+}
+
+void SdoBatch::CancelPending(const SdoBatchItemState::SdoBatchItemState state,
+							const UINT32 abortCode)
+{
+	for (std::vector<UINT>::const_iterator it = this->issueOrder.begin();
+		 it != this->issueOrder.end(); ++it)
+	{
+		const Item& item = this->items[*it];
+		if (item.state != SdoBatchItemState::PENDING)
+			continue;
+
+		if (this->started)
+		{
+			SdoScheduler::GetInstance().Cancel(item.transferId);
+		}
+
+		this->FinishItem(*it, state, SdoTransferResult(item.request.GetNodeId(),
+										item.request.GetIndex(),
+										item.request.GetSubIndex(),
+										0,
+										item.request.GetSdoAccessType(),
+										kSdoComTransferTxAborted,
+										abortCode));
+	}
+}
+
+void SdoBatch::FinishItem(const UINT item,
+						const SdoBatchItemState::SdoBatchItemState state,
+						const SdoTransferResult& result)
+{
+	this->items[item].state = state;
+	this->items[item].result = result;
+	++this->finishedItems;
+
+	emit this->SignalItemFinished(item);
+
+	if (this->IsFinished())
+	{
+		this->deadlineTimer.stop();
+		emit this->SignalFinished();
+	}
+}
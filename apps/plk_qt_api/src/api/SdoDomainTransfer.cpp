@@ -0,0 +1,359 @@
+/**
+********************************************************************************
+\file   SdoDomainTransfer.cpp
+
+\brief  Implementation of the streaming transfer of DOMAIN objects
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QMetaType>
+#include <QtCore/QPointer>
+#include <QtCore/QtDebug>
+
+#include "api/SdoDomainTransfer.h"
+#include "api/OplkQtApi.h"
+#include "api/SdoTransferCallback.h"
+#include "user/SdoTransferJob.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Forwards the reports of one attempt to the SdoDomainTransfer.
+	 *
+	 * Runs in the stack event thread, so the reports are queued to the
+	 * thread of the transfer. The callback keeps the mapped file until
+	 * the stack has reported the end of the transfer, as the transfer may
+	 * be deleted before.
+	 */
+	class DomainTransferCallback : public SdoTransferCallback
+	{
+	public:
+		DomainTransferCallback(SdoDomainTransfer* transfer,
+							const ULONG attempt,
+							const QSharedPointer<QFile>& file) :
+			transfer(transfer),
+			attempt(attempt),
+			file(file)
+		{
+		}
+
+		void OnSdoTransferProgress(const SdoTransferResult& progress)
+		{
+			if (this->transfer.isNull())
+				return;
+
+			QMetaObject::invokeMethod(this->transfer.data(),
+							"HandleSdoTransferProgress",
+							Qt::QueuedConnection,
+							Q_ARG(ULONG, this->attempt),
+							Q_ARG(SdoTransferResult, progress));
+		}
+
+		void OnSdoTransferFinished(const SdoTransferResult& result)
+		{
+			if (this->transfer.isNull())
+				return;
+
+			QMetaObject::invokeMethod(this->transfer.data(),
+							"HandleSdoTransferFinished",
+							Qt::QueuedConnection,
+							Q_ARG(ULONG, this->attempt),
+							Q_ARG(SdoTransferResult, result));
+		}
+
+	private:
+		QPointer<SdoDomainTransfer> transfer;
+		const ULONG attempt;
+		const QSharedPointer<QFile> file;  ///< Unmapped when the last owner releases it.
+	};
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SdoDomainTransfer::SdoDomainTransfer(const UINT nodeId,
+						const UINT index,
+						const UINT subIndex,
+						const QString& fileName,
+						tSdoAccessType sdoAccessType,
+						const UINT maxReadSize,
+						tSdoType sdoType,
+						QObject* parent) :
+		QObject(parent),
+		nodeId(nodeId),
+		index(index),
+		subIndex(subIndex),
+		sdoAccessType(sdoAccessType),
+		sdoType(sdoType),
+		file(new QFile(fileName)),
+		useFile(true),
+		data(NULL),
+		size(0),
+		maxReadSize(maxReadSize),
+		sdoComConHdl(0),
+		attempt(0),
+		running(false),
+		transferredBytes(0),
+		result(),
+		timer(),
+		duration(0)
+{
+	/* qRegisterMetaType<T>() is only required for sending the object
+	 * through queued signal/slot connections.
+	 */
+	qRegisterMetaType<SdoTransferResult>("SdoTransferResult");
+	qRegisterMetaType<ULONG>("ULONG");
+}
+
+SdoDomainTransfer::SdoDomainTransfer(const UINT nodeId,
+						const UINT index,
+						const UINT subIndex,
+						uchar* data,
+						const UINT size,
+						tSdoAccessType sdoAccessType,
+						tSdoType sdoType,
+						QObject* parent) :
+		QObject(parent),
+		nodeId(nodeId),
+		index(index),
+		subIndex(subIndex),
+		sdoAccessType(sdoAccessType),
+		sdoType(sdoType),
+		file(),
+		useFile(false),
+		data(data),
+		size(size),
+		maxReadSize(size),
+		sdoComConHdl(0),
+		attempt(0),
+		running(false),
+		transferredBytes(0),
+		result(),
+		timer(),
+		duration(0)
+{
+	qRegisterMetaType<SdoTransferResult>("SdoTransferResult");
+	qRegisterMetaType<ULONG>("ULONG");
+}
+
+SdoDomainTransfer::~SdoDomainTransfer()
+{
+	if (this->running)
+	{
+		// The abort is confirmed later. The callback releases the mapping then.
+		this->Abort();
+		return;
+	}
+
+	this->UnmapFile();
+}
+
+tOplkError SdoDomainTransfer::Start()
+{
+	if (this->running)
+		return kErrorApiInvalidParam;
+
+	if (this->useFile && !this->MapFile())
+		return kErrorNoResource;
+
+	++this->attempt;
+	this->transferredBytes = 0;
+	this->result = SdoTransferResult();
+	this->timer.start();
+
+	tOplkError oplkRet = OplkQtApi::TransferObject(
+						SdoTransferJob(this->nodeId,
+									this->index,
+									this->subIndex,
+									this->data,
+									this->size,
+									this->sdoType,
+									this->sdoAccessType),
+						new DomainTransferCallback(this, this->attempt, this->file),
+						&this->sdoComConHdl);
+	if (oplkRet == kErrorApiTaskDeferred)
+	{
+		this->running = true;
+		return oplkRet;
+	}
+
+	// Local OD access has finished already; everything else failed.
+	const bool success = (oplkRet == kErrorOk);
+	this->Finish(SdoTransferResult(this->nodeId,
+								this->index,
+								this->subIndex,
+								success ? this->size : 0,
+								this->sdoAccessType,
+								success ? kSdoComTransferFinished : kSdoComTransferLowerLayerAbort,
+								success ? 0 : SDO_AC_GENERAL_ERROR));
+	return oplkRet;
+}
+
+bool SdoDomainTransfer::Abort()
+{
+	if (!this->running)
+		return false;
+
+	tOplkError oplkRet = oplk_abortSdo(this->sdoComConHdl,
+								SDO_AC_DATA_NOT_TRANSF_DUE_LOCAL_CONTROL);
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("abortSdo Ret: %d", oplkRet);
+		return false;
+	}
+
+	return true;
+}
+
+tOplkError SdoDomainTransfer::Resume()
+{
+	if (this->running
+		|| (this->result.GetSdoComConState() == kSdoComTransferFinished))
+	{
+		return kErrorApiInvalidParam;
+	}
+
+	return this->Start();
+}
+
+bool SdoDomainTransfer::IsRunning() const
+{
+	return this->running;
+}
+
+UINT SdoDomainTransfer::GetTransferredBytes() const
+{
+	return this->transferredBytes;
+}
+
+UINT SdoDomainTransfer::GetSize() const
+{
+	return this->size;
+}
+
+double SdoDomainTransfer::GetThroughput() const
+{
+	const qint64 duration = this->running ? this->timer.elapsed() : this->duration;
+	return (duration > 0) ? (this->transferredBytes * 1000.0 / duration) : 0.0;
+}
+
+const SdoTransferResult& SdoDomainTransfer::GetResult() const
+{
+	return this->result;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void SdoDomainTransfer::HandleSdoTransferProgress(const ULONG attempt,
+						const SdoTransferResult progress)
+{
+	if ((attempt != this->attempt) || !this->running)
+		return;
+
+	this->transferredBytes = progress.GetTransferredBytes();
+	emit this->SignalProgress(this->transferredBytes, this->size);
+}
+
+void SdoDomainTransfer::HandleSdoTransferFinished(const ULONG attempt,
+						const SdoTransferResult result)
+{
+	if ((attempt != this->attempt) || !this->running)
+		return;
+
+	this->Finish(result);
+}
+
+bool SdoDomainTransfer::MapFile()
+{
+	if (this->sdoAccessType == kSdoAccessTypeWrite)
+	{
+		if (!this->file->open(QIODevice::ReadOnly))
+		{
+			qDebug("SdoDomainTransfer: %s", qPrintable(this->file->errorString()));
+			return false;
+		}
+		this->size = this->file->size();
+	}
+	else
+	{
+		if (!this->file->open(QIODevice::ReadWrite | QIODevice::Truncate)
+			|| !this->file->resize(this->maxReadSize))
+		{
+			qDebug("SdoDomainTransfer: %s", qPrintable(this->file->errorString()));
+			this->file->close();
+			return false;
+		}
+		this->size = this->maxReadSize;
+	}
+
+	this->data = (this->size > 0) ? this->file->map(0, this->size) : NULL;
+	if (this->data == NULL)
+	{
+		qDebug("SdoDomainTransfer: Mapping of %u bytes failed", this->size);
+		this->file->close();
+		return false;
+	}
+
+	return true;
+}
+
+void SdoDomainTransfer::UnmapFile()
+{
+	if (!this->useFile || (this->data == NULL))
+		return;
+
+	this->file->unmap(this->data);
+	this->data = NULL;
+
+	if (this->sdoAccessType == kSdoAccessTypeRead)
+	{
+		// Only the uploaded bytes are kept.
+		this->file->resize(this->transferredBytes);
+	}
+	this->file->close();
+}
+
+void SdoDomainTransfer::Finish(const SdoTransferResult& result)
+{
+	this->running = false;
+	this->duration = this->timer.elapsed();
+	this->result = result;
+	this->transferredBytes = result.GetTransferredBytes();
+	this->UnmapFile();
+
+	emit this->SignalProgress(this->transferredBytes, this->size);
+	emit this->SignalFinished(result);
+}
@@ -0,0 +1,713 @@
+/**
+********************************************************************************
+\file   SdoScheduler.cpp
+
+\brief  Implementation of the asynchronous SDO transfer scheduler
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QMetaType>
+#include <QtCore/QtDebug>
+
+#include "api/SdoScheduler.h"
+#include "api/SdoTransferPool.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+static const UINT kMaxSdoConnections = (SDO_MAX_CONNECTION_ASND > SDO_MAX_CONNECTION_UDP)
+									? SDO_MAX_CONNECTION_ASND : SDO_MAX_CONNECTION_UDP;
+
+namespace
+{
+	/**
+	 * \brief Hands the result of one scheduled transfer back to the scheduler.
+	 *
+	 * Runs in the stack event thread, so the result is queued to the
+	 * thread of the scheduler.
+	 */
+	class ScheduledTransferCallback : public SdoTransferCallback
+	{
+	public:
+		ScheduledTransferCallback(SdoScheduler& scheduler, const ULONG transferId) :
+			scheduler(scheduler),
+			transferId(transferId)
+		{
+		}
+
+		void OnSdoTransferFinished(const SdoTransferResult& result)
+		{
+			bool ret = QMetaObject::invokeMethod(&this->scheduler,
+							"HandleSdoTransferFinished",
+							Qt::QueuedConnection,
+							Q_ARG(ULONG, this->transferId),
+							Q_ARG(SdoTransferResult, result));
+			Q_ASSERT(ret != false);
+			Q_UNUSED(ret);
+		}
+
+	private:
+		SdoScheduler& scheduler;
+		const ULONG transferId;
+	};
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SdoScheduler& SdoScheduler::GetInstance()
+{
+	// Local static object - Not thread safe
+	static SdoScheduler instance;
+	return instance;
+}
+
+ULONG SdoScheduler::Enqueue(const SdoTransferJob& sdoTransferJob,
+						const QObject& receiver,
+						const QMetaMethod& receiverFunction)
+{
+	SdoRetryPolicy retryPolicy;
+	{
+		QMutexLocker lock(&this->mutex);
+		std::map<UINT, SdoRetryPolicy>::const_iterator node =
+				this->nodeRetryPolicies.find(sdoTransferJob.GetNodeId());
+		retryPolicy = (node != this->nodeRetryPolicies.end())
+					? node->second : this->retryPolicy;
+	}
+
+	return this->Enqueue(sdoTransferJob, receiver, receiverFunction, retryPolicy);
+}
+
+ULONG SdoScheduler::Enqueue(const SdoTransferJob& sdoTransferJob,
+						const QObject& receiver,
+						const QMetaMethod& receiverFunction,
+						const SdoRetryPolicy& retryPolicy)
+{
+	if (!receiverFunction.isValid())
+		return 0;
+
+	QMutexLocker lock(&this->mutex);
+
+	if (this->queue.empty() && this->inFlight.empty())
+	{
+		this->busyTimer.start();
+	}
+
+	ScheduledTransfer transfer = {++this->lastTransferId,
+								sdoTransferJob,
+								const_cast<QObject*>(&receiver),
+								receiverFunction,
+								0,
+								NULL,
+								false,
+								retryPolicy,
+								0,
+								0,
+								0,
+								false};
+	this->queue.push_back(transfer);
+	if (this->queue.size() > this->peakQueueDepth)
+	{
+		this->peakQueueDepth = this->queue.size();
+	}
+
+	this->IssueTransfers();
+
+	return transfer.id;
+}
+
+bool SdoScheduler::Cancel(const ULONG transferId)
+{
+	QMutexLocker lock(&this->mutex);
+
+	for (std::deque<ScheduledTransfer>::iterator it = this->queue.begin();
+		 it != this->queue.end(); ++it)
+	{
+		if (it->id == transferId)
+		{
+			this->queue.erase(it);
+			this->UpdateBusyTime();
+			return true;
+		}
+	}
+
+	for (std::list<ScheduledTransfer>::iterator it = this->inFlight.begin();
+		 it != this->inFlight.end(); ++it)
+	{
+		if ((it->id == transferId) && !it->cancelled)
+		{
+			// The transfer occupies its SDO connection until the stack
+			// reports the abort.
+			tOplkError oplkRet = oplk_abortSdo(it->sdoComConHdl,
+										SDO_AC_DATA_NOT_TRANSF_DUE_LOCAL_CONTROL);
+			if (oplkRet != kErrorOk)
+			{
+				qDebug("abortSdo Ret: %d", oplkRet);
+			}
+			it->cancelled = true;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void SdoScheduler::Clear()
+{
+	QMutexLocker lock(&this->mutex);
+
+	for (std::list<ScheduledTransfer>::iterator it = this->inFlight.begin();
+		 it != this->inFlight.end(); )
+	{
+		if (it->cancelled)
+		{
+			++it;
+			continue;
+		}
+
+		this->Deliver(*it, SdoTransferResult(it->job.GetNodeId(),
+										it->job.GetIndex(),
+										it->job.GetSubIndex(),
+										0,
+										it->job.GetSdoAccessType(),
+										kSdoComTransferTxAborted,
+										SDO_AC_DATA_NOT_TRANSF_DUE_DEVICE_STATE));
+
+		// The transfer occupies its SDO connection until the stack
+		// reports the abort.
+		tOplkError oplkRet = oplk_abortSdo(it->sdoComConHdl,
+									SDO_AC_DATA_NOT_TRANSF_DUE_DEVICE_STATE);
+		if (oplkRet != kErrorOk)
+		{
+			// No abort will be reported for this transfer.
+			qDebug("abortSdo Ret: %d", oplkRet);
+			SdoTransferPool::GetInstance().Release(it->receiverContext);
+			++this->failed;
+			this->UpdateInFlight(*it, false);
+			it = this->inFlight.erase(it);
+			continue;
+		}
+
+		it->cancelled = true;
+		++it;
+	}
+
+	for (std::deque<ScheduledTransfer>::const_iterator it = this->queue.begin();
+		 it != this->queue.end(); ++it)
+	{
+		this->Finish(*it, SdoTransferResult(it->job.GetNodeId(),
+										it->job.GetIndex(),
+										it->job.GetSubIndex(),
+										0,
+										it->job.GetSdoAccessType(),
+										kSdoComTransferTxAborted,
+										SDO_AC_DATA_NOT_TRANSF_DUE_DEVICE_STATE));
+	}
+	this->queue.clear();
+
+	this->UpdateBusyTime();
+}
+
+void SdoScheduler::ReleaseInFlight()
+{
+	QMutexLocker lock(&this->mutex);
+
+	this->failed += this->inFlight.size();
+	this->inFlight.clear();
+	this->inFlightPerNode.clear();
+	this->inFlightAsnd = 0;
+	this->inFlightUdp = 0;
+
+	this->UpdateBusyTime();
+}
+
+void SdoScheduler::SetMaxTransfersPerNode(const UINT maxTransfers)
+{
+	QMutexLocker lock(&this->mutex);
+	this->maxTransfersPerNode = (maxTransfers > 0) ? maxTransfers : 1;
+	this->IssueTransfers();
+}
+
+UINT SdoScheduler::GetMaxTransfersPerNode() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->maxTransfersPerNode;
+}
+
+void SdoScheduler::SetMaxTransfers(const UINT maxTransfers)
+{
+	QMutexLocker lock(&this->mutex);
+	this->maxTransfers = (maxTransfers > 0) ? maxTransfers : 1;
+	this->IssueTransfers();
+}
+
+UINT SdoScheduler::GetMaxTransfers() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->maxTransfers;
+}
+
+void SdoScheduler::SetRetryPolicy(const SdoRetryPolicy& retryPolicy)
+{
+	QMutexLocker lock(&this->mutex);
+	this->retryPolicy = retryPolicy;
+}
+
+SdoRetryPolicy SdoScheduler::GetRetryPolicy() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->retryPolicy;
+}
+
+void SdoScheduler::SetNodeRetryPolicy(const UINT nodeId,
+						const SdoRetryPolicy& retryPolicy)
+{
+	QMutexLocker lock(&this->mutex);
+	this->nodeRetryPolicies[nodeId] = retryPolicy;
+}
+
+void SdoScheduler::ResetNodeRetryPolicy(const UINT nodeId)
+{
+	QMutexLocker lock(&this->mutex);
+	this->nodeRetryPolicies.erase(nodeId);
+}
+
+SdoSchedulerStatistics SdoScheduler::GetStatistics() const
+{
+	QMutexLocker lock(&this->mutex);
+
+	qint64 busyTime = this->busyTime;
+	if (this->busyTimer.isValid())
+	{
+		busyTime += this->busyTimer.elapsed();
+	}
+
+	const double transfersPerSecond = (busyTime > 0)
+			? ((this->completed + this->failed) * 1000.0 / busyTime) : 0.0;
+
+	return SdoSchedulerStatistics(this->queue.size(),
+								this->peakQueueDepth,
+								this->inFlight.size(),
+								this->completed,
+								this->failed,
+								this->retried,
+								transfersPerSecond);
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+SdoScheduler::SdoScheduler() :
+		QObject(),
+		mutex(),
+		queue(),
+		inFlight(),
+		inFlightPerNode(),
+		inFlightAsnd(0),
+		inFlightUdp(0),
+		maxTransfersPerNode(1),
+		maxTransfers(kMaxSdoConnections),
+		lastTransferId(0),
+		peakQueueDepth(0),
+		completed(0),
+		failed(0),
+		retried(0),
+		retryPolicy(),
+		nodeRetryPolicies(),
+		clock(),
+		timer(),
+		busyTimer(),
+		busyTime(0)
+{
+	/* qRegisterMetaType<T>() is only required for sending the object
+	 * through queued signal/slot connections.
+	 */
+	qRegisterMetaType<SdoTransferResult>("SdoTransferResult");
+	qRegisterMetaType<ULONG>("ULONG");
+	qRegisterMetaType<UINT>("UINT");
+
+	this->clock.start();
+	this->timer.setSingleShot(true);
+
+	bool ret = connect(&(this->timer), SIGNAL(timeout()),
+				this, SLOT(HandleTimeout()));
+	Q_ASSERT(ret != false);
+	Q_UNUSED(ret);
+}
+
+void SdoScheduler::HandleSdoTransferFinished(const ULONG transferId,
+						const SdoTransferResult result)
+{
+	QMutexLocker lock(&this->mutex);
+
+	bool retry = false;
+	UINT backoff = 0;
+	UINT retryCount = 0;
+
+	for (std::list<ScheduledTransfer>::iterator it = this->inFlight.begin();
+		 it != this->inFlight.end(); ++it)
+	{
+		if (it->id == transferId)
+		{
+			ScheduledTransfer transfer = *it;
+			this->inFlight.erase(it);
+			this->UpdateInFlight(transfer, false);
+			// The context is released once the result has been reported.
+			transfer.receiverContext = NULL;
+			retry = this->ScheduleRetry(transfer, result, backoff);
+			retryCount = transfer.retries;
+			if (!retry)
+			{
+				this->Finish(transfer, result);
+			}
+			break;
+		}
+	}
+
+	this->IssueTransfers();
+	this->ArmTimer();
+	this->UpdateBusyTime();
+	lock.unlock();
+
+	if (retry)
+	{
+		emit this->SignalSdoTransferRetry(transferId, result,
+									retryCount, backoff);
+	}
+}
+
+void SdoScheduler::HandleTimeout()
+{
+	QMutexLocker lock(&this->mutex);
+
+	const qint64 now = this->clock.elapsed();
+	for (std::list<ScheduledTransfer>::iterator it = this->inFlight.begin();
+		 it != this->inFlight.end(); ++it)
+	{
+		const UINT attemptTimeout = it->retryPolicy.GetAttemptTimeout();
+		if (it->cancelled || it->timedOut || (attemptTimeout == 0)
+			|| ((now - it->issuedAt) < attemptTimeout))
+		{
+			continue;
+		}
+
+		// The attempt is repeated once the stack reports the abort.
+		tOplkError oplkRet = oplk_abortSdo(it->sdoComConHdl, SDO_AC_TIME_OUT);
+		if (oplkRet != kErrorOk)
+		{
+			qDebug("abortSdo Ret: %d", oplkRet);
+		}
+		it->timedOut = true;
+	}
+
+	this->IssueTransfers();
+	this->ArmTimer();
+}
+
+void SdoScheduler::UpdateTimer()
+{
+	QMutexLocker lock(&this->mutex);
+	this->ArmTimer();
+}
+
+void SdoScheduler::IssueTransfers()
+{
+	const qint64 now = this->clock.elapsed();
+	std::deque<ScheduledTransfer>::iterator it = this->queue.begin();
+	while ((it != this->queue.end())
+		   && (this->inFlight.size() < this->maxTransfers))
+	{
+		if ((it->notBefore > now) || !this->CanIssue(*it))
+		{
+			++it;
+			continue;
+		}
+
+		ReceiverContext* receiverContext = SdoTransferPool::GetInstance().Acquire();
+		if ((receiverContext == NULL) && !this->inFlight.empty())
+		{
+			// Retried once a transfer in flight has returned its context.
+			break;
+		}
+
+		ScheduledTransfer transfer = *it;
+		it = this->queue.erase(it);
+
+		if (receiverContext == NULL)
+		{
+			// The contexts are held by transfers outside of the scheduler.
+			this->Finish(transfer, SdoTransferResult(transfer.job.GetNodeId(),
+								transfer.job.GetIndex(),
+								transfer.job.GetSubIndex(),
+								0,
+								transfer.job.GetSdoAccessType(),
+								kSdoComTransferLowerLayerAbort,
+								SDO_AC_OUT_OF_MEMORY));
+			continue;
+		}
+
+		receiverContext->SetCallback(new ScheduledTransferCallback(*this, transfer.id));
+		receiverContext->Start(transfer.job.GetSdoType());
+		transfer.receiverContext = receiverContext;
+		transfer.issuedAt = now;
+		transfer.timedOut = false;
+		tOplkError oplkRet = kErrorGeneralError;
+		UINT dataSize = transfer.job.GetDataSize();
+		switch (transfer.job.GetSdoAccessType())
+		{
+			case kSdoAccessTypeRead:
+				oplkRet = oplk_readObject(&transfer.sdoComConHdl,
+								transfer.job.GetNodeId(),
+								transfer.job.GetIndex(),
+								transfer.job.GetSubIndex(),
+								transfer.job.GetData(),
+								&dataSize,
+								transfer.job.GetSdoType(),
+								(void*) receiverContext);
+				break;
+			case kSdoAccessTypeWrite:
+				oplkRet = oplk_writeObject(&transfer.sdoComConHdl,
+								transfer.job.GetNodeId(),
+								transfer.job.GetIndex(),
+								transfer.job.GetSubIndex(),
+								transfer.job.GetData(),
+								dataSize,
+								transfer.job.GetSdoType(),
+								(void*) receiverContext);
+				break;
+			default:
+				qDebug("Error Case: SdoScheduler: Invalid access type");
+				break;
+		}
+
+		if (oplkRet == kErrorApiTaskDeferred)
+		{
+			// Remote transfer. The result is reported by the stack.
+			this->inFlight.push_back(transfer);
+			this->UpdateInFlight(transfer, true);
+
+			if (transfer.retryPolicy.GetAttemptTimeout() > 0)
+			{
+				// The timer belongs to the thread of the scheduler.
+				QMetaObject::invokeMethod(this, "UpdateTimer", Qt::QueuedConnection);
+			}
+		}
+		else
+		{
+			SdoTransferPool::GetInstance().Release(receiverContext);
+
+			// Local OD access has finished already; everything else failed.
+			const bool success = (oplkRet == kErrorOk);
+			this->Finish(transfer, SdoTransferResult(transfer.job.GetNodeId(),
+								transfer.job.GetIndex(),
+								transfer.job.GetSubIndex(),
+								success ? dataSize : 0,
+								transfer.job.GetSdoAccessType(),
+								success ? kSdoComTransferFinished : kSdoComTransferLowerLayerAbort,
+								success ? 0 : SDO_AC_GENERAL_ERROR));
+		}
+	}
+}
+
+bool SdoScheduler::CanIssue(const ScheduledTransfer& transfer) const
+{
+	std::map<UINT, UINT>::const_iterator node = this->inFlightPerNode.find(
+												transfer.job.GetNodeId());
+	if ((node != this->inFlightPerNode.end())
+		&& (node->second >= this->maxTransfersPerNode))
+	{
+		return false;
+	}
+
+	if (transfer.job.GetSdoType() == kSdoTypeUdp)
+	{
+		if (this->inFlightUdp >= SDO_MAX_CONNECTION_UDP)
+			return false;
+	}
+	else if (this->inFlightAsnd >= SDO_MAX_CONNECTION_ASND)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+void SdoScheduler::UpdateInFlight(const ScheduledTransfer& transfer,
+								const bool issued)
+{
+	UINT& nodeCount = this->inFlightPerNode[transfer.job.GetNodeId()];
+	UINT& typeCount = (transfer.job.GetSdoType() == kSdoTypeUdp)
+					? this->inFlightUdp : this->inFlightAsnd;
+	if (issued)
+	{
+		++nodeCount;
+		++typeCount;
+	}
+	else
+	{
+		if (nodeCount > 0)
+			--nodeCount;
+		if (typeCount > 0)
+			--typeCount;
+		if (nodeCount == 0)
+			this->inFlightPerNode.erase(transfer.job.GetNodeId());
+	}
+}
+
+void SdoScheduler::Finish(const ScheduledTransfer& transfer,
+						const SdoTransferResult& result)
+{
+	if ((result.GetSdoComConState() == kSdoComTransferFinished)
+		&& (result.GetAbortCode() == 0))
+	{
+		++this->completed;
+	}
+	else
+	{
+		++this->failed;
+	}
+
+	if (transfer.cancelled)
+		return;
+
+	this->Deliver(transfer, result);
+}
+
+void SdoScheduler::Deliver(const ScheduledTransfer& transfer,
+						const SdoTransferResult& result)
+{
+	if (transfer.receiver.isNull())
+	{
+		qDebug("SdoScheduler: Receiver of transfer %lu deleted", transfer.id);
+		return;
+	}
+
+	bool ret = false;
+	if (transfer.receiverFunction.parameterCount() == 2)
+	{
+		// The receiver matches the result by the id of the transfer.
+		ret = transfer.receiverFunction.invoke(
+					transfer.receiver.data(),
+					Qt::QueuedConnection,
+					Q_ARG(ULONG, transfer.id),
+					Q_ARG(SdoTransferResult, result));
+	}
+	else
+	{
+		ret = transfer.receiverFunction.invoke(
+					transfer.receiver.data(),
+					Qt::QueuedConnection,
+					Q_ARG(SdoTransferResult, result));
+	}
+	if (!ret)
+	{
+		qDebug("SdoScheduler: Invoking the receiver function failed");
+	}
+}
+
+bool SdoScheduler::ScheduleRetry(ScheduledTransfer& transfer,
+						const SdoTransferResult& result,
+						UINT& backoff)
+{
+	if (transfer.cancelled
+		|| (transfer.retries >= transfer.retryPolicy.GetMaxRetries())
+		|| !transfer.retryPolicy.IsRetryable(result, transfer.timedOut))
+	{
+		return false;
+	}
+
+	++transfer.retries;
+	++this->retried;
+	backoff = transfer.retryPolicy.GetBackoff(transfer.retries);
+
+	if (transfer.retryPolicy.IsFailoverToUdp()
+		&& (transfer.job.GetSdoType() != kSdoTypeUdp))
+	{
+		transfer.job = SdoTransferJob(transfer.job.GetNodeId(),
+								transfer.job.GetIndex(),
+								transfer.job.GetSubIndex(),
+								transfer.job.GetData(),
+								transfer.job.GetDataSize(),
+								kSdoTypeUdp,
+								transfer.job.GetSdoAccessType());
+	}
+
+	transfer.notBefore = this->clock.elapsed() + backoff;
+	transfer.timedOut = false;
+
+	// Ahead of the transfers queued in the meantime.
+	this->queue.push_front(transfer);
+	return true;
+}
+
+void SdoScheduler::ArmTimer()
+{
+	const qint64 now = this->clock.elapsed();
+	qint64 next = -1;
+
+	for (std::deque<ScheduledTransfer>::const_iterator it = this->queue.begin();
+		 it != this->queue.end(); ++it)
+	{
+		if ((it->notBefore > now) && ((next == -1) || (it->notBefore < next)))
+			next = it->notBefore;
+	}
+
+	for (std::list<ScheduledTransfer>::const_iterator it = this->inFlight.begin();
+		 it != this->inFlight.end(); ++it)
+	{
+		const UINT attemptTimeout = it->retryPolicy.GetAttemptTimeout();
+		if (it->cancelled || it->timedOut || (attemptTimeout == 0))
+			continue;
+
+		const qint64 expiry = it->issuedAt + attemptTimeout;
+		if ((next == -1) || (expiry < next))
+			next = expiry;
+	}
+
+	if (next == -1)
+	{
+		this->timer.stop();
+		return;
+	}
+
+	this->timer.start((next > now) ? (int) (next - now) : 0);
+}
+
+void SdoScheduler::UpdateBusyTime()
+{
+	if (this->queue.empty() && this->inFlight.empty()
+		&& this->busyTimer.isValid())
+	{
+		this->busyTime += this->busyTimer.elapsed();
+		this->busyTimer.invalidate();
+	}
+}
@@ -0,0 +1,150 @@
+/**
+********************************************************************************
+\file   SdoStatistics.cpp
+
+\brief  Implementation of SdoStatistics class
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <algorithm>
+
+#include <QtCore/QMutexLocker>
+
+#include "api/SdoStatistics.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	bool HasHigherAverageLatency(const NodeSdoStatistics& lhs,
+			const NodeSdoStatistics& rhs)
+	{
+		return (lhs.GetAverageLatency() > rhs.GetAverageLatency());
+	}
+
+	bool HasMoreAborts(const NodeSdoStatistics& lhs,
+			const NodeSdoStatistics& rhs)
+	{
+		return (lhs.GetAbortCount() > rhs.GetAbortCount());
+	}
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SdoStatistics& SdoStatistics::GetInstance()
+{
+	// Local static object - Not thread safe
+	static SdoStatistics instance;
+	return instance;
+}
+
+SdoStatistics::SdoStatistics() :
+		mutex(),
+		nodes()
+{
+
+}
+
+void SdoStatistics::Record(const SdoTransferResult& result,
+		tSdoType sdoType,
+		const quint64 latency)
+{
+	QMutexLocker locker(&this->mutex);
+	std::map<UINT, NodeSdoStatistics>::iterator it = this->nodes.find(result.GetNodeId());
+	if (it == this->nodes.end())
+	{
+		it = this->nodes.insert(std::make_pair(result.GetNodeId(),
+						NodeSdoStatistics(result.GetNodeId()))).first;
+	}
+	it->second.Add(result, sdoType, latency);
+}
+
+NodeSdoStatistics SdoStatistics::GetNodeStatistics(const UINT nodeId) const
+{
+	QMutexLocker locker(&this->mutex);
+	std::map<UINT, NodeSdoStatistics>::const_iterator it = this->nodes.find(nodeId);
+	if (it == this->nodes.end())
+		return NodeSdoStatistics(nodeId);
+
+	return it->second;
+}
+
+std::vector<NodeSdoStatistics> SdoStatistics::GetNodeStatistics() const
+{
+	QMutexLocker locker(&this->mutex);
+	std::vector<NodeSdoStatistics> statistics;
+	statistics.reserve(this->nodes.size());
+	for (std::map<UINT, NodeSdoStatistics>::const_iterator it = this->nodes.begin();
+		 it != this->nodes.end(); ++it)
+	{
+		statistics.push_back(it->second);
+	}
+	return statistics;
+}
+
+std::vector<NodeSdoStatistics> SdoStatistics::GetSlowestNodes(const UINT count) const
+{
+	std::vector<NodeSdoStatistics> statistics = this->GetNodeStatistics();
+	std::stable_sort(statistics.begin(), statistics.end(), HasHigherAverageLatency);
+	if (statistics.size() > count)
+	{
+		statistics.resize(count);
+	}
+	return statistics;
+}
+
+std::vector<NodeSdoStatistics> SdoStatistics::GetMostAbortingNodes(const UINT count) const
+{
+	std::vector<NodeSdoStatistics> statistics = this->GetNodeStatistics();
+	std::stable_sort(statistics.begin(), statistics.end(), HasMoreAborts);
+
+	std::vector<NodeSdoStatistics>::iterator it = statistics.begin();
+	while ((it != statistics.end()) && (it->GetAbortCount() > 0))
+	{
+		++it;
+	}
+	statistics.erase(it, statistics.end());
+
+	if (statistics.size() > count)
+	{
+		statistics.resize(count);
+	}
+	return statistics;
+}
+
+void SdoStatistics::Reset()
+{
+	QMutexLocker locker(&this->mutex);
+	this->nodes.clear();
+}
@@ -0,0 +1,137 @@
+/**
+********************************************************************************
+\file   SdoTransferPool.cpp
+
+\brief  Implementation of the pool of SDO transfer contexts
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <cstddef>
+
+#include <QtCore/QtDebug>
+
+#include "api/SdoTransferPool.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SdoTransferPool& SdoTransferPool::GetInstance()
+{
+	// Local static object - Not thread safe
+	static SdoTransferPool instance;
+	return instance;
+}
+
+ReceiverContext* SdoTransferPool::Acquire()
+{
+	QMutexLocker lock(&this->mutex);
+
+	if (this->freeContexts.empty())
+	{
+		++this->exhaustedCount;
+		qDebug("SdoTransferPool: All %u contexts in use", kCapacity);
+		return NULL;
+	}
+
+	const UINT index = this->freeContexts.back();
+	this->freeContexts.pop_back();
+
+	const UINT inUse = kCapacity - this->freeContexts.size();
+	if (inUse > this->highWaterMark)
+	{
+		this->highWaterMark = inUse;
+	}
+
+	return &this->contexts[index];
+}
+
+void SdoTransferPool::Release(ReceiverContext* context)
+{
+	if (context == NULL)
+		return;
+
+	QMutexLocker lock(&this->mutex);
+
+	const std::ptrdiff_t index = context - this->contexts;
+	Q_ASSERT((index >= 0) && (index < (std::ptrdiff_t) kCapacity));
+
+	context->Reset();
+	this->freeContexts.push_back((UINT) index);
+	Q_ASSERT(this->freeContexts.size() <= kCapacity);
+}
+
+void SdoTransferPool::ReleaseAll()
+{
+	QMutexLocker lock(&this->mutex);
+
+	this->freeContexts.clear();
+	for (UINT index = kCapacity; index > 0; --index)
+	{
+		this->contexts[index - 1].Reset();
+		this->freeContexts.push_back(index - 1);
+	}
+}
+
+UINT SdoTransferPool::GetInUse() const
+{
+	QMutexLocker lock(&this->mutex);
+	return kCapacity - this->freeContexts.size();
+}
+
+UINT SdoTransferPool::GetHighWaterMark() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->highWaterMark;
+}
+
+ULONG SdoTransferPool::GetExhaustedCount() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->exhaustedCount;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+SdoTransferPool::SdoTransferPool() :
+		mutex(),
+		contexts(),
+		freeContexts(),
+		highWaterMark(0),
+		exhaustedCount(0)
+{
+	this->freeContexts.reserve(kCapacity);
+	for (UINT index = kCapacity; index > 0; --index)
+	{
+		this->freeContexts.push_back(index - 1);
+	}
+}
@@ -0,0 +1,80 @@
+/**
+********************************************************************************
+\file   ShutdownPhase.cpp
+
+\brief  Implementation of the shutdown phase names
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "api/ShutdownPhase.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+namespace ShutdownPhase
+{
+
+std::string GetShutdownPhaseString(ShutdownPhase phase)
+{
+	std::string phaseString;
+	switch (phase)
+	{
+		case ABORT_TRANSFERS:
+			phaseString = "Abort SDO transfers";
+			break;
+		case SWITCH_OFF:
+			phaseString = "Switch off";
+			break;
+		case STOP_SYNC_THREAD:
+			phaseString = "Stop sync thread";
+			break;
+		case FREE_PI:
+			phaseString = "Free ProcessImage";
+			break;
+		case SHUTDOWN_STACK:
+			phaseString = "Shutdown stack";
+			break;
+		case JOIN_THREADS:
+			phaseString = "Join threads";
+			break;
+		case RELEASE_TRANSFERS:
+			phaseString = "Release SDO transfers";
+			break;
+		case UNDEFINED:
+		default:
+			phaseString = "Undefined";
+	}
+
+	return phaseString;
+}
+
+} // namespace ShutdownPhase
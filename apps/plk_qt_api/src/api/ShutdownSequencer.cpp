@@ -0,0 +1,251 @@
+/**
+********************************************************************************
+\file   ShutdownSequencer.cpp
+
+\brief  Shuts the openPOWERLINK stack down in phases with deadlines
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <iomanip>
+#include <sstream>
+
+#include <QtCore/QtDebug>
+
+#include "api/ShutdownSequencer.h"
+#include "api/OplkQtApi.h"
+#include "api/OplkEventHandler.h"
+#include "api/OplkSyncEventHandler.h"
+#include "api/SdoScheduler.h"
+#include "api/SdoTransferPool.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+ShutdownSequencer::ShutdownSequencer() :
+	timer(),
+	deadline(),
+	phaseStart(),
+	phaseEnd(),
+	timedOut(),
+	failedPhase(ShutdownPhase::UNDEFINED),
+	result(kErrorOk)
+{
+	for (UINT phase = 0; phase < ShutdownSequencer::kNumberOfPhases; ++phase)
+	{
+		this->deadline[phase] = 0;
+		this->phaseStart[phase] = -1;
+		this->phaseEnd[phase] = -1;
+		this->timedOut[phase] = false;
+	}
+
+	this->deadline[ShutdownPhase::SWITCH_OFF] = ShutdownSequencer::kDefaultSwitchOffDeadline;
+	this->deadline[ShutdownPhase::STOP_SYNC_THREAD] = ShutdownSequencer::kDefaultStopSyncDeadline;
+	this->deadline[ShutdownPhase::JOIN_THREADS] = ShutdownSequencer::kDefaultJoinDeadline;
+}
+
+void ShutdownSequencer::SetDeadline(const ShutdownPhase::ShutdownPhase phase,
+							const ULONG deadline)
+{
+	this->deadline[phase] = deadline;
+}
+
+ULONG ShutdownSequencer::GetDeadline(const ShutdownPhase::ShutdownPhase phase) const
+{
+	return this->deadline[phase];
+}
+
+tOplkError ShutdownSequencer::Run()
+{
+	for (UINT phase = 0; phase < ShutdownSequencer::kNumberOfPhases; ++phase)
+	{
+		this->phaseStart[phase] = -1;
+		this->phaseEnd[phase] = -1;
+		this->timedOut[phase] = false;
+	}
+	this->failedPhase = ShutdownPhase::UNDEFINED;
+	this->result = kErrorOk;
+	this->timer.start();
+
+	OplkSyncEventHandler& syncHandler = OplkSyncEventHandler::GetInstance();
+	OplkEventHandler& eventHandler = OplkEventHandler::GetInstance();
+
+	this->BeginPhase(ShutdownPhase::ABORT_TRANSFERS);
+	OplkQtApi::cdcSet = false;
+	// Abort the scheduled SDO transfers while the stack is still running.
+	SdoScheduler::GetInstance().Clear();
+	this->EndPhase(ShutdownPhase::ABORT_TRANSFERS, kErrorOk, false);
+
+	this->BeginPhase(ShutdownPhase::SWITCH_OFF);
+	tOplkError oplkRet = oplk_execNmtCommand(kNmtEventSwitchOff);
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("kNmtEventSwitchOff Ret: %d", oplkRet);
+		this->EndPhase(ShutdownPhase::SWITCH_OFF, oplkRet, false);
+	}
+	else
+	{
+		const bool off = eventHandler.AwaitNmtGsOff(this->deadline[ShutdownPhase::SWITCH_OFF]);
+		this->EndPhase(ShutdownPhase::SWITCH_OFF,
+					off ? kErrorOk : kErrorGeneralError,
+					!off);
+	}
+
+	this->BeginPhase(ShutdownPhase::STOP_SYNC_THREAD);
+	// No exchange with the ProcessImage once it is freed.
+	syncHandler.SetPaused(true);
+	syncHandler.requestInterruption();
+	// A thread blocked in oplk_waitSyncEvent() is joined after the shutdown.
+	const bool syncStopped = syncHandler.wait(this->deadline[ShutdownPhase::STOP_SYNC_THREAD]);
+	this->EndPhase(ShutdownPhase::STOP_SYNC_THREAD, kErrorOk, !syncStopped);
+
+	this->BeginPhase(ShutdownPhase::FREE_PI);
+	oplkRet = kErrorOk;
+	if ((OplkQtApi::allocatedInSize != 0) || (OplkQtApi::allocatedOutSize != 0))
+	{
+		oplkRet = oplk_freeProcessImage();
+		if (oplkRet != kErrorOk)
+			qDebug("freeProcessImage Ret: %d", oplkRet);
+
+		OplkQtApi::allocatedInSize = 0;
+		OplkQtApi::allocatedOutSize = 0;
+	}
+	this->EndPhase(ShutdownPhase::FREE_PI, oplkRet, false);
+
+	this->BeginPhase(ShutdownPhase::SHUTDOWN_STACK);
+	oplkRet = oplk_shutdown();
+	if (oplkRet != kErrorOk)
+		qDebug("shutdown Ret: %d", oplkRet);
+	OplkEventHandler::GetInstance().SetStackInitialised(false);
+	this->EndPhase(ShutdownPhase::SHUTDOWN_STACK, oplkRet, false);
+
+	this->BeginPhase(ShutdownPhase::JOIN_THREADS);
+	QElapsedTimer joinTimer;
+	joinTimer.start();
+	bool joined = syncHandler.wait(this->deadline[ShutdownPhase::JOIN_THREADS]);
+	eventHandler.quit();
+	const qint64 remaining = (qint64) this->deadline[ShutdownPhase::JOIN_THREADS]
+							- joinTimer.elapsed();
+	joined = eventHandler.wait((remaining > 0) ? (ulong) remaining : 0) && joined;
+	this->EndPhase(ShutdownPhase::JOIN_THREADS,
+				joined ? kErrorOk : kErrorGeneralError,
+				!joined);
+
+	this->BeginPhase(ShutdownPhase::RELEASE_TRANSFERS);
+	// The results of the pending transfers will never be reported.
+	SdoTransferPool::GetInstance().ReleaseAll();
+	SdoScheduler::GetInstance().ReleaseInFlight();
+	this->EndPhase(ShutdownPhase::RELEASE_TRANSFERS, kErrorOk, false);
+
+	return this->result;
+}
+
+ShutdownPhase::ShutdownPhase ShutdownSequencer::GetFailedPhase() const
+{
+	return this->failedPhase;
+}
+
+bool ShutdownSequencer::IsTimedOut(const ShutdownPhase::ShutdownPhase phase) const
+{
+	return this->timedOut[phase];
+}
+
+qint64 ShutdownSequencer::GetPhaseDuration(const ShutdownPhase::ShutdownPhase phase) const
+{
+	if (this->phaseEnd[phase] < 0)
+		return -1;
+
+	return (this->phaseEnd[phase] - this->phaseStart[phase]);
+}
+
+qint64 ShutdownSequencer::GetTotalDuration() const
+{
+	qint64 total = 0;
+	for (UINT phase = 0; phase < ShutdownSequencer::kNumberOfPhases; ++phase)
+	{
+		if (this->phaseEnd[phase] > total)
+			total = this->phaseEnd[phase];
+	}
+
+	return total;
+}
+
+std::string ShutdownSequencer::ToString() const
+{
+	std::ostringstream report;
+	report << std::fixed << std::setprecision(3);
+	for (UINT phase = 0; phase < ShutdownSequencer::kNumberOfPhases; ++phase)
+	{
+		if (this->phaseEnd[phase] < 0)
+			continue;
+
+		report << std::left << std::setw(24)
+			   << ShutdownPhase::GetShutdownPhaseString((ShutdownPhase::ShutdownPhase) phase)
+			   << std::right
+			   << " duration: " << std::setw(10)
+			   << ((this->phaseEnd[phase] - this->phaseStart[phase]) / 1000.0) << " ms"
+			   << (this->timedOut[phase] ? " (timed out)" : "")
+			   << std::endl;
+	}
+
+	report << std::left << std::setw(24) << "Total" << std::right
+		   << " duration: " << std::setw(10) << (this->GetTotalDuration() / 1000.0) << " ms"
+		   << std::endl;
+
+	return report.str();
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void ShutdownSequencer::BeginPhase(const ShutdownPhase::ShutdownPhase phase)
+{
+	this->phaseStart[phase] = this->timer.nsecsElapsed() / 1000;
+}
+
+void ShutdownSequencer::EndPhase(const ShutdownPhase::ShutdownPhase phase,
+							const tOplkError oplkRet,
+							const bool timedOut)
+{
+	this->phaseEnd[phase] = this->timer.nsecsElapsed() / 1000;
+	this->timedOut[phase] = timedOut;
+
+	// A sync thread blocked in the stack is only a failure if it cannot be joined later.
+	if (phase == ShutdownPhase::STOP_SYNC_THREAD)
+		return;
+
+	if (((oplkRet != kErrorOk) || timedOut)
+		&& (this->failedPhase == ShutdownPhase::UNDEFINED))
+	{
+		this->failedPhase = phase;
+		this->result = (oplkRet != kErrorOk) ? oplkRet : kErrorGeneralError;
+	}
+}
@@ -0,0 +1,165 @@
+/**
+********************************************************************************
+\file   SignalLatencyMonitor.cpp
+
+\brief  Implementation of SignalLatencyMonitor class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "api/SignalLatencyMonitor.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Interval of the queue depth samples in ms.
+	 */
+	const int kSampleInterval = 100;
+}
+
+QAtomicInt SignalLatencyMonitor::enabled(0);
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SignalLatencyMonitor& SignalLatencyMonitor::GetInstance()
+{
+	// Local static object - Not thread safe
+	static SignalLatencyMonitor instance;
+	return instance;
+}
+
+void SignalLatencyMonitor::Enqueue(const MonitoredSignal::MonitoredSignal signal)
+{
+	// The instance exists once the monitor has been enabled.
+	if (!SignalLatencyMonitor::IsEnabled())
+		return;
+
+	SignalLatencyMonitor& monitor = SignalLatencyMonitor::GetInstance();
+	monitor.pending[signal].fetchAndAddRelaxed(1);
+	QMetaObject::invokeMethod(&monitor, "HandleDispatched", Qt::QueuedConnection,
+						Q_ARG(int, signal),
+						Q_ARG(qint64, monitor.clock.nsecsElapsed()));
+}
+
+void SignalLatencyMonitor::Enable()
+{
+	if (SignalLatencyMonitor::IsEnabled())
+		return;
+
+	this->sampleTimer.start(kSampleInterval);
+	SignalLatencyMonitor::enabled.storeRelease(1);
+}
+
+void SignalLatencyMonitor::Disable()
+{
+	SignalLatencyMonitor::enabled.storeRelease(0);
+	this->sampleTimer.stop();
+}
+
+bool SignalLatencyMonitor::IsEnabled()
+{
+	return (SignalLatencyMonitor::enabled.loadAcquire() != 0);
+}
+
+SignalLatencyStatistics SignalLatencyMonitor::GetStatistics(
+		const MonitoredSignal::MonitoredSignal signal) const
+{
+	QMutexLocker lock(&this->mutex);
+	if (signal >= MonitoredSignal::NUMBER_OF_SIGNALS)
+		return SignalLatencyStatistics();
+
+	return this->statistics[signal];
+}
+
+std::vector<SignalLatencyStatistics> SignalLatencyMonitor::GetStatistics() const
+{
+	QMutexLocker lock(&this->mutex);
+	return this->statistics;
+}
+
+void SignalLatencyMonitor::Reset()
+{
+	QMutexLocker lock(&this->mutex);
+	for (UINT signal = 0; signal < MonitoredSignal::NUMBER_OF_SIGNALS; ++signal)
+	{
+		this->statistics[signal] = SignalLatencyStatistics(
+									(MonitoredSignal::MonitoredSignal) signal);
+	}
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+SignalLatencyMonitor::SignalLatencyMonitor() :
+		QObject(),
+		mutex(),
+		clock(),
+		sampleTimer(this),
+		pending(),
+		statistics()
+{
+	this->clock.start();
+	for (UINT signal = 0; signal < MonitoredSignal::NUMBER_OF_SIGNALS; ++signal)
+	{
+		this->statistics.push_back(SignalLatencyStatistics(
+									(MonitoredSignal::MonitoredSignal) signal));
+	}
+
+	QObject::connect(&this->sampleTimer, SIGNAL(timeout()),
+					 this, SLOT(SampleQueueDepth()));
+}
+
+void SignalLatencyMonitor::HandleDispatched(const int signal, const qint64 enqueued)
+{
+	if ((signal < 0) || (signal >= MonitoredSignal::NUMBER_OF_SIGNALS))
+		return;
+
+	const qint64 latency = (this->clock.nsecsElapsed() - enqueued) / 1000;
+
+	this->pending[signal].fetchAndAddRelaxed(-1);
+
+	QMutexLocker lock(&this->mutex);
+	this->statistics[signal].AddLatency((latency > 0) ? (quint64) latency : 0);
+}
+
+void SignalLatencyMonitor::SampleQueueDepth()
+{
+	QMutexLocker lock(&this->mutex);
+	for (UINT signal = 0; signal < MonitoredSignal::NUMBER_OF_SIGNALS; ++signal)
+	{
+		const int depth = this->pending[signal].load();
+		this->statistics[signal].AddQueueDepth((depth > 0) ? (UINT) depth : 0);
+	}
+}
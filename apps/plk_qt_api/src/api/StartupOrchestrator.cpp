@@ -0,0 +1,255 @@
+/**
+********************************************************************************
+\file   StartupOrchestrator.cpp
+
+\brief  Implementation of the openPOWERLINK stack start-up orchestrator
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <QtCore/QThread>
+#include <QtCore/QtDebug>
+
+#include "api/StartupOrchestrator.h"
+#include "api/OplkQtApi.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Reads and parses the xap.xml in its own thread.
+	 */
+	class XapParserThread : public QThread
+	{
+	public:
+		XapParserThread(const std::string& fileName,
+						ProcessImageParser& parser,
+						PhaseTimingReport& timingReport) :
+			QThread(),
+			fileName(fileName),
+			parser(parser),
+			timingReport(timingReport),
+			errorMessage()
+		{
+		}
+
+		/**
+		 * \return The error message or an empty string on success.
+		 */
+		const std::string& GetErrorMessage() const
+		{
+			return this->errorMessage;
+		}
+
+	protected:
+		void run()
+		{
+			this->timingReport.BeginPhase(StartupPhase::PARSE_XAP);
+			try
+			{
+				std::ifstream ifsXap(this->fileName.c_str());
+				if (!ifsXap)
+				{
+					this->errorMessage = "Unable to open " + this->fileName;
+				}
+				else
+				{
+					std::string xapData((std::istreambuf_iterator<char>(ifsXap)),
+										std::istreambuf_iterator<char>());
+					this->parser.Parse(xapData.c_str());
+				}
+			}
+			catch (const std::exception& ex)
+			{
+				this->errorMessage = ex.what();
+			}
+			this->timingReport.EndPhase(StartupPhase::PARSE_XAP);
+		}
+
+	private:
+		const std::string& fileName;
+		ProcessImageParser& parser;
+		PhaseTimingReport& timingReport;
+		std::string errorMessage;
+
+		XapParserThread(const XapParserThread& rhs);
+		XapParserThread& operator=(const XapParserThread& rhs);
+	};
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+StartupOrchestrator::StartupOrchestrator(
+		const ProcessImageParserType::ProcessImageParserType parserType) :
+	parserType(parserType),
+	parser(NULL),
+	viewBuilderReceiver(NULL),
+	viewBuilderFunction(),
+	failedPhase(StartupPhase::UNDEFINED),
+	parseErrorMessage(),
+	timingReport()
+{
+}
+
+StartupOrchestrator::~StartupOrchestrator()
+{
+	delete this->parser;
+}
+
+bool StartupOrchestrator::SetViewBuilder(QObject& receiver,
+							const QMetaMethod& receiverFunction)
+{
+	if (!receiverFunction.isValid())
+		return false;
+
+	this->viewBuilderReceiver = &receiver;
+	this->viewBuilderFunction = receiverFunction;
+	return true;
+}
+
+tOplkError StartupOrchestrator::Run(const UINT nodeId,
+							const std::string& networkInterface,
+							const std::string& xapFileName,
+							const std::string& cdcFileName)
+{
+	delete this->parser;
+	this->parser = NULL;
+	this->failedPhase = StartupPhase::UNDEFINED;
+	this->parseErrorMessage.clear();
+
+	this->parser = ProcessImageParser::NewInstance(this->parserType);
+	this->timingReport.Start();
+
+	// The xap.xml does not depend on the stack. Parse it meanwhile.
+	XapParserThread xapParser(xapFileName, *(this->parser), this->timingReport);
+	xapParser.start();
+
+	this->timingReport.BeginPhase(StartupPhase::INIT_STACK);
+	tOplkError oplkRet = OplkQtApi::InitStack(nodeId, networkInterface);
+	this->timingReport.EndPhase(StartupPhase::INIT_STACK);
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("InitStack retCode %x", oplkRet);
+		xapParser.wait();
+		this->failedPhase = StartupPhase::INIT_STACK;
+		return oplkRet;
+	}
+
+	this->timingReport.BeginPhase(StartupPhase::SET_CDC);
+	oplkRet = OplkQtApi::SetCdc(cdcFileName);
+	this->timingReport.EndPhase(StartupPhase::SET_CDC);
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("SetCdc retCode %x", oplkRet);
+		xapParser.wait();
+		this->failedPhase = StartupPhase::SET_CDC;
+		OplkQtApi::ShutdownStack();
+		return oplkRet;
+	}
+
+	xapParser.wait();
+	if (!xapParser.GetErrorMessage().empty())
+	{
+		this->parseErrorMessage = xapParser.GetErrorMessage();
+		this->failedPhase = StartupPhase::PARSE_XAP;
+		OplkQtApi::ShutdownStack();
+		return kErrorGeneralError;
+	}
+
+	ProcessImageIn& piIn = static_cast<ProcessImageIn&>(this->parser->GetProcessImage(Direction::PI_IN));
+	ProcessImageOut& piOut = static_cast<ProcessImageOut&>(this->parser->GetProcessImage(Direction::PI_OUT));
+
+	this->timingReport.BeginPhase(StartupPhase::ALLOCATE_PI);
+	oplkRet = OplkQtApi::AllocateProcessImage(piIn, piOut);
+	this->timingReport.EndPhase(StartupPhase::ALLOCATE_PI);
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("AllocateProcessImage retCode %x", oplkRet);
+		this->failedPhase = StartupPhase::ALLOCATE_PI;
+		OplkQtApi::ShutdownStack();
+		return oplkRet;
+	}
+
+	this->timingReport.BeginPhase(StartupPhase::START_STACK);
+	oplkRet = OplkQtApi::StartStack();
+	this->timingReport.EndPhase(StartupPhase::START_STACK);
+	if (oplkRet != kErrorOk)
+	{
+		qDebug("StartStack retCode %x", oplkRet);
+		this->failedPhase = StartupPhase::START_STACK;
+		return oplkRet;
+	}
+
+	// The stack boots up the network in its own threads while the views are built.
+	if (this->viewBuilderReceiver)
+	{
+		ProcessImageIn* inPi = &piIn;
+		ProcessImageOut* outPi = &piOut;
+
+		this->timingReport.BeginPhase(StartupPhase::BUILD_VIEWS);
+		this->viewBuilderFunction.invoke(this->viewBuilderReceiver,
+									Qt::DirectConnection,
+									Q_ARG(ProcessImageIn*, inPi),
+									Q_ARG(ProcessImageOut*, outPi));
+		this->timingReport.EndPhase(StartupPhase::BUILD_VIEWS);
+	}
+
+	return kErrorOk;
+}
+
+StartupPhase::StartupPhase StartupOrchestrator::GetFailedPhase() const
+{
+	return this->failedPhase;
+}
+
+const std::string& StartupOrchestrator::GetParseErrorMessage() const
+{
+	return this->parseErrorMessage;
+}
+
+const PhaseTimingReport& StartupOrchestrator::GetTimingReport() const
+{
+	return this->timingReport;
+}
+
+ProcessImageParser* StartupOrchestrator::ReleaseParser()
+{
+	ProcessImageParser* releasedParser = this->parser;
+	this->parser = NULL;
+	return releasedParser;
+}
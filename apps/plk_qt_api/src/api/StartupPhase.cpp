@@ -0,0 +1,77 @@
+/**
+********************************************************************************
+\file   StartupPhase.cpp
+
+\brief  Implementation of the start-up phase names
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "api/StartupPhase.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+namespace StartupPhase
+{
+
+std::string GetStartupPhaseString(StartupPhase phase)
+{
+	std::string phaseString;
+	switch (phase)
+	{
+		case PARSE_XAP:
+			phaseString = "Parse xap.xml";
+			break;
+		case INIT_STACK:
+			phaseString = "Init stack";
+			break;
+		case SET_CDC:
+			phaseString = "Set CDC";
+			break;
+		case ALLOCATE_PI:
+			phaseString = "Allocate ProcessImage";
+			break;
+		case START_STACK:
+			phaseString = "Start stack";
+			break;
+		case BUILD_VIEWS:
+			phaseString = "Build views";
+			break;
+		case UNDEFINED:
+		default:
+			phaseString = "Undefined";
+	}
+
+	return phaseString;
+}
+
+} // namespace StartupPhase
@@ -73,3 +73,12 @@ XmlParserError::XmlParserError XmlParserException::GetErrorCode() const
 	return this->errCode;
 }
 
+UINT XmlParserException::GetLineNumber() const
+{
+	return this->lineNumber;
+}
+
+UINT XmlParserException::GetColumnNumber() const
+{
+	return this->colNumber;
+}
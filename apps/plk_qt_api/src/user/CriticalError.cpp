@@ -0,0 +1,140 @@
+/**
+********************************************************************************
+\file   CriticalError.cpp
+
+\brief  Typed critical error of the stack.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QDateTime>
+
+#include "user/CriticalError.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+CriticalError::CriticalError() :
+		source(kEventSourceInvalid),
+		oplkError(kErrorOk),
+		originalSource(kEventSourceInvalid),
+		dllState(0),
+		nmtEvent(0),
+		timestamp(0),
+		recoverability(Recoverability::FATAL),
+		message()
+{
+}
+
+CriticalError::CriticalError(const tEventError& error, const QString& message) :
+		source(error.eventSource),
+		oplkError(error.oplkError),
+		originalSource(kEventSourceInvalid),
+		dllState(0),
+		nmtEvent(0),
+		timestamp(QDateTime::currentMSecsSinceEpoch()),
+		recoverability(CriticalError::Classify(error.eventSource, error.oplkError)),
+		message(message)
+{
+	switch (error.eventSource)
+	{
+		case kEventSourceEventk:
+		case kEventSourceEventu:
+			this->originalSource = error.errorArg.eventSource;
+			break;
+
+		case kEventSourceDllk:
+			// The data link layer reports its state and the NMT event in one value.
+			this->dllState = error.errorArg.uintArg & 0xFF;
+			this->nmtEvent = (error.errorArg.uintArg >> 8) & 0xFF;
+			break;
+
+		default:
+			break;
+	}
+}
+
+tEventSource CriticalError::GetSource() const
+{
+	return this->source;
+}
+
+tOplkError CriticalError::GetOplkError() const
+{
+	return this->oplkError;
+}
+
+tEventSource CriticalError::GetOriginalSource() const
+{
+	return this->originalSource;
+}
+
+UINT CriticalError::GetDllState() const
+{
+	return this->dllState;
+}
+
+UINT CriticalError::GetNmtEvent() const
+{
+	return this->nmtEvent;
+}
+
+qint64 CriticalError::GetTimestamp() const
+{
+	return this->timestamp;
+}
+
+Recoverability::Recoverability CriticalError::GetRecoverability() const
+{
+	return this->recoverability;
+}
+
+bool CriticalError::IsRecoverable() const
+{
+	return (this->recoverability != Recoverability::FATAL);
+}
+
+const QString& CriticalError::GetMessage() const
+{
+	return this->message;
+}
+
+Recoverability::Recoverability CriticalError::Classify(const tEventSource source,
+											const tOplkError oplkError)
+{
+	if (oplkError == kErrorNoResource)
+		return Recoverability::FATAL;
+
+	if (source == kEventSourceDllk)
+		return Recoverability::TRANSIENT;
+
+	return Recoverability::RECOVERABLE;
+}
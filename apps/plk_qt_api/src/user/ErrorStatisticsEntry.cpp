@@ -0,0 +1,104 @@
+/**
+********************************************************************************
+\file   ErrorStatisticsEntry.cpp
+
+\brief  Aggregated occurrences of an error code of a node.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/ErrorStatisticsEntry.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+ErrorStatisticsEntry::ErrorStatisticsEntry() :
+		nodeId(0),
+		errorCode(0),
+		count(0),
+		firstOccurrence(0),
+		lastOccurrence(0),
+		rate(0.0),
+		suppressedCount(0)
+{
+}
+
+ErrorStatisticsEntry::ErrorStatisticsEntry(const UINT nodeId,
+		const UINT16 errorCode,
+		const ULONG count,
+		const qint64 firstOccurrence,
+		const qint64 lastOccurrence,
+		const double rate,
+		const ULONG suppressedCount) :
+		nodeId(nodeId),
+		errorCode(errorCode),
+		count(count),
+		firstOccurrence(firstOccurrence),
+		lastOccurrence(lastOccurrence),
+		rate(rate),
+		suppressedCount(suppressedCount)
+{
+}
+
+UINT ErrorStatisticsEntry::GetNodeId() const
+{
+	return this->nodeId;
+}
+
+UINT16 ErrorStatisticsEntry::GetErrorCode() const
+{
+	return this->errorCode;
+}
+
+ULONG ErrorStatisticsEntry::GetCount() const
+{
+	return this->count;
+}
+
+qint64 ErrorStatisticsEntry::GetFirstOccurrence() const
+{
+	return this->firstOccurrence;
+}
+
+qint64 ErrorStatisticsEntry::GetLastOccurrence() const
+{
+	return this->lastOccurrence;
+}
+
+double ErrorStatisticsEntry::GetRate() const
+{
+	return this->rate;
+}
+
+ULONG ErrorStatisticsEntry::GetSuppressedCount() const
+{
+	return this->suppressedCount;
+}
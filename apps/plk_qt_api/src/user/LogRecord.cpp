@@ -0,0 +1,356 @@
+/**
+********************************************************************************
+\file   LogRecord.cpp
+
+\brief  Implementation of LogRecord class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QDateTime>
+#include <oplk/debugstr.h>
+
+#include "user/LogRecord.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	QString GetNodeCommandStr(const UINT32 nodeCommand)
+	{
+		switch (nodeCommand)
+		{
+			case kNmtNodeCommandConfOk:
+				return "ConfOk";
+			case kNmtNodeCommandConfErr:
+				return "ConfErr";
+			case kNmtNodeCommandConfReset:
+				return "ConfReset";
+			case kNmtNodeCommandConfRestored:
+				return "ConfRestored";
+			case kNmtNodeCommandBoot:
+				return "BootCommand";
+			case kNmtNodeCommandSwOk:
+				return "Sw-Ok";
+			case kNmtNodeCommandSwUpdated:
+				return "Sw-Updated";
+			case kNmtNodeCommandStart:
+				return "NodeStart";
+			default:
+				return QString("CfmResult=0x%1")
+						.arg(nodeCommand, 4, 16, QLatin1Char('0'));
+		}
+	}
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+LogCategory::LogCategory LogRecord::GetCategory(
+		const LogRecordType::LogRecordType type)
+{
+	switch (type)
+	{
+		case LogRecordType::NMT_SHUTDOWN:
+		case LogRecordType::NMT_STATE_CHANGE:
+			return LogCategory::NMT;
+
+		case LogRecordType::NODE_CHECK_CONF:
+		case LogRecordType::NODE_UPDATE_CONF:
+		case LogRecordType::NODE_STATE:
+		case LogRecordType::NODE_ERROR:
+			return LogCategory::NODE;
+
+		case LogRecordType::SDO_TRANSFER_FINISHED:
+		case LogRecordType::SDO_TRANSFER_ABORTED:
+			return LogCategory::SDO;
+
+		case LogRecordType::CFM_PROGRESS:
+		case LogRecordType::CFM_PROGRESS_ERROR:
+		case LogRecordType::CFM_RESULT:
+			return LogCategory::CFM;
+
+		case LogRecordType::PDO_CHANGE:
+			return LogCategory::PDO;
+
+		case LogRecordType::HISTORY_ENTRY:
+			return LogCategory::HISTORY;
+
+		case LogRecordType::CRITICAL_ERROR:
+		case LogRecordType::CRITICAL_ERROR_ORG_SOURCE:
+		case LogRecordType::CRITICAL_ERROR_VALUE:
+		case LogRecordType::WARNING:
+		case LogRecordType::ERRORS_SUPPRESSED:
+		case LogRecordType::RECORDS_DROPPED:
+		case LogRecordType::UNDEFINED:
+		default:
+			return LogCategory::WARNING;
+	}
+}
+
+LogSeverity::LogSeverity LogRecord::GetSeverity(
+		const LogRecordType::LogRecordType type)
+{
+	switch (type)
+	{
+		case LogRecordType::CFM_PROGRESS:
+		case LogRecordType::SDO_TRANSFER_FINISHED:
+			return LogSeverity::VERBOSE;
+
+		case LogRecordType::NMT_SHUTDOWN:
+		case LogRecordType::NMT_STATE_CHANGE:
+		case LogRecordType::NODE_CHECK_CONF:
+		case LogRecordType::NODE_UPDATE_CONF:
+		case LogRecordType::NODE_STATE:
+		case LogRecordType::CFM_RESULT:
+		case LogRecordType::PDO_CHANGE:
+			return LogSeverity::INFO;
+
+		case LogRecordType::WARNING:
+		case LogRecordType::HISTORY_ENTRY:
+		case LogRecordType::SDO_TRANSFER_ABORTED:
+		case LogRecordType::ERRORS_SUPPRESSED:
+		case LogRecordType::RECORDS_DROPPED:
+			return LogSeverity::WARNING;
+
+		case LogRecordType::NODE_ERROR:
+		case LogRecordType::CFM_PROGRESS_ERROR:
+			return LogSeverity::FAILURE;
+
+		case LogRecordType::CRITICAL_ERROR:
+		case LogRecordType::CRITICAL_ERROR_ORG_SOURCE:
+		case LogRecordType::CRITICAL_ERROR_VALUE:
+			return LogSeverity::CRITICAL;
+
+		case LogRecordType::UNDEFINED:
+		default:
+			return LogSeverity::VERBOSE;
+	}
+}
+
+LogRecord::LogRecord() :
+		timestamp(0),
+		type(LogRecordType::UNDEFINED),
+		argCount(0),
+		args()
+{
+
+}
+
+LogRecord::LogRecord(const LogRecordType::LogRecordType type) :
+		timestamp(QDateTime::currentMSecsSinceEpoch()),
+		type(type),
+		argCount(0),
+		args()
+{
+
+}
+
+void LogRecord::AddArg(const UINT32 arg)
+{
+	if (this->argCount < LogRecord::kMaxArgs)
+	{
+		this->args[this->argCount] = arg;
+		++this->argCount;
+	}
+}
+
+qint64 LogRecord::GetTimestamp() const
+{
+	return this->timestamp;
+}
+
+LogRecordType::LogRecordType LogRecord::GetType() const
+{
+	return this->type;
+}
+
+LogCategory::LogCategory LogRecord::GetCategory() const
+{
+	return LogRecord::GetCategory(this->type);
+}
+
+LogSeverity::LogSeverity LogRecord::GetSeverity() const
+{
+	return LogRecord::GetSeverity(this->type);
+}
+
+UINT LogRecord::GetArgCount() const
+{
+	return this->argCount;
+}
+
+UINT32 LogRecord::GetArg(const UINT index) const
+{
+	if (index >= this->argCount)
+		return 0;
+
+	return this->args[index];
+}
+
+QString LogRecord::GetMessage() const
+{
+	switch (this->type)
+	{
+		case LogRecordType::NMT_SHUTDOWN:
+			return QString("NMTStateChangeEvent(0x%1) originating event = 0x%2 (%3)")
+				.arg(this->GetArg(0), 0, 16, QLatin1Char('0'))
+				.arg(this->GetArg(1), 0, 16, QLatin1Char('0'))
+				.arg(debugstr_getNmtEventStr((tNmtEvent) this->GetArg(1)));
+
+		case LogRecordType::NMT_STATE_CHANGE:
+			return QString("StateChangeEvent(0x%1) originating event = 0x%2 (%3)")
+				.arg(this->GetArg(0), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'))
+				.arg(debugstr_getNmtEventStr((tNmtEvent) this->GetArg(1)));
+
+		case LogRecordType::CRITICAL_ERROR:
+			return QString("Error source = %1 (0x%2) oplkError = %3 (0x%4)")
+				.arg(debugstr_getEventSourceStr((tEventSource) this->GetArg(0)))
+				.arg(this->GetArg(0), 2, 16, QLatin1Char('0'))
+				.arg(debugstr_getRetValStr((tOplkError) this->GetArg(1)))
+				.arg(this->GetArg(1), 3, 16, QLatin1Char('0'));
+
+		case LogRecordType::CRITICAL_ERROR_ORG_SOURCE:
+			return QString(" OrgSource = %1(0x%2)")
+				.arg(debugstr_getEventSourceStr((tEventSource) this->GetArg(0)))
+				.arg(this->GetArg(0), 2, 16, QLatin1Char('0'));
+
+		case LogRecordType::CRITICAL_ERROR_VALUE:
+			return QString(" val = %1").arg(this->GetArg(0), 0, 16);
+
+		case LogRecordType::WARNING:
+			return QString("Warning: source = %1 (0x%2) oplkError = %3 (0x%4)")
+				.arg(debugstr_getEventSourceStr((tEventSource) this->GetArg(0)))
+				.arg(this->GetArg(0), 2, 16, QLatin1Char('0'))
+				.arg(debugstr_getRetValStr((tOplkError) this->GetArg(1)))
+				.arg(this->GetArg(1), 3, 16, QLatin1Char('0'));
+
+		case LogRecordType::HISTORY_ENTRY:
+			return QString("HistoryEntry: Type=0x%1 Code=0x%2 (0x%3 %4 %5 %6 %7 %8 %9 %10)")
+				.arg(this->GetArg(0), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(2), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(3), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(4), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(5), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(6), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(7), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(8), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(9), 2, 16, QLatin1Char('0'));
+
+		case LogRecordType::NODE_CHECK_CONF:
+			return QString("Node Event: (Node=%1, CheckConf)")
+				.arg(this->GetArg(0));
+
+		case LogRecordType::NODE_UPDATE_CONF:
+			return QString("Node Event: (Node=%1, UpdateConf)")
+				.arg(this->GetArg(0));
+
+		case LogRecordType::NODE_STATE:
+			return QString("Node Event: (Node=%1, State: %2)")
+				.arg(this->GetArg(0))
+				.arg(debugstr_getNmtStateStr((tNmtState) this->GetArg(1)));
+
+		case LogRecordType::NODE_ERROR:
+			return QString("AppCbEvent (Node=%1): Error = %2 (0x%3)")
+				.arg(this->GetArg(0))
+				.arg(debugstr_getEmergErrCodeStr((UINT16) this->GetArg(1)))
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'));
+
+		case LogRecordType::CFM_PROGRESS:
+			return QString("CFM Progress: (Node=%1, CFM-Progress: Object 0x%2/%3,  %4/%5 Bytes")
+				.arg(this->GetArg(0))
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(2))
+				.arg(this->GetArg(3))
+				.arg(this->GetArg(4));
+
+		case LogRecordType::CFM_PROGRESS_ERROR:
+			return QString("	-> SDO Abort=0x%1, Error=0x%2)")
+				.arg(this->GetArg(0), 0, 16, QLatin1Char('0'))
+				.arg(this->GetArg(1), 0, 16, QLatin1Char('0'));
+
+		case LogRecordType::CFM_RESULT:
+			return QString("CFM Result: (Node=%1, %2)")
+				.arg(this->GetArg(0))
+				.arg(GetNodeCommandStr(this->GetArg(1)));
+
+		case LogRecordType::PDO_CHANGE:
+			return QString("PDO change event: (%1PDO = 0x%2 to node 0x%3 with %4 objects %5)")
+				.arg(this->GetArg(0) ? "T" : "R")
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(2), 2, 16, QLatin1Char('0'))
+				.arg(this->GetArg(3))
+				.arg(this->GetArg(4) ? "activated" : "deleted");
+
+		case LogRecordType::SDO_TRANSFER_FINISHED:
+			return QString("SDO transfer finished: (Node=%1, Object 0x%2/%3, %4 Bytes)")
+				.arg(this->GetArg(0))
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(2))
+				.arg(this->GetArg(3));
+
+		case LogRecordType::SDO_TRANSFER_ABORTED:
+			return QString("SDO transfer aborted: (Node=%1, Object 0x%2/%3, Abort=0x%4, %5)")
+				.arg(this->GetArg(0))
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(2))
+				.arg(this->GetArg(3), 8, 16, QLatin1Char('0'))
+				.arg(debugstr_getSdoComConStateStr((tSdoComConState) this->GetArg(4)));
+
+		case LogRecordType::ERRORS_SUPPRESSED:
+			return QString("%3 repeated errors 0x%2 of node %1 not logged")
+				.arg(this->GetArg(0))
+				.arg(this->GetArg(1), 4, 16, QLatin1Char('0'))
+				.arg(this->GetArg(2));
+
+		case LogRecordType::RECORDS_DROPPED:
+			return QString("%1 log records dropped").arg(this->GetArg(0));
+
+		case LogRecordType::UNDEFINED:
+		default:
+			return QString();
+	}
+}
+
+QString LogRecord::ToString() const
+{
+	QString str;
+
+	str.append(QDateTime::fromMSecsSinceEpoch(this->timestamp)
+				.toString("yyyy/MM/dd-hh:mm:ss.zzz"));
+	str.append(" - ");
+	str.append(this->GetMessage());
+
+	return str;
+}
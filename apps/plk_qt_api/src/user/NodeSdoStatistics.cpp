@@ -0,0 +1,168 @@
+/**
+********************************************************************************
+\file   NodeSdoStatistics.cpp
+
+\brief  Implementation of the SDO statistics of a node
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/NodeSdoStatistics.h"
+
+NodeSdoStatistics::NodeSdoStatistics() :
+		nodeId(0),
+		transferCount(0),
+		udpTransferCount(0),
+		abortCount(0),
+		abortCodes(),
+		transferredBytes(0),
+		totalLatency(0),
+		maxLatency(0),
+		latencyHistogram()
+{
+
+}
+
+NodeSdoStatistics::NodeSdoStatistics(const UINT nodeId) :
+		nodeId(nodeId),
+		transferCount(0),
+		udpTransferCount(0),
+		abortCount(0),
+		abortCodes(),
+		transferredBytes(0),
+		totalLatency(0),
+		maxLatency(0),
+		latencyHistogram()
+{
+
+}
+
+void NodeSdoStatistics::Add(const SdoTransferResult& result,
+		tSdoType sdoType,
+		const quint64 latency)
+{
+	++this->transferCount;
+	if (sdoType == kSdoTypeUdp)
+	{
+		++this->udpTransferCount;
+	}
+
+	if ((result.GetSdoComConState() != kSdoComTransferFinished)
+		|| (result.GetAbortCode() != 0))
+	{
+		++this->abortCount;
+		++this->abortCodes[result.GetAbortCode()];
+	}
+
+	this->transferredBytes += result.GetTransferredBytes();
+	this->totalLatency += latency;
+	if (latency > this->maxLatency)
+	{
+		this->maxLatency = latency;
+	}
+
+	UINT bucket = 0;
+	for (quint64 value = latency; (value > 1) && (bucket < (kLatencyBuckets - 1)); value >>= 1)
+	{
+		++bucket;
+	}
+	++this->latencyHistogram[bucket];
+}
+
+UINT NodeSdoStatistics::GetNodeId() const
+{
+	return this->nodeId;
+}
+
+ULONG NodeSdoStatistics::GetTransferCount() const
+{
+	return this->transferCount;
+}
+
+ULONG NodeSdoStatistics::GetUdpTransferCount() const
+{
+	return this->udpTransferCount;
+}
+
+ULONG NodeSdoStatistics::GetAsndTransferCount() const
+{
+	return (this->transferCount - this->udpTransferCount);
+}
+
+ULONG NodeSdoStatistics::GetAbortCount() const
+{
+	return this->abortCount;
+}
+
+const std::map<UINT32, ULONG>& NodeSdoStatistics::GetAbortCodes() const
+{
+	return this->abortCodes;
+}
+
+quint64 NodeSdoStatistics::GetTransferredBytes() const
+{
+	return this->transferredBytes;
+}
+
+quint64 NodeSdoStatistics::GetAverageLatency() const
+{
+	return (this->transferCount > 0) ? (this->totalLatency / this->transferCount) : 0;
+}
+
+quint64 NodeSdoStatistics::GetMaxLatency() const
+{
+	return this->maxLatency;
+}
+
+quint64 NodeSdoStatistics::GetLatencyPercentile(const UINT percent) const
+{
+	if (this->transferCount == 0)
+		return 0;
+
+	// Number of transfers at or below the percentile, rounded up.
+	const quint64 rank = (((quint64) this->transferCount * percent) + 99) / 100;
+	quint64 count = 0;
+	for (UINT bucket = 0; bucket < kLatencyBuckets; ++bucket)
+	{
+		count += this->latencyHistogram[bucket];
+		if ((count >= rank) && (count > 0))
+		{
+			return ((quint64) 2 << bucket) - 1;
+		}
+	}
+
+	return this->maxLatency;
+}
+
+ULONG NodeSdoStatistics::GetLatencyHistogram(const UINT bucket) const
+{
+	return (bucket < kLatencyBuckets) ? this->latencyHistogram[bucket] : 0;
+}
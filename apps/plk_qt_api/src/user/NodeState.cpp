@@ -0,0 +1,103 @@
+/**
+********************************************************************************
+\file   NodeState.cpp
+
+\brief  Implementation of NodeState class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/NodeState.h"
+
+NodeState::NodeState() :
+		nodeId(0),
+		nmtState(kNmtGsOff),
+		lastChange(0),
+		found(false),
+		errorCount(0),
+		lossCount(0),
+		lastErrorCode(0)
+{
+
+}
+
+NodeState::NodeState(const UINT nodeId,
+		const tNmtState nmtState,
+		const qint64 lastChange,
+		const bool found,
+		const UINT errorCount,
+		const UINT lossCount,
+		const UINT16 lastErrorCode) :
+		nodeId(nodeId),
+		nmtState(nmtState),
+		lastChange(lastChange),
+		found(found),
+		errorCount(errorCount),
+		lossCount(lossCount),
+		lastErrorCode(lastErrorCode)
+{
+
+}
+
+UINT NodeState::GetNodeId() const
+{
+	return this->nodeId;
+}
+
+tNmtState NodeState::GetNmtState() const
+{
+	return this->nmtState;
+}
+
+qint64 NodeState::GetLastChange() const
+{
+	return this->lastChange;
+}
+
+bool NodeState::IsFound() const
+{
+	return this->found;
+}
+
+UINT NodeState::GetErrorCount() const
+{
+	return this->errorCount;
+}
+
+UINT NodeState::GetLossCount() const
+{
+	return this->lossCount;
+}
+
+UINT16 NodeState::GetLastErrorCode() const
+{
+	return this->lastErrorCode;
+}
@@ -0,0 +1,109 @@
+/**
+********************************************************************************
+\file   PdoMapping.cpp
+
+\brief  Mapped objects of a PDO of the local node.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/PdoMapping.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+PdoMapping::PdoMapping() :
+		nodeId(0),
+		direction(Direction::UNDEFINED),
+		mappingIndex(0),
+		objects(),
+		readError(kErrorOk)
+{
+}
+
+PdoMapping::PdoMapping(const UINT nodeId,
+		const Direction::Direction direction,
+		const UINT mappingIndex) :
+		nodeId(nodeId),
+		direction(direction),
+		mappingIndex(mappingIndex),
+		objects(),
+		readError(kErrorOk)
+{
+}
+
+void PdoMapping::AddObject(const PdoMappingObject& object)
+{
+	this->objects.push_back(object);
+}
+
+void PdoMapping::SetReadError(const tOplkError error)
+{
+	this->readError = error;
+}
+
+UINT PdoMapping::GetNodeId() const
+{
+	return this->nodeId;
+}
+
+Direction::Direction PdoMapping::GetDirection() const
+{
+	return this->direction;
+}
+
+UINT PdoMapping::GetMappingIndex() const
+{
+	return this->mappingIndex;
+}
+
+const std::vector<PdoMappingObject>& PdoMapping::GetObjects() const
+{
+	return this->objects;
+}
+
+UINT PdoMapping::GetBitSize() const
+{
+	UINT bitSize = 0;
+	for (std::vector<PdoMappingObject>::const_iterator it = this->objects.begin();
+		 it != this->objects.end(); ++it)
+	{
+		const UINT end = it->GetBitOffset() + it->GetBitSize();
+		if (end > bitSize)
+			bitSize = end;
+	}
+	return bitSize;
+}
+
+tOplkError PdoMapping::GetReadError() const
+{
+	return this->readError;
+}
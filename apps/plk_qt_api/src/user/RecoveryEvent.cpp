@@ -0,0 +1,96 @@
+/**
+********************************************************************************
+\file   RecoveryEvent.cpp
+
+\brief  Progress of the recovery from a critical error.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/RecoveryEvent.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+RecoveryEvent::RecoveryEvent() :
+		type(RecoveryEventType::UNDEFINED),
+		error(),
+		action(RecoveryAction::NONE),
+		attempt(0),
+		actionResult(kErrorOk),
+		timeToRecover(0)
+{
+}
+
+RecoveryEvent::RecoveryEvent(const RecoveryEventType::RecoveryEventType type,
+		const CriticalError& error,
+		const RecoveryAction::RecoveryAction action,
+		const UINT attempt,
+		const tOplkError actionResult,
+		const qint64 timeToRecover) :
+		type(type),
+		error(error),
+		action(action),
+		attempt(attempt),
+		actionResult(actionResult),
+		timeToRecover(timeToRecover)
+{
+}
+
+RecoveryEventType::RecoveryEventType RecoveryEvent::GetType() const
+{
+	return this->type;
+}
+
+const CriticalError& RecoveryEvent::GetError() const
+{
+	return this->error;
+}
+
+RecoveryAction::RecoveryAction RecoveryEvent::GetAction() const
+{
+	return this->action;
+}
+
+UINT RecoveryEvent::GetAttempt() const
+{
+	return this->attempt;
+}
+
+tOplkError RecoveryEvent::GetActionResult() const
+{
+	return this->actionResult;
+}
+
+qint64 RecoveryEvent::GetTimeToRecover() const
+{
+	return this->timeToRecover;
+}
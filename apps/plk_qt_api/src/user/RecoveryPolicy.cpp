@@ -0,0 +1,89 @@
+/**
+********************************************************************************
+\file   RecoveryPolicy.cpp
+
+\brief  Escalating actions to recover from a critical error.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/RecoveryPolicy.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+RecoveryPolicy::RecoveryPolicy() :
+		actions(),
+		recoveryTimeout(10000),
+		initialBackoff(500),
+		maxBackoff(8000)
+{
+}
+
+void RecoveryPolicy::AddAction(const RecoveryAction::RecoveryAction action)
+{
+	this->actions.push_back(action);
+}
+
+void RecoveryPolicy::SetRecoveryTimeout(const ULONG recoveryTimeout)
+{
+	this->recoveryTimeout = recoveryTimeout;
+}
+
+void RecoveryPolicy::SetBackoff(const ULONG initialBackoff, const ULONG maxBackoff)
+{
+	this->initialBackoff = initialBackoff;
+	this->maxBackoff = maxBackoff;
+}
+
+const std::vector<RecoveryAction::RecoveryAction>& RecoveryPolicy::GetActions() const
+{
+	return this->actions;
+}
+
+ULONG RecoveryPolicy::GetRecoveryTimeout() const
+{
+	return this->recoveryTimeout;
+}
+
+ULONG RecoveryPolicy::GetBackoff(const UINT attempt) const
+{
+	// The first action is executed immediately.
+	if (attempt == 0)
+		return 0;
+
+	ULONG backoff = this->initialBackoff;
+	for (UINT i = 1; (i < attempt) && (backoff < this->maxBackoff); ++i)
+	{
+		backoff *= 2;
+	}
+	return (backoff < this->maxBackoff) ? backoff : this->maxBackoff;
+}
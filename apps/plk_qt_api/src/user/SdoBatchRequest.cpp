@@ -0,0 +1,105 @@
+/**
+********************************************************************************
+\file   SdoBatchRequest.cpp
+
+\brief  Implementation of a single SDO transfer request of a SDO batch
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/SdoBatchRequest.h"
+
+SdoBatchRequest::SdoBatchRequest(const UINT nodeId,
+		const UINT index,
+		const UINT subIndex,
+		const UINT dataSize,
+		tSdoType sdoType) :
+		nodeId(nodeId),
+		index(index),
+		subIndex(subIndex),
+		dataSize(dataSize),
+		sdoType(sdoType),
+		sdoAccessType(kSdoAccessTypeRead),
+		writeData()
+{
+
+}
+
+SdoBatchRequest::SdoBatchRequest(const UINT nodeId,
+		const UINT index,
+		const UINT subIndex,
+		const std::vector<BYTE>& writeData,
+		tSdoType sdoType) :
+		nodeId(nodeId),
+		index(index),
+		subIndex(subIndex),
+		dataSize(writeData.size()),
+		sdoType(sdoType),
+		sdoAccessType(kSdoAccessTypeWrite),
+		writeData(writeData)
+{
+
+}
+
+UINT SdoBatchRequest::GetNodeId() const
+{
+	return this->nodeId;
+}
+
+UINT SdoBatchRequest::GetIndex() const
+{
+	return this->index;
+}
+
+UINT SdoBatchRequest::GetSubIndex() const
+{
+	return this->subIndex;
+}
+
+UINT SdoBatchRequest::GetDataSize() const
+{
+	return this->dataSize;
+}
+
+tSdoType SdoBatchRequest::GetSdoType() const
+{
+	return this->sdoType;
+}
+
+tSdoAccessType SdoBatchRequest::GetSdoAccessType() const
+{
+	return this->sdoAccessType;
+}
+
+const std::vector<BYTE>& SdoBatchRequest::GetWriteData() const
+{
+	return this->writeData;
+}
@@ -0,0 +1,127 @@
+/**
+********************************************************************************
+\file   SdoRetryPolicy.cpp
+
+\brief  Implementation of the retry, timeout and back-off policy of SDO transfers
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QtGlobal>
+
+#include "user/SdoRetryPolicy.h"
+
+SdoRetryPolicy::SdoRetryPolicy() :
+		maxRetries(0),
+		initialBackoff(0),
+		maxBackoff(0),
+		jitter(0),
+		attemptTimeout(0),
+		failoverToUdp(false)
+{
+
+}
+
+SdoRetryPolicy::SdoRetryPolicy(const UINT maxRetries,
+		const UINT initialBackoff,
+		const UINT maxBackoff,
+		const UINT jitter,
+		const UINT attemptTimeout,
+		const bool failoverToUdp) :
+		maxRetries(maxRetries),
+		initialBackoff(initialBackoff),
+		maxBackoff((maxBackoff > initialBackoff) ? maxBackoff : initialBackoff),
+		jitter((jitter < 100) ? jitter : 100),
+		attemptTimeout(attemptTimeout),
+		failoverToUdp(failoverToUdp)
+{
+
+}
+
+UINT SdoRetryPolicy::GetMaxRetries() const
+{
+	return this->maxRetries;
+}
+
+UINT SdoRetryPolicy::GetInitialBackoff() const
+{
+	return this->initialBackoff;
+}
+
+UINT SdoRetryPolicy::GetMaxBackoff() const
+{
+	return this->maxBackoff;
+}
+
+UINT SdoRetryPolicy::GetJitter() const
+{
+	return this->jitter;
+}
+
+UINT SdoRetryPolicy::GetAttemptTimeout() const
+{
+	return this->attemptTimeout;
+}
+
+bool SdoRetryPolicy::IsFailoverToUdp() const
+{
+	return this->failoverToUdp;
+}
+
+bool SdoRetryPolicy::IsRetryable(const SdoTransferResult& result,
+		const bool timedOut) const
+{
+	return (timedOut
+			|| (result.GetSdoComConState() == kSdoComTransferLowerLayerAbort)
+			|| (result.GetAbortCode() == SDO_AC_TIME_OUT));
+}
+
+UINT SdoRetryPolicy::GetBackoff(const UINT retry) const
+{
+	quint64 backoff = this->initialBackoff;
+	for (UINT i = 1; (i < retry) && (backoff < this->maxBackoff); ++i)
+	{
+		backoff *= 2;
+	}
+	if (backoff > this->maxBackoff)
+	{
+		backoff = this->maxBackoff;
+	}
+
+	// Spread the retries of transfers which failed at the same time.
+	const quint64 range = (backoff * this->jitter) / 100;
+	if (range > 0)
+	{
+		backoff = backoff - range + ((quint64) qrand() % ((2 * range) + 1));
+	}
+
+	return (UINT) backoff;
+}
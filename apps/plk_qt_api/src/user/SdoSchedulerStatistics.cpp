@@ -0,0 +1,103 @@
+/**
+********************************************************************************
+\file   SdoSchedulerStatistics.cpp
+
+\brief  Implementation of the SDO scheduler statistics snapshot
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/SdoSchedulerStatistics.h"
+
+SdoSchedulerStatistics::SdoSchedulerStatistics() :
+		queueDepth(0),
+		peakQueueDepth(0),
+		inFlight(0),
+		completed(0),
+		failed(0),
+		retried(0),
+		transfersPerSecond(0.0)
+{
+
+}
+
+SdoSchedulerStatistics::SdoSchedulerStatistics(const UINT queueDepth,
+		const UINT peakQueueDepth,
+		const UINT inFlight,
+		const ULONG completed,
+		const ULONG failed,
+		const ULONG retried,
+		const double transfersPerSecond) :
+		queueDepth(queueDepth),
+		peakQueueDepth(peakQueueDepth),
+		inFlight(inFlight),
+		completed(completed),
+		failed(failed),
+		retried(retried),
+		transfersPerSecond(transfersPerSecond)
+{
+
+}
+
+UINT SdoSchedulerStatistics::GetQueueDepth() const
+{
+	return this->queueDepth;
+}
+
+UINT SdoSchedulerStatistics::GetPeakQueueDepth() const
+{
+	return this->peakQueueDepth;
+}
+
+UINT SdoSchedulerStatistics::GetInFlight() const
+{
+	return this->inFlight;
+}
+
+ULONG SdoSchedulerStatistics::GetCompleted() const
+{
+	return this->completed;
+}
+
+ULONG SdoSchedulerStatistics::GetFailed() const
+{
+	return this->failed;
+}
+
+ULONG SdoSchedulerStatistics::GetRetried() const
+{
+	return this->retried;
+}
+
+double SdoSchedulerStatistics::GetTransfersPerSecond() const
+{
+	return this->transfersPerSecond;
+}
@@ -0,0 +1,189 @@
+/**
+********************************************************************************
+\file   SignalLatencyStatistics.cpp
+
+\brief  Implementation of SignalLatencyStatistics class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/SignalLatencyStatistics.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	const char* const kSignalNames[MonitoredSignal::NUMBER_OF_SIGNALS] =
+	{
+		"LocalNodeStateChanged",
+		"NodeFound",
+		"NodeStateChanged",
+		"NodeEvents",
+		"PrintLog",
+		"LogRecord",
+		"SdoTransferFinished",
+		"CriticalError",
+		"PdoChanged",
+		"UpdatedOutputValues",
+		"UpdateInputValues",
+		"SyncWaitTimeChanged"
+	};
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SignalLatencyStatistics::SignalLatencyStatistics() :
+		signal(MonitoredSignal::LOCAL_NODE_STATE_CHANGED),
+		count(0),
+		totalLatency(0),
+		maxLatency(0),
+		latencyHistogram(),
+		depthSamples(0),
+		totalDepth(0),
+		depth(0),
+		maxDepth(0)
+{
+
+}
+
+SignalLatencyStatistics::SignalLatencyStatistics(
+		const MonitoredSignal::MonitoredSignal signal) :
+		signal(signal),
+		count(0),
+		totalLatency(0),
+		maxLatency(0),
+		latencyHistogram(),
+		depthSamples(0),
+		totalDepth(0),
+		depth(0),
+		maxDepth(0)
+{
+
+}
+
+void SignalLatencyStatistics::AddLatency(const quint64 latency)
+{
+	++this->count;
+	this->totalLatency += latency;
+	if (latency > this->maxLatency)
+	{
+		this->maxLatency = latency;
+	}
+
+	UINT bucket = 0;
+	for (quint64 value = latency; (value > 1) && (bucket < (kLatencyBuckets - 1)); value >>= 1)
+	{
+		++bucket;
+	}
+	++this->latencyHistogram[bucket];
+}
+
+void SignalLatencyStatistics::AddQueueDepth(const UINT depth)
+{
+	++this->depthSamples;
+	this->totalDepth += depth;
+	this->depth = depth;
+	if (depth > this->maxDepth)
+	{
+		this->maxDepth = depth;
+	}
+}
+
+MonitoredSignal::MonitoredSignal SignalLatencyStatistics::GetSignal() const
+{
+	return this->signal;
+}
+
+QString SignalLatencyStatistics::GetSignalName() const
+{
+	if (this->signal >= MonitoredSignal::NUMBER_OF_SIGNALS)
+		return QString();
+
+	return kSignalNames[this->signal];
+}
+
+ULONG SignalLatencyStatistics::GetCount() const
+{
+	return this->count;
+}
+
+quint64 SignalLatencyStatistics::GetAverageLatency() const
+{
+	return (this->count > 0) ? (this->totalLatency / this->count) : 0;
+}
+
+quint64 SignalLatencyStatistics::GetMaxLatency() const
+{
+	return this->maxLatency;
+}
+
+quint64 SignalLatencyStatistics::GetLatencyPercentile(const UINT percent) const
+{
+	if (this->count == 0)
+		return 0;
+
+	// Number of deliveries at or below the percentile, rounded up.
+	const quint64 rank = (((quint64) this->count * percent) + 99) / 100;
+	quint64 deliveries = 0;
+	for (UINT bucket = 0; bucket < kLatencyBuckets; ++bucket)
+	{
+		deliveries += this->latencyHistogram[bucket];
+		if ((deliveries >= rank) && (deliveries > 0))
+		{
+			return ((quint64) 2 << bucket) - 1;
+		}
+	}
+
+	return this->maxLatency;
+}
+
+ULONG SignalLatencyStatistics::GetLatencyHistogram(const UINT bucket) const
+{
+	return (bucket < kLatencyBuckets) ? this->latencyHistogram[bucket] : 0;
+}
+
+UINT SignalLatencyStatistics::GetQueueDepth() const
+{
+	return this->depth;
+}
+
+UINT SignalLatencyStatistics::GetMaxQueueDepth() const
+{
+	return this->maxDepth;
+}
+
+double SignalLatencyStatistics::GetAverageQueueDepth() const
+{
+	return (this->depthSamples > 0)
+			? ((double) this->totalDepth / this->depthSamples) : 0;
+}
@@ -0,0 +1,101 @@
+/**
+********************************************************************************
+\file   CdcEntry.cpp
+
+\brief  Implementation of the CdcEntry class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <sstream>
+#include <stdexcept>
+
+#include "user/cdc/CdcEntry.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+CdcEntry::CdcEntry(const UINT index,
+		const UINT subIndex,
+		const UINT size,
+		const BYTE* value) :
+		index(index),
+		subIndex(subIndex),
+		size(size),
+		value(value)
+{
+}
+
+UINT CdcEntry::GetIndex() const
+{
+	return this->index;
+}
+
+UINT CdcEntry::GetSubIndex() const
+{
+	return this->subIndex;
+}
+
+UINT CdcEntry::GetSize() const
+{
+	return this->size;
+}
+
+const BYTE* CdcEntry::GetValue() const
+{
+	return this->value;
+}
+
+ULONGLONG CdcEntry::GetUnsignedValue() const
+{
+	if (this->size > sizeof(ULONGLONG))
+	{
+		std::ostringstream msg;
+		msg << "Value of 0x" << std::hex << this->index << "/0x" << this->subIndex;
+		msg << std::dec << " is " << this->size << " bytes long.";
+		throw std::out_of_range(msg.str());
+	}
+
+	ULONGLONG result = 0;
+	for (UINT i = this->size; i > 0; --i)
+	{
+		result = (result << 8) | this->value[i - 1];
+	}
+	return result;
+}
+
+bool CdcEntry::operator<(const CdcEntry& entry) const
+{
+	if (this->index != entry.index)
+		return (this->index < entry.index);
+
+	return (this->subIndex < entry.subIndex);
+}
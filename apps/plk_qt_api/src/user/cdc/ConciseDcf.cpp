@@ -0,0 +1,345 @@
+/**
+********************************************************************************
+\file   ConciseDcf.cpp
+
+\brief  Implementation of the ConciseDcf class which reads the entries of a
+		concise device configuration in place.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include <QtCore/QString>
+
+#include "user/cdc/ConciseDcf.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+static const UINT kEntryCountSize = 4;   ///< Size of the number of entries.
+static const UINT kEntryHeaderSize = 7;  ///< Size of index, sub-index and size of an entry.
+static const UINT kCnConfigurationIndex = 0x1F22;  ///< CFM_ConciseDcfList_ADOM
+
+/*******************************************************************************
+* Module static functions
+*******************************************************************************/
+static UINT ReadUint16(const BYTE* buffer)
+{
+	return ((UINT) buffer[0]) | (((UINT) buffer[1]) << 8);
+}
+
+static UINT ReadUint32(const BYTE* buffer)
+{
+	return ((UINT) buffer[0])
+			| (((UINT) buffer[1]) << 8)
+			| (((UINT) buffer[2]) << 16)
+			| (((UINT) buffer[3]) << 24);
+}
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+ConciseDcf::ConciseDcf() :
+	file(),
+	data(NULL),
+	size(0),
+	nodes()
+{
+}
+
+ConciseDcf::~ConciseDcf()
+{
+	this->Unload();
+}
+
+void ConciseDcf::Load(const std::string& fileName)
+{
+	this->Unload();
+
+	this->file.setFileName(QString::fromStdString(fileName));
+	if (!this->file.open(QIODevice::ReadOnly))
+	{
+		std::ostringstream msg;
+		msg << "CDC file '" << fileName << "' cannot be opened.";
+		throw std::invalid_argument(msg.str());
+	}
+
+	const qint64 fileSize = this->file.size();
+	const BYTE* mapped = NULL;
+	if ((fileSize > 0) && (fileSize <= (qint64) UINT_MAX))
+	{
+		mapped = this->file.map(0, fileSize);
+	}
+
+	if (!mapped)
+	{
+		this->file.close();
+		std::ostringstream msg;
+		msg << "CDC file '" << fileName << "' cannot be mapped.";
+		throw std::invalid_argument(msg.str());
+	}
+
+	try
+	{
+		this->data = mapped;
+		this->size = (UINT) fileSize;
+		this->ParseEntries(this->data, this->size, ConciseDcf::kLocalNodeId);
+	}
+	catch (const std::exception&)
+	{
+		this->Unload();
+		throw;
+	}
+}
+
+void ConciseDcf::Load(const BYTE* cdcBuffer, const UINT size)
+{
+	this->Unload();
+
+	if (!cdcBuffer)
+	{
+		throw std::invalid_argument("CDC buffer is NULL.");
+	}
+
+	try
+	{
+		this->data = cdcBuffer;
+		this->size = size;
+		this->ParseEntries(this->data, this->size, ConciseDcf::kLocalNodeId);
+	}
+	catch (const std::exception&)
+	{
+		this->Unload();
+		throw;
+	}
+}
+
+void ConciseDcf::Unload()
+{
+	this->nodes.clear();
+
+	if (this->file.isOpen())
+	{
+		if (this->data)
+			this->file.unmap((uchar*) this->data);
+		this->file.close();
+	}
+
+	this->data = NULL;
+	this->size = 0;
+}
+
+const BYTE* ConciseDcf::GetData() const
+{
+	return this->data;
+}
+
+UINT ConciseDcf::GetSize() const
+{
+	return this->size;
+}
+
+std::vector<UINT> ConciseDcf::GetNodeIds() const
+{
+	std::vector<UINT> nodeIds;
+	for (std::map<UINT, std::vector<CdcEntry> >::const_iterator it = this->nodes.begin();
+		 it != this->nodes.end(); ++it)
+	{
+		nodeIds.push_back(it->first);
+	}
+	return nodeIds;
+}
+
+const std::vector<CdcEntry>& ConciseDcf::GetEntries(const UINT nodeId) const
+{
+	std::map<UINT, std::vector<CdcEntry> >::const_iterator it = this->nodes.find(nodeId);
+	if (it == this->nodes.end())
+	{
+		std::ostringstream msg;
+		msg << "No CDC entries found for node " << nodeId << ".";
+		throw std::out_of_range(msg.str());
+	}
+	return it->second;
+}
+
+bool ConciseDcf::HasEntry(const UINT nodeId,
+						const UINT index,
+						const UINT subIndex) const
+{
+	std::map<UINT, std::vector<CdcEntry> >::const_iterator it = this->nodes.find(nodeId);
+	if (it == this->nodes.end())
+		return false;
+
+	const CdcEntry key(index, subIndex, 0, NULL);
+	return std::binary_search(it->second.begin(), it->second.end(), key);
+}
+
+const CdcEntry& ConciseDcf::GetEntry(const UINT nodeId,
+									const UINT index,
+									const UINT subIndex) const
+{
+	const std::vector<CdcEntry>& entries = this->GetEntries(nodeId);
+
+	const CdcEntry key(index, subIndex, 0, NULL);
+	std::vector<CdcEntry>::const_iterator it = std::lower_bound(entries.begin(),
+																entries.end(),
+																key);
+	if ((it == entries.end()) || (key < *it))
+	{
+		std::ostringstream msg;
+		msg << "Object 0x" << std::hex << index << "/0x" << subIndex;
+		msg << std::dec << " not found in the CDC of node " << nodeId << ".";
+		throw std::out_of_range(msg.str());
+	}
+	return *it;
+}
+
+ULONG ConciseDcf::GetCycleTime() const
+{
+	return (ULONG) this->GetEntry(ConciseDcf::kLocalNodeId, 0x1006, 0x00).GetUnsignedValue();
+}
+
+std::vector<UINT> ConciseDcf::GetPdoMappingIndices(const UINT nodeId) const
+{
+	std::vector<UINT> mappingIndices;
+
+	std::map<UINT, std::vector<CdcEntry> >::const_iterator node = this->nodes.find(nodeId);
+	if (node == this->nodes.end())
+		return mappingIndices;
+
+	for (std::vector<CdcEntry>::const_iterator it = node->second.begin();
+		 it != node->second.end(); ++it)
+	{
+		const UINT index = it->GetIndex();
+		if ((((index & 0xFF00) == 0x1600) || ((index & 0xFF00) == 0x1A00))
+			&& (mappingIndices.empty() || (mappingIndices.back() != index)))
+		{
+			mappingIndices.push_back(index);
+		}
+	}
+	return mappingIndices;
+}
+
+std::vector<PdoMappingObject> ConciseDcf::GetPdoMapping(const UINT nodeId,
+													const UINT mappingIndex) const
+{
+	std::vector<PdoMappingObject> mapping;
+
+	std::map<UINT, std::vector<CdcEntry> >::const_iterator node = this->nodes.find(nodeId);
+	if (node == this->nodes.end())
+		return mapping;
+
+	// Sub-index 0 holds the number of valid mapping entries.
+	UINT objectCount = 0xFF;
+	if (this->HasEntry(nodeId, mappingIndex, 0x00))
+	{
+		objectCount = (UINT) this->GetEntry(nodeId, mappingIndex, 0x00).GetUnsignedValue();
+	}
+
+	const CdcEntry first(mappingIndex, 0x01, 0, NULL);
+	for (std::vector<CdcEntry>::const_iterator it = std::lower_bound(node->second.begin(),
+																	node->second.end(),
+																	first);
+		 (it != node->second.end()) && (it->GetIndex() == mappingIndex); ++it)
+	{
+		if ((it->GetSubIndex() > objectCount) || (it->GetSize() != sizeof(ULONGLONG)))
+			continue;
+
+		const PdoMappingObject mappedObject(it->GetUnsignedValue());
+		if (mappedObject.IsValid())
+		{
+			mapping.push_back(mappedObject);
+		}
+	}
+	return mapping;
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void ConciseDcf::ParseEntries(const BYTE* buffer, const UINT bufferSize, const UINT nodeId)
+{
+	if (bufferSize < kEntryCountSize)
+	{
+		std::ostringstream msg;
+		msg << "CDC of node " << nodeId << " is too small: " << bufferSize << " bytes.";
+		throw std::out_of_range(msg.str());
+	}
+
+	const UINT entryCount = ReadUint32(buffer);
+	UINT offset = kEntryCountSize;
+
+	// References to map elements stay valid while the CN entries are inserted.
+	std::vector<CdcEntry>& entries = this->nodes[nodeId];
+	entries.reserve(std::min(entryCount, (bufferSize - offset) / kEntryHeaderSize));
+
+	for (UINT entry = 0; entry < entryCount; ++entry)
+	{
+		if ((bufferSize - offset) < kEntryHeaderSize)
+		{
+			std::ostringstream msg;
+			msg << "CDC entry " << entry << " of node " << nodeId;
+			msg << " exceeds the size of the CDC: " << bufferSize << " bytes.";
+			throw std::out_of_range(msg.str());
+		}
+
+		const UINT index = ReadUint16(buffer + offset);
+		const UINT subIndex = buffer[offset + 2];
+		const UINT valueSize = ReadUint32(buffer + offset + 3);
+		offset += kEntryHeaderSize;
+
+		if (valueSize > (bufferSize - offset))
+		{
+			std::ostringstream msg;
+			msg << "Value of 0x" << std::hex << index << "/0x" << subIndex;
+			msg << std::dec << " of node " << nodeId;
+			msg << " exceeds the size of the CDC: " << bufferSize << " bytes.";
+			throw std::out_of_range(msg.str());
+		}
+
+		entries.push_back(CdcEntry(index, subIndex, valueSize, buffer + offset));
+
+		// The configuration of each CN is a nested CDC.
+		if ((nodeId == ConciseDcf::kLocalNodeId)
+			&& (index == kCnConfigurationIndex)
+			&& (valueSize >= kEntryCountSize))
+		{
+			this->ParseEntries(buffer + offset, valueSize, subIndex);
+		}
+
+		offset += valueSize;
+	}
+
+	std::stable_sort(entries.begin(), entries.end());
+}
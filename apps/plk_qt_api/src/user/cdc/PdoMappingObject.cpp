@@ -0,0 +1,74 @@
+/**
+********************************************************************************
+\file   PdoMappingObject.cpp
+
+\brief  Implementation of the PdoMappingObject class.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/cdc/PdoMappingObject.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+PdoMappingObject::PdoMappingObject(const ULONGLONG mappingEntry) :
+		index((UINT) (mappingEntry & 0xFFFFULL)),
+		subIndex((UINT) ((mappingEntry >> 16) & 0xFFULL)),
+		bitOffset((UINT) ((mappingEntry >> 32) & 0xFFFFULL)),
+		bitSize((UINT) ((mappingEntry >> 48) & 0xFFFFULL))
+{
+}
+
+UINT PdoMappingObject::GetIndex() const
+{
+	return this->index;
+}
+
+UINT PdoMappingObject::GetSubIndex() const
+{
+	return this->subIndex;
+}
+
+UINT PdoMappingObject::GetBitOffset() const
+{
+	return this->bitOffset;
+}
+
+UINT PdoMappingObject::GetBitSize() const
+{
+	return this->bitSize;
+}
+
+bool PdoMappingObject::IsValid() const
+{
+	return (this->bitSize != 0);
+}
@@ -88,3 +88,12 @@ Direction::Direction Channel::GetDirection() const
 	return this->direction;
 }
 
+bool Channel::operator==(const Channel& channel) const
+{
+	return ((this->name == channel.name)
+			&& (this->dataType == channel.dataType)
+			&& (this->byteOffset == channel.byteOffset)
+			&& (this->bitOffset == channel.bitOffset)
+			&& (this->bitSize == channel.bitSize)
+			&& (this->direction == channel.direction));
+}
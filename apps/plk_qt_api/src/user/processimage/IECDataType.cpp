@@ -35,8 +35,53 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*******************************************************************************
 * INCLUDES
 *******************************************************************************/
+#include <cstring>
+
 #include "user/processimage/IECDataType.h"
-#include "common/Utility.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	const size_t kMaxTypeNameLength = 15;  ///< Longest name is "VISIBLE_STRING".
+
+	/**
+	 * \brief Properties of the IECDataTypes. Indexed by IECDataType::IECDataType.
+	 */
+	const IECDataType::IECDataTypeInfo kIECDataTypeInfo[] =
+	{
+		// bitSize, isSigned, alignment, hexWidth
+		{  0, false,  8,  0 },  // UNDEFINED
+		{  1, false,  1,  1 },  // IEC_BOOL
+		{  8, false,  8,  2 },  // IEC_BYTE
+		{  8, false,  8,  2 },  // IEC_CHAR
+		{ 16, false, 16,  4 },  // IEC_WORD
+		{ 32, false, 32,  8 },  // IEC_DWORD
+		{ 64, false, 64, 16 },  // IEC_LWORD
+		{  8, true,   8,  2 },  // IEC_SINT
+		{ 16, true,  16,  4 },  // IEC_INT
+		{ 32, true,  32,  8 },  // IEC_DINT
+		{ 64, true,  64, 16 },  // IEC_LINT
+		{  8, false,  8,  2 },  // IEC_USINT
+		{ 16, false, 16,  4 },  // IEC_UINT
+		{ 32, false, 32,  8 },  // IEC_UDINT
+		{ 64, false, 64, 16 },  // IEC_ULINT
+		{ 32, true,  32,  8 },  // IEC_REAL
+		{ 64, true,  64, 16 },  // IEC_LREAL
+		{  0, false,  8,  0 },  // IEC_STRING
+		{  0, false, 16,  0 }   // IEC_WSTRING
+	};
+
+	// Compile time check that the table covers all the IECDataTypes.
+	typedef char IECDataTypeInfoSizeCheck[
+		((sizeof(kIECDataTypeInfo) / sizeof(kIECDataTypeInfo[0])) == (IECDataType::IEC_WSTRING + 1)) ? 1 : -1];
+
+	bool Equals(const char* name, const char* upperName)
+	{
+		return (std::strcmp(name, upperName) == 0);
+	}
+}
 
 /*******************************************************************************
 * Public functions
@@ -46,99 +91,185 @@ namespace IECDataType
 
 IECDataType GetIECDatatype(const std::string& iecDataTypeStr)
 {
-	IECDataType iecDataType = UNDEFINED;
+	const size_t length = iecDataTypeStr.length();
+	if ((length == 0) || (length > kMaxTypeNameLength))
+		return UNDEFINED;
 
-	if (CompareCaseInsensitive("BOOL", iecDataTypeStr)
-		|| CompareCaseInsensitive("Boolean", iecDataTypeStr)
-		|| CompareCaseInsensitive("BITSTRING", iecDataTypeStr))
-	{
-		iecDataType = IEC_BOOL;
-	}
-	else if (CompareCaseInsensitive("BYTE", iecDataTypeStr))
-	{
-		iecDataType = IEC_BYTE;
-	}
-	else if (CompareCaseInsensitive("CHAR", iecDataTypeStr))
-	{
-		iecDataType = IEC_CHAR;
-	}
-	else if (CompareCaseInsensitive("WORD", iecDataTypeStr))
-	{
-		iecDataType = IEC_WORD;
-	}
-	else if (CompareCaseInsensitive("DWORD", iecDataTypeStr))
-	{
-		iecDataType = IEC_DWORD;
-	}
-	else if (CompareCaseInsensitive("LWORD", iecDataTypeStr))
-	{
-		iecDataType = IEC_LWORD;
-	}
-	else if (CompareCaseInsensitive("SINT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Integer8", iecDataTypeStr))
-	{
-		iecDataType = IEC_SINT;
-	}
-	else if (CompareCaseInsensitive("INT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Integer16", iecDataTypeStr))
-	{
-		iecDataType = IEC_INT;
-	}
-	else if (CompareCaseInsensitive("DINT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Integer32", iecDataTypeStr))
-	{
-		iecDataType = IEC_DINT;
-	}
-	else if (CompareCaseInsensitive("LINT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Integer64", iecDataTypeStr))
+	// ASCII upper case copy. Avoids the locale dependent std::toupper.
+	char name[kMaxTypeNameLength + 1];
+	for (size_t i = 0; i < length; ++i)
 	{
-		iecDataType = IEC_LINT;
+		const char c = iecDataTypeStr[i];
+		name[i] = ((c >= 'a') && (c <= 'z')) ? (char) (c - ('a' - 'A')) : c;
 	}
-	else if (CompareCaseInsensitive("USINT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Unsigned8", iecDataTypeStr))
-	{
-		iecDataType = IEC_USINT;
-	}
-	else if (CompareCaseInsensitive("UINT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Unsigned16", iecDataTypeStr))
-	{
-		iecDataType = IEC_UINT;
-	}
-	else if (CompareCaseInsensitive("UDINT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Unsigned32", iecDataTypeStr))
-	{
-		iecDataType = IEC_UDINT;
-	}
-	else if (CompareCaseInsensitive("ULINT", iecDataTypeStr)
-			|| CompareCaseInsensitive("Unsigned64", iecDataTypeStr))
-	{
-		iecDataType = IEC_ULINT;
-	}
-	else if (CompareCaseInsensitive("REAL", iecDataTypeStr)
-			|| CompareCaseInsensitive("REAL32", iecDataTypeStr))
-	{
-		iecDataType = IEC_REAL;
-	}
-	else if (CompareCaseInsensitive("LREAL", iecDataTypeStr)
-			|| CompareCaseInsensitive("REAL64", iecDataTypeStr))
-	{
-		iecDataType = IEC_LREAL;
-	}
-	else if (CompareCaseInsensitive("STRING", iecDataTypeStr)
-			|| CompareCaseInsensitive("VISIBLE_STRING", iecDataTypeStr))
-	{
-		iecDataType = IEC_STRING;
-	}
-	else if (CompareCaseInsensitive("WSTRING", iecDataTypeStr))
-	{
-		iecDataType = IEC_WSTRING;
-	}
-	else
+	name[length] = '\0';
+
+	switch (length)
 	{
-		// UnHandled DataType;
+		case 3:
+			if (Equals(name, "INT"))
+				return IEC_INT;
+			break;
+
+		case 4:
+			switch (name[0])
+			{
+				case 'B':
+					if (Equals(name, "BOOL"))
+						return IEC_BOOL;
+					if (Equals(name, "BYTE"))
+						return IEC_BYTE;
+					break;
+				case 'C':
+					if (Equals(name, "CHAR"))
+						return IEC_CHAR;
+					break;
+				case 'W':
+					if (Equals(name, "WORD"))
+						return IEC_WORD;
+					break;
+				case 'S':
+					if (Equals(name, "SINT"))
+						return IEC_SINT;
+					break;
+				case 'D':
+					if (Equals(name, "DINT"))
+						return IEC_DINT;
+					break;
+				case 'L':
+					if (Equals(name, "LINT"))
+						return IEC_LINT;
+					break;
+				case 'U':
+					if (Equals(name, "UINT"))
+						return IEC_UINT;
+					break;
+				case 'R':
+					if (Equals(name, "REAL"))
+						return IEC_REAL;
+					break;
+				default:
+					break;
+			}
+			break;
+
+		case 5:
+			switch (name[0])
+			{
+				case 'D':
+					if (Equals(name, "DWORD"))
+						return IEC_DWORD;
+					break;
+				case 'L':
+					if (Equals(name, "LWORD"))
+						return IEC_LWORD;
+					if (Equals(name, "LREAL"))
+						return IEC_LREAL;
+					break;
+				case 'U':
+					if (Equals(name, "USINT"))
+						return IEC_USINT;
+					if (Equals(name, "UDINT"))
+						return IEC_UDINT;
+					if (Equals(name, "ULINT"))
+						return IEC_ULINT;
+					break;
+				default:
+					break;
+			}
+			break;
+
+		case 6:
+			switch (name[0])
+			{
+				case 'R':
+					if (Equals(name, "REAL32"))
+						return IEC_REAL;
+					if (Equals(name, "REAL64"))
+						return IEC_LREAL;
+					break;
+				case 'S':
+					if (Equals(name, "STRING"))
+						return IEC_STRING;
+					break;
+				default:
+					break;
+			}
+			break;
+
+		case 7:
+			switch (name[0])
+			{
+				case 'B':
+					if (Equals(name, "BOOLEAN"))
+						return IEC_BOOL;
+					break;
+				case 'W':
+					if (Equals(name, "WSTRING"))
+						return IEC_WSTRING;
+					break;
+				default:
+					break;
+			}
+			break;
+
+		case 8:
+			if (Equals(name, "INTEGER8"))
+				return IEC_SINT;
+			break;
+
+		case 9:
+			switch (name[0])
+			{
+				case 'B':
+					if (Equals(name, "BITSTRING"))
+						return IEC_BOOL;
+					break;
+				case 'I':
+					if (Equals(name, "INTEGER16"))
+						return IEC_INT;
+					if (Equals(name, "INTEGER32"))
+						return IEC_DINT;
+					if (Equals(name, "INTEGER64"))
+						return IEC_LINT;
+					break;
+				case 'U':
+					if (Equals(name, "UNSIGNED8"))
+						return IEC_USINT;
+					break;
+				default:
+					break;
+			}
+			break;
+
+		case 10:
+			if (Equals(name, "UNSIGNED16"))
+				return IEC_UINT;
+			if (Equals(name, "UNSIGNED32"))
+				return IEC_UDINT;
+			if (Equals(name, "UNSIGNED64"))
+				return IEC_ULINT;
+			break;
+
+		case 14:
+			if (Equals(name, "VISIBLE_STRING"))
+				return IEC_STRING;
+			break;
+
+		default:
+			break;
 	}
 
-	return iecDataType;
+	// UnHandled DataType;
+	return UNDEFINED;
 } // GetIecDataType
 
+const IECDataTypeInfo& GetIECDataTypeInfo(IECDataType iecDataType)
+{
+	if ((iecDataType < UNDEFINED) || (iecDataType > IEC_WSTRING))
+		return kIECDataTypeInfo[UNDEFINED];
+
+	return kIECDataTypeInfo[iecDataType];
+}
+
 } // namespace IECDataType
@@ -39,10 +39,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sstream>
 #include <stdexcept>
 #include <bitset>
+#include <algorithm>
 
 #include "user/processimage/ProcessImage.h"
 
 #include <oplk/oplkinc.h>
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	bool CompareChannelName(const Channel& lhs, const Channel& rhs)
+	{
+		return (lhs.GetName() < rhs.GetName());
+	}
+}
+
 /*******************************************************************************
 * Public functions
 *******************************************************************************/
@@ -164,6 +177,40 @@ bool ProcessImage::AddChannel(const Channel& channel)
 	return this->AddChannelInternal(channel);
 }
 
+UINT ProcessImage::AddChannels(std::vector<Channel>& channels)
+{
+	std::stable_sort(channels.begin(), channels.end(), CompareChannelName);
+
+	const Direction::Direction direction = this->GetDirection();
+	UINT added = 0;
+	for (std::vector<Channel>::const_iterator it = channels.begin();
+		 it != channels.end(); ++it)
+	{
+		if (it->GetDirection() != direction)
+			continue;
+
+		const std::size_t count = this->channels.size();
+		this->channels.insert(this->channels.end(),
+				std::pair<std::string, Channel>(it->GetName(), *it));
+		if (this->channels.size() != count)
+			++added;
+	}
+
+	return added;
+}
+
+void ProcessImage::Swap(ProcessImage& processImage)
+{
+	if (processImage.GetDirection() != this->GetDirection())
+	{
+		throw std::invalid_argument("ProcessImage direction mismatch");
+	}
+
+	std::swap(this->byteSize, processImage.byteSize);
+	std::swap(this->data, processImage.data);
+	this->channels.swap(processImage.channels);
+}
+
 std::vector<BYTE> ProcessImage::GetRawValue(const std::string& channelName) const
 {
 	Channel channel = this->GetChannel(channelName);
@@ -0,0 +1,115 @@
+/**
+********************************************************************************
+\file   ProcessImageDiff.cpp
+
+\brief  Implementation of the ProcessImageDiff class which compares the
+		channel tables of two ProcessImages.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "user/processimage/ProcessImageDiff.h"
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+ProcessImageDiff::ProcessImageDiff(const ProcessImage& oldPi,
+		const ProcessImage& newPi) :
+		addedChannels(),
+		removedChannels(),
+		changedChannels(),
+		sizeChanged(oldPi.GetSize() != newPi.GetSize())
+{
+	std::map<std::string, Channel>::const_iterator oldIt = oldPi.cbegin();
+	std::map<std::string, Channel>::const_iterator newIt = newPi.cbegin();
+
+	// Both channel tables are sorted by name. Walk them side by side.
+	while ((oldIt != oldPi.cend()) && (newIt != newPi.cend()))
+	{
+		if (oldIt->first < newIt->first)
+		{
+			this->removedChannels.push_back(oldIt->second);
+			++oldIt;
+		}
+		else if (newIt->first < oldIt->first)
+		{
+			this->addedChannels.push_back(newIt->second);
+			++newIt;
+		}
+		else
+		{
+			if (!(oldIt->second == newIt->second))
+			{
+				this->changedChannels.push_back(newIt->second);
+			}
+			++oldIt;
+			++newIt;
+		}
+	}
+
+	for (; oldIt != oldPi.cend(); ++oldIt)
+	{
+		this->removedChannels.push_back(oldIt->second);
+	}
+
+	for (; newIt != newPi.cend(); ++newIt)
+	{
+		this->addedChannels.push_back(newIt->second);
+	}
+}
+
+const std::vector<Channel>& ProcessImageDiff::GetAddedChannels() const
+{
+	return this->addedChannels;
+}
+
+const std::vector<Channel>& ProcessImageDiff::GetRemovedChannels() const
+{
+	return this->removedChannels;
+}
+
+const std::vector<Channel>& ProcessImageDiff::GetChangedChannels() const
+{
+	return this->changedChannels;
+}
+
+bool ProcessImageDiff::IsSizeChanged() const
+{
+	return this->sizeChanged;
+}
+
+bool ProcessImageDiff::IsEmpty() const
+{
+	return (!this->sizeChanged
+			&& this->addedChannels.empty()
+			&& this->removedChannels.empty()
+			&& this->changedChannels.empty());
+}
@@ -56,6 +56,11 @@ ProcessImageIn::ProcessImageIn(const UINT byteSize,
 
 }
 
+Direction::Direction ProcessImageIn::GetDirection() const
+{
+	return Direction::PI_IN;
+}
+
 bool ProcessImageIn::AddChannelInternal(const Channel& channel)
 {
 	if (channel.GetDirection() == Direction::PI_IN)
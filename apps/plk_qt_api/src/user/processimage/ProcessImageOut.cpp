@@ -52,6 +52,11 @@ ProcessImageOut::ProcessImageOut(const UINT byteSize,
 
 }
 
+Direction::Direction ProcessImageOut::GetDirection() const
+{
+	return Direction::PI_OUT;
+}
+
 /*******************************************************************************
 * Private functions
 *******************************************************************************/
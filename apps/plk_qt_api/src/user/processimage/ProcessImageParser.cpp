@@ -40,6 +40,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "user/processimage/ProcessImageParser.h"
 #include "user/processimage/QtProcessImageParser.h"
+#include "user/processimage/QtParallelProcessImageParser.h"
 
 /*******************************************************************************
 * Static member variables
@@ -91,6 +92,14 @@ const std::string ProcessImageParser::processImage_attribute_type_invalid_value
 		ProcessImageParser::processImage_element_name + "attribute '" +
 		ProcessImageParser::processImage_attribute_Type + "' has invalid value";
 
+const std::string ProcessImageParser::channel_attribute_dataType_invalid_value =
+		ProcessImageParser::channel_element_name + "attribute '" +
+		ProcessImageParser::channel_attribute_dataType + "' has invalid value";
+
+const std::string ProcessImageParser::channel_attribute_bitSize_invalid_value =
+		ProcessImageParser::channel_element_name + "attribute '" +
+		ProcessImageParser::channel_attribute_bitSize + "' does not match the dataType";
+
 /*******************************************************************************
 * Public functions
 *******************************************************************************/
@@ -106,6 +115,10 @@ ProcessImageParser* ProcessImageParser::NewInstance(
 	{
 		return (new QtProcessImageParser());
 	}
+	else if (type == ProcessImageParserType::QT_XML_PARALLEL_PARSER)
+	{
+		return (new QtParallelProcessImageParser());
+	}
 	else
 	{
 		std::ostringstream message;
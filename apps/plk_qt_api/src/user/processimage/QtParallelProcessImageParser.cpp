@@ -0,0 +1,306 @@
+/**
+********************************************************************************
+\file   QtParallelProcessImageParser.cpp
+
+\brief  Implementation of a process image parser which parses the input and
+		output process images concurrently
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <stdexcept>
+
+#include <QThread>
+
+#include "user/processimage/QtParallelProcessImageParser.h"
+#include "common/XmlParserException.h"
+
+/*******************************************************************************
+* Module global variables
+*******************************************************************************/
+namespace
+{
+	/**
+	 * \brief Parses the xml description with all but one ProcessImage
+	 * section blanked out.
+	 */
+	class SectionParser : public QThread
+	{
+	public:
+		SectionParser(const std::string& document,
+					const std::vector<QtParallelProcessImageParser::Section>& sections,
+					const std::size_t sectionIndex) :
+			QThread(),
+			document(document),
+			sections(sections),
+			sectionIndex(sectionIndex),
+			parser(ProcessImageParser::NewInstance(
+					ProcessImageParserType::QT_XML_PARSER)),
+			error(NULL)
+		{
+		}
+
+		~SectionParser()
+		{
+			delete this->parser;
+			delete this->error;
+		}
+
+		/**
+		 * \brief Parses the section in the calling thread.
+		 */
+		void Parse()
+		{
+			std::string text(this->document);
+			for (std::size_t i = 0; i < this->sections.size(); ++i)
+			{
+				if (i == this->sectionIndex)
+					continue;
+
+				// Keep the line breaks to preserve the line and column numbers.
+				for (std::size_t pos = this->sections[i].begin;
+					 pos < this->sections[i].end; ++pos)
+				{
+					if ((text[pos] != '\n') && (text[pos] != '\r'))
+						text[pos] = ' ';
+				}
+			}
+
+			try
+			{
+				this->parser->Parse(text.c_str());
+			}
+			catch (const XmlParserException& ex)
+			{
+				this->error = new XmlParserException(ex);
+			}
+			catch (const std::exception& ex)
+			{
+				this->error = new XmlParserException(ex.what(),
+										XmlParserError::UNDEFINED, 0, 0);
+			}
+		}
+
+		ProcessImageParser& GetParser()
+		{
+			return *(this->parser);
+		}
+
+		const XmlParserException* GetError() const
+		{
+			return this->error;
+		}
+
+	protected:
+		void run()
+		{
+			this->Parse();
+		}
+
+	private:
+		const std::string& document;
+		const std::vector<QtParallelProcessImageParser::Section>& sections;
+		const std::size_t sectionIndex;
+		ProcessImageParser* parser;
+		XmlParserException* error;
+
+		SectionParser(const SectionParser& rhs);
+		SectionParser& operator=(const SectionParser& rhs);
+	};
+
+	/**
+	 * \brief Owns the section parsers for the duration of a parse.
+	 */
+	class SectionParserList
+	{
+	public:
+		SectionParserList() :
+			parsers()
+		{
+		}
+
+		~SectionParserList()
+		{
+			for (std::vector<SectionParser*>::iterator it = this->parsers.begin();
+				 it != this->parsers.end(); ++it)
+			{
+				(*it)->wait();
+				delete (*it);
+			}
+		}
+
+		std::vector<SectionParser*> parsers;
+
+	private:
+		SectionParserList(const SectionParserList& rhs);
+		SectionParserList& operator=(const SectionParserList& rhs);
+	};
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void QtParallelProcessImageParser::ParseInternal(const char* xmlDescription)
+{
+	if (!xmlDescription)
+	{
+		throw std::invalid_argument("Invalid xml file buffer");
+	}
+
+	const std::string document(xmlDescription);
+	std::vector<Section> sections;
+	if (!QtParallelProcessImageParser::FindSections(document, sections)
+		|| (sections.size() < 2))
+	{
+		sections.clear();
+	}
+
+	SectionParserList workers;
+	workers.parsers.push_back(new SectionParser(document, sections, 0));
+	for (std::size_t i = 1; i < sections.size(); ++i)
+	{
+		workers.parsers.push_back(new SectionParser(document, sections, i));
+		workers.parsers.back()->start();
+	}
+
+	// The first section is parsed by the calling thread.
+	workers.parsers.front()->Parse();
+
+	const XmlParserException* firstError = NULL;
+	for (std::vector<SectionParser*>::const_iterator it = workers.parsers.begin();
+		 it != workers.parsers.end(); ++it)
+	{
+		(*it)->wait();
+
+		const XmlParserException* error = (*it)->GetError();
+		if (error && (!firstError
+				|| (error->GetLineNumber() < firstError->GetLineNumber())
+				|| ((error->GetLineNumber() == firstError->GetLineNumber())
+					&& (error->GetColumnNumber() < firstError->GetColumnNumber()))))
+		{
+			firstError = error;
+		}
+	}
+
+	if (firstError)
+	{
+		throw XmlParserException(*firstError);
+	}
+
+	const Direction::Direction directions[] = {Direction::PI_IN, Direction::PI_OUT};
+	for (std::vector<SectionParser*>::const_iterator it = workers.parsers.begin();
+		 it != workers.parsers.end(); ++it)
+	{
+		for (std::size_t i = 0; i < (sizeof(directions) / sizeof(directions[0])); ++i)
+		{
+			ProcessImage& source = (*it)->GetParser().GetProcessImage(directions[i]);
+			ProcessImage& target = this->GetProcessImage(directions[i]);
+			if ((source.GetSize() == 0) && (source.cbegin() == source.cend()))
+				continue;
+
+			if (target.cbegin() == target.cend())
+			{
+				target.Swap(source);
+			}
+			else
+			{
+				// Same direction in more than one section.
+				std::vector<Channel> channels;
+				for (std::map<std::string, Channel>::const_iterator cIt = source.cbegin();
+					 cIt != source.cend(); ++cIt)
+				{
+					channels.push_back(cIt->second);
+				}
+				target.SetSize(source.GetSize());
+				target.AddChannels(channels);
+			}
+		}
+	}
+}
+
+bool QtParallelProcessImageParser::FindSections(const std::string& document,
+											std::vector<Section>& sections)
+{
+	// Markup inside comments and CDATA can not be told apart by a text search.
+	if ((document.find("<!--") != std::string::npos)
+		|| (document.find("<![CDATA[") != std::string::npos))
+	{
+		return false;
+	}
+
+	const std::string startTag = "<" + ProcessImageParser::processImage_element_name;
+	const std::string endTag = "</" + ProcessImageParser::processImage_element_name;
+
+	std::size_t pos = document.find(startTag);
+	while (pos != std::string::npos)
+	{
+		const std::size_t nameEnd = pos + startTag.size();
+		if (nameEnd >= document.size())
+			return false;
+
+		const char next = document[nameEnd];
+		if ((next != ' ') && (next != '\t') && (next != '\r') && (next != '\n')
+			&& (next != '>') && (next != '/'))
+		{
+			// Longer element name with the same prefix.
+			pos = document.find(startTag, nameEnd);
+			continue;
+		}
+
+		const std::size_t tagEnd = document.find('>', nameEnd);
+		if (tagEnd == std::string::npos)
+			return false;
+
+		Section section;
+		section.begin = pos;
+		if (document[tagEnd - 1] == '/')
+		{
+			section.end = tagEnd + 1;
+		}
+		else
+		{
+			const std::size_t closeTag = document.find(endTag, tagEnd);
+			if (closeTag == std::string::npos)
+				return false;
+
+			const std::size_t closeTagEnd = document.find('>', closeTag);
+			if (closeTagEnd == std::string::npos)
+				return false;
+
+			section.end = closeTagEnd + 1;
+		}
+
+		sections.push_back(section);
+		pos = document.find(startTag, section.end);
+	}
+
+	return true;
+}
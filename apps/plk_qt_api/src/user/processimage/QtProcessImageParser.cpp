@@ -86,6 +86,12 @@ void QtProcessImageParser::ParseInternal(const char* xmlDescription)
 							this->xml.lineNumber(),
 							this->xml.columnNumber());
 	}
+
+	// Build the channel tables in one pass from the sorted lists.
+	this->in.AddChannels(this->inChannels);
+	this->out.AddChannels(this->outChannels);
+	this->inChannels.clear();
+	this->outChannels.clear();
 }
 
 void QtProcessImageParser::ParseProcessImage()
@@ -371,7 +377,14 @@ void QtProcessImageParser::ParseChannelAttributes(Direction::Direction direction
 		iecDataTypeStr = attributes.value(QString::fromStdString(
 							ProcessImageParser::channel_attribute_dataType)).toString().toStdString();
 		dataType = IECDataType::GetIECDatatype(iecDataTypeStr);
-		// TODO check for invalid value.
+		if (dataType == IECDataType::UNDEFINED)
+		{
+			XmlParserException ex(ProcessImageParser::channel_attribute_dataType_invalid_value,
+								XmlParserError::INVALID_ATTRIBUTE_VALUE,
+								this->xml.lineNumber(),
+								this->xml.columnNumber());
+			throw ex;
+		}
 	}
 	else
 	{
@@ -387,7 +400,18 @@ void QtProcessImageParser::ParseChannelAttributes(Direction::Direction direction
 	{
 		bitSize = attributes.value(QString::fromStdString(
 					ProcessImageParser::channel_attribute_bitSize)).toString().toUInt();
-		// TODO: check for valid bitsize.
+
+		// Fixed size datatypes have to match their size. Bitstrings and
+		// strings are of variable length.
+		const IECDataType::IECDataTypeInfo& typeInfo = IECDataType::GetIECDataTypeInfo(dataType);
+		if ((typeInfo.bitSize > 1) && (bitSize != typeInfo.bitSize))
+		{
+			XmlParserException ex(ProcessImageParser::channel_attribute_bitSize_invalid_value,
+								XmlParserError::INVALID_ATTRIBUTE_VALUE,
+								this->xml.lineNumber(),
+								this->xml.columnNumber());
+			throw ex;
+		}
 	}
 	else
 	{
@@ -431,11 +455,11 @@ void QtProcessImageParser::ParseChannelAttributes(Direction::Direction direction
 
 	if (direction == Direction::PI_IN)
 	{
-		this->in.AddChannel(chObj);
+		this->inChannels.push_back(chObj);
 	}
 	else if (direction == Direction::PI_OUT)
 	{
-		this->out.AddChannel(chObj);
+		this->outChannels.push_back(chObj);
 	}
 	else
 	{
@@ -95,6 +95,11 @@ public:
 	 */
 	void UpdateOutputChannelCurrentValue(const ProcessImageOut *out);
 
+	/**
+	 * \return The ProcessImage channel shown by this widget.
+	 */
+	const Channel& GetChannel() const;
+
 private slots:
 	/**
 	 * \brief Updates the value to the processimage whenever the
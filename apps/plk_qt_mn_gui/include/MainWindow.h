@@ -41,6 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 #include "ui_MainWindow.h"
 #include "user/processimage/ProcessImageParser.h"
+#include "user/RecoveryEvent.h"
 
 class SdoTransfer;
 class LoggerWindow;
@@ -50,7 +51,9 @@ class ImportConfigurationDialog;
 class NetworkInterfaceDialog;
 class NmtCommandsDock;
 class NodeStatusDock;
+class SdoStatisticsDock;
 class StatusBar;
+class RecoveryPolicyEngine;
 
 /**
  * \brief The MainWindow class inherits the QMainWindow and implements
@@ -96,9 +99,21 @@ private slots:
 	 * \brief Triggers start of the OPlk stack.
 	 *
 	 * Imports the xap.xml, displays the necessary GUI and starts the OPlk stack.
+	 * The start-up phases are overlapped by the StartupOrchestrator and their
+	 * timing is written to the debug output.
 	 */
 	void on_actionStart_triggered();
 
+	/**
+	 * \brief Builds the processimage views once the processimage is allocated.
+	 *
+	 * Invoked by the StartupOrchestrator while the stack boots up.
+	 *
+	 * \param[in] inPi   The allocated input processimage.
+	 * \param[in] outPi  The allocated output processimage.
+	 */
+	void BuildProcessImageViews(ProcessImageIn *inPi, ProcessImageOut *outPi);
+
 	/**
 	 * \brief Triggers stop of the OPlk stack.
 	 *
@@ -107,6 +122,15 @@ private slots:
 	 */
 	void on_actionStop_triggered();
 
+	/**
+	 * \brief Triggers reload of the CDC and xap.xml of the running OPlk stack.
+	 *
+	 * Parses the new xap.xml and activates the new configuration without
+	 * shutting down the stack. Only the processimage views of the changed
+	 * channels are rebuilt.
+	 */
+	void on_actionReload_triggered();
+
 	/**
 	 * \brief Displays the about/info window.
 	 */
@@ -118,12 +142,25 @@ private slots:
 	void on_actionHelp_triggered();
 
 	/**
-	 * \brief Handles the critical error events from the stack.
+	 * \brief Handles the critical error events from the stack if the
+	 * automatic recovery is not enabled.
 	 * \param[in] errorMessage Detailed information about the error.
 	 */
 	void HandleCriticalError(const QString& errorMessage);
 
+	/**
+	 * \brief Logs the recovery from critical errors of the stack and stops
+	 * the stack if the recovery failed.
+	 * \param[in] event The recovery event.
+	 */
+	void HandleRecoveryEvent(const RecoveryEvent event);
+
 private:
+	/**
+	 * \brief Updates the user interface once the stack has been stopped.
+	 */
+	void SetStackStoppedState();
+
 	Ui::MainWindow ui;                         ///< MainWindow UI instance
 	SdoTransfer *sdo;                          ///< SDO user interface
 	LoggerWindow *log;                         ///< Logging window
@@ -133,8 +170,10 @@ private:
 	NetworkInterfaceDialog *networkInterface;  ///< Network select interface dialog
 	NmtCommandsDock *nmtCmd;                   ///< NMT command
 	NodeStatusDock *nodeStatus;                ///< CN status list
+	SdoStatisticsDock *sdoStatistics;          ///< SDO statistics per node
 	ProcessImageParser *parser;                ///< ProcessImage xml Parser instance
 	StatusBar *status;                         ///< Status bar
+	RecoveryPolicyEngine *recovery;            ///< Recovery from critical errors
 
 	std::string cdc;                           ///< Cdc file. Set after it is
 											   /// selected from the ImportConfigurationDialog.
@@ -40,10 +40,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 * INCLUDES
 *******************************************************************************/
 #include <QtCore/QList>
+#include <QtCore/QVector>
 
 #include "ui_NodeStatusDock.h"
 
 #include "NodeWidget.h"
+#include "user/NodeEvent.h"
 
 /**
  * \brief The NodeStatusDock class inherits QDockWidget and handles the node
@@ -71,6 +73,15 @@ public:
 	 */
 	Q_INVOKABLE void HandleNodeFound(const int nodeId);
 
+	/**
+	 * \brief   Handles a batch of CN node events.
+	 *
+	 * The node list is updated once for all nodes of the batch.
+	 *
+	 * \param[in] events  The net changes of the nodes.
+	 */
+	Q_INVOKABLE void HandleNodeEvents(const QVector<NodeEvent> events);
+
 	/**
 	 * \brief   Handles the MN state changes to sync with the CN status.
 	 *
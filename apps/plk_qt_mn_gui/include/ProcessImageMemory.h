@@ -63,6 +63,17 @@ public:
 
 	~ProcessImageMemory();
 
+	/**
+	 * \brief Replaces the input and output processimage instance after the
+	 * configuration has been reloaded.
+	 *
+	 * The tables are only rebuilt if the size of the processimage has changed.
+	 *
+	 * \param inPi Input processimage instance.
+	 * \param outPi Output processimage instance.
+	 */
+	void ReplaceProcessImage(ProcessImageIn *inPi, const ProcessImageOut *outPi);
+
 public slots:
 
 	/**
@@ -45,6 +45,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "user/processimage/ProcessImageIn.h"
 #include "user/processimage/ProcessImageOut.h"
+#include "user/processimage/ProcessImageDiff.h"
 
 /**
  * \brief The ProcessImageVariables class inherits the QWidget and describes the
@@ -66,6 +67,22 @@ public:
 
 	~ProcessImageVariables();
 
+	/**
+	 * \brief Replaces the input and output processimage instance after the
+	 * configuration has been reloaded.
+	 *
+	 * Only the rows of the added, removed or changed channels are rebuilt.
+	 *
+	 * \param inPi Input processimage instance.
+	 * \param outPi Output processimage instance.
+	 * \param inDiff Differences to the previous input processimage.
+	 * \param outDiff Differences to the previous output processimage.
+	 */
+	void ApplyProcessImageDiff(ProcessImageIn *inPi,
+							const ProcessImageOut *outPi,
+							const ProcessImageDiff& inDiff,
+							const ProcessImageDiff& outDiff);
+
 public slots:
 
 	/**
@@ -152,6 +169,22 @@ private:
 	 * processimage instance.
 	 */
 	void PrepareOutputRows();
+
+	/**
+	 * \brief Rebuilds the rows of ui channels of a processimage by reusing
+	 * the rows of the unchanged channels.
+	 *
+	 * \param[in,out] channelWidgets The channel ui instance list.
+	 * \param[in,out] layout The layout holding the channel ui instances.
+	 * \param[in] pi The new processimage instance.
+	 * \param[in] diff Differences to the previous processimage.
+	 * \param[in] checkedState The state of the select check box for new rows.
+	 */
+	void UpdateRows(QList<ChannelWidget*>& channelWidgets,
+					QVBoxLayout *layout,
+					const ProcessImage& pi,
+					const ProcessImageDiff& diff,
+					Qt::CheckState checkedState);
 };
 
 #endif // _PROCESSIMAGE_VARIABLES_H_
@@ -0,0 +1,79 @@
+/**
+********************************************************************************
+\file   SdoStatisticsDock.h
+
+\brief  SdoStatisticsDock uses the Qt 5.2 QDockWidget to list the SDO latency
+		and abort statistics of the nodes.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _SDO_STATISTICS_DOCK_H_
+#define _SDO_STATISTICS_DOCK_H_
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include <QtCore/QTimer>
+
+#include "ui_SdoStatisticsDock.h"
+
+/**
+ * \brief The SdoStatisticsDock class inherits QDockWidget and lists the
+ * nodes with the slowest or most aborted SDO transfers.
+ */
+class SdoStatisticsDock : public QDockWidget
+{
+	Q_OBJECT
+
+public:
+	explicit SdoStatisticsDock(QWidget *parent = 0);
+
+private slots:
+	/**
+	 * \brief Refreshes the table from the SDO statistics.
+	 */
+	void UpdateStatistics();
+
+	/**
+	 * \brief Discards the SDO statistics of all nodes.
+	 */
+	void on_reset_clicked();
+
+	/**
+	 * \brief Refreshes the table in the newly selected order.
+	 * \param[in] index Chosen index of the sort dropdown
+	 */
+	void on_sortBy_currentIndexChanged(int index);
+
+private:
+	Ui::SdoStatisticsDock ui;  ///< SDO statistics dock ui instance.
+	QTimer refreshTimer;       ///< Periodic refresh of the table.
+};
+
+#endif // _SDO_STATISTICS_DOCK_H_
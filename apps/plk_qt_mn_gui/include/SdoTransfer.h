@@ -46,6 +46,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "user/SdoTransferResult.h"
 
 class SdoTransferJob;
+class SdoDomainTransfer;
 
 /**
  * \brief The SdoTransfer class prepares the ui frame and describes the
@@ -105,6 +106,19 @@ private slots:
 	 */
 	void on_clearLog_clicked();
 
+	/**
+	 * \brief Logs the progress of the DOMAIN transfer in steps of 10 percent.
+	 * \param[in] transferredBytes Number of bytes transferred so far.
+	 * \param[in] size             Size of the object or of the buffer.
+	 */
+	void HandleDomainTransferProgress(const UINT transferredBytes, const UINT size);
+
+	/**
+	 * \brief Logs the result and the throughput of the DOMAIN transfer.
+	 * \param[in] result The result of the SDO transfer
+	 */
+	void HandleDomainTransferFinished(const SdoTransferResult result);
+
 private:
 	Ui::SdoTransfer ui;
 
@@ -120,6 +134,9 @@ private:
 
 	SdoTransferJob *sdoTransferJob;///< SDO Transfer Job instance.
 
+	SdoDomainTransfer *domainTransfer; ///< Transfer of the DOMAIN object from or to a file.
+	UINT domainTransferProgress;   ///< Last logged progress in percent.
+
 	// receiver object should be a part of the class object.
 	// Because the receiver function needs the objects memory while for RemoteSDO Transfer.
 	//TODO static const
@@ -177,6 +194,18 @@ private:
 	 * \param[in] logMessage The message to be updated.
 	 */
 	void UpdateLog(const QString& logMessage);
+
+	/**
+	 * \brief Transfers a DOMAIN object from or to a file selected by the user.
+	 * \param[in] nodeId      Node id.
+	 * \param[in] index       Index of the object.
+	 * \param[in] subIndex    Subindex of the object.
+	 * \param[in] sdoProtocol The protocol type.
+	 */
+	void ExecuteDomainTransfer(const UINT nodeId,
+							const UINT index,
+							const UINT subIndex,
+							tSdoType sdoProtocol);
 };
 
 #endif // _SDO_TRANSFER_H_
@@ -162,16 +162,25 @@ void ChannelWidget::UpdateOutputChannelCurrentValue(const ProcessImageOut *out)
 	}
 }
 
+const Channel& ChannelWidget::GetChannel() const
+{
+	return this->channel;
+}
+
 void ChannelWidget::SetInputMask()
 {
 	if ((this->channel.GetBitSize() % 8) == 0)
 	{
-		QString inputMask;
-		for (UINT i = 0; i < (this->channel.GetBitSize() / 4); ++i)
+		// Fixed size datatypes define their hex width. Strings and BITSTRINGs,
+		// which are typed as IEC_BOOL, depend on the size of the channel.
+		const IECDataType::IECDataTypeInfo& info =
+				IECDataType::GetIECDataTypeInfo(this->channel.GetDataType());
+		UINT hexWidth = info.hexWidth;
+		if ((hexWidth == 0) || (this->channel.GetBitSize() > info.bitSize))
 		{
-			inputMask.append("H");
+			hexWidth = this->channel.GetBitSize() / 4;
 		}
-		this->value->setInputMask(inputMask);
+		this->value->setInputMask(QString(hexWidth, QLatin1Char('H')));
 	}
 	else
 	{
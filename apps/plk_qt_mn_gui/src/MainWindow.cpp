@@ -46,7 +46,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <oplk/debugstr.h>
 
 #include "api/OplkQtApi.h"
+#include "api/StartupOrchestrator.h"
+#include "api/RecoveryPolicyEngine.h"
 #include "common/XmlParserException.h"
+#include "user/processimage/ProcessImageDiff.h"
 
 #include "MainWindow.h"
 #include "AboutDialog.h"
@@ -58,6 +61,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "NetworkInterfaceDialog.h"
 #include "NmtCommandsDock.h"
 #include "NodeStatusDock.h"
+#include "SdoStatisticsDock.h"
 #include "StatusBar.h"
 
 /*******************************************************************************
@@ -78,15 +82,18 @@ MainWindow::MainWindow(QWidget *parent) :
 	networkInterface(new NetworkInterfaceDialog()),
 	nmtCmd(new NmtCommandsDock()),
 	nodeStatus(new NodeStatusDock()),
+	sdoStatistics(new SdoStatisticsDock()),
 	piVar(new ProcessImageVariables()),
 	piMemory(new ProcessImageMemory()),
 	parser(NULL),
 	status(new StatusBar()),
+	recovery(new RecoveryPolicyEngine()),
 	cdc("")
 {
 	this->ui.setupUi(this);
 	this->setStatusBar(this->status);
 	this->ui.actionStop->setDisabled(true);
+	this->ui.actionReload->setDisabled(true);
 	int index = this->status->metaObject()->indexOfMethod(
 						QMetaObject::normalizedSignature(
 						"UpdateNmtStatus(tNmtState)").constData());
@@ -124,6 +131,10 @@ MainWindow::MainWindow(QWidget *parent) :
 	this->addDockWidget(Qt::BottomDockWidgetArea, this->log);
 	this->log->show();
 
+	this->addDockWidget(Qt::BottomDockWidgetArea, this->sdoStatistics);
+	this->tabifyDockWidget(this->log, this->sdoStatistics);
+	this->log->raise();
+
 	this->ui.tabWidget->addTab(this->sdo, "SDO Transfer");
 
 
@@ -135,10 +146,17 @@ MainWindow::MainWindow(QWidget *parent) :
 						"HandleCriticalError(const QString&)").constData());
 	Q_ASSERT(index != -1);
 
+	// Fallback if the automatic recovery cannot be enabled.
 	ret = OplkQtApi::RegisterCriticalErrorEventHandler(*(this),
 							this->metaObject()->method(index));
 	Q_ASSERT(ret != false);
 
+	ret = connect(this->recovery,
+				  SIGNAL(SignalRecoveryEvent(const RecoveryEvent)),
+				  this,
+				  SLOT(HandleRecoveryEvent(const RecoveryEvent)));
+	Q_ASSERT(ret != false);
+
 	ret = connect(this->nodeStatus,
 				  SIGNAL(SignalNodeAvailable(unsigned int)),
 				  this->sdo,
@@ -182,9 +200,11 @@ MainWindow::~MainWindow()
 	delete this->networkInterface;
 	delete this->nmtCmd;
 	delete this->nodeStatus;
+	delete this->sdoStatistics;
     if (this->parser)
         delete this->parser;
 	delete this->status;
+	delete this->recovery;
 }
 
 /*******************************************************************************
@@ -235,34 +255,6 @@ void MainWindow::on_actionStart_triggered()
 		}
 	}
 
-	try
-	{
-		this->parser = ProcessImageParser::NewInstance(ProcessImageParserType::QT_XML_PARSER);
-
-		if (this->cdcDialog->GetXapFileName().isEmpty())
-		{
-			QMessageBox::critical(this, "File not found",
-								 QString("xap.xml not found"),
-								 QMessageBox::Close);
-			return;
-		}
-		std::ifstream ifsXap(this->cdcDialog->GetXapFileName().toStdString().c_str());
-		std::string xapData((std::istreambuf_iterator<char>(ifsXap)), std::istreambuf_iterator<char>());
-		this->parser->Parse(xapData.c_str());
-	}
-	catch(const std::exception& ex)
-	{
-		QMessageBox::critical(this, QStringLiteral("Xml Parsing failed!"),
-							 QString("XmlReader has found errors with your xap file.\n Error: %1 ")
-							  .arg(ex.what()),
-							 QMessageBox::Close);
-		qDebug("An Exception has occurred: %s", ex.what());
-		return;
-	}
-
-	ProcessImageIn& piIn = static_cast<ProcessImageIn&>(this->parser->GetProcessImage(Direction::PI_IN));
-	ProcessImageOut& piOut = static_cast<ProcessImageOut&>(this->parser->GetProcessImage(Direction::PI_OUT));
-
 	//TODO Start POWERLINK and only if success enable the stop button.
 	if (this->networkInterface->GetDevName().isEmpty())
 	{
@@ -272,68 +264,83 @@ void MainWindow::on_actionStart_triggered()
 		}
 	}
 
-	tOplkError oplkRet = kErrorGeneralError;
-	oplkRet = OplkQtApi::InitStack(localNodeId, this->networkInterface->GetDevName().toStdString());
-	if (oplkRet != kErrorOk)
-	{
-		QMessageBox::critical(this, "POWERLINK init failed",
-							 QString("POWERLINK init falied with error: %1 ")
-							  .arg(debugstr_getRetValStr(oplkRet)),
-							 QMessageBox::Close);
-		qDebug("InitStack retCode %x", oplkRet);
-		return;
-	}
+	StartupOrchestrator startup(ProcessImageParserType::QT_XML_PARALLEL_PARSER);
+	bool ret = startup.SetViewBuilder(*this, this->metaObject()->method(
+				this->metaObject()->indexOfMethod(QMetaObject::normalizedSignature(
+				"BuildProcessImageViews(ProcessImageIn*,ProcessImageOut*)").constData())));
+	Q_ASSERT(ret != false);
 
 	this->cdc = this->cdcDialog->GetCdcFileName().toStdString();
-	oplkRet = OplkQtApi::SetCdc(this->cdc);
-	if (oplkRet != kErrorOk)
+	tOplkError oplkRet = kErrorGeneralError;
+	try
 	{
-		QMessageBox::critical(this, "SetCDC failed",
-							 QString("SetCDC failed: %1 ")
-							  .arg(debugstr_getRetValStr(oplkRet)),
-							 QMessageBox::Close);
-		return;
+		oplkRet = startup.Run(localNodeId,
+						this->networkInterface->GetDevName().toStdString(),
+						this->cdcDialog->GetXapFileName().toStdString(),
+						this->cdc);
 	}
-
-	oplkRet = OplkQtApi::AllocateProcessImage(piIn, piOut);
-	if (oplkRet != kErrorOk)
+	catch(const std::exception& ex)
 	{
-		QMessageBox::critical(this, "ProcessImage allocation failed",
-							 QString("ProcessImage allocation with error: %1 ")
-							  .arg(debugstr_getRetValStr(oplkRet)),
-							 QMessageBox::Close);
-		qDebug("AllocateProcessImage retCode %x", oplkRet);
+		qDebug("An Exception has occurred: %s", ex.what());
 		return;
 	}
 
-	// After successful allocation of processimage prepare the user interface.
-	this->piVar->SetProcessImage(&piIn, &piOut);
-	this->piMemory->SetProcessImage(&piIn, &piOut);
+	qDebug("Start-up phases:\n%s", startup.GetTimingReport().ToString().c_str());
 
-	oplkRet = OplkQtApi::StartStack();
 	if (oplkRet != kErrorOk)
 	{
-		QMessageBox::critical(this, "Start POWERLINK failed",
-							 QString("Start POWERLINK failed with error: %1 ")
-							  .arg(debugstr_getRetValStr(oplkRet)),
-							 QMessageBox::Close);
-		qDebug("StartStack retCode %x", oplkRet);
+		const StartupPhase::StartupPhase failedPhase = startup.GetFailedPhase();
+		if (failedPhase == StartupPhase::PARSE_XAP)
+		{
+			QMessageBox::critical(this, QStringLiteral("Xml Parsing failed!"),
+								 QString("XmlReader has found errors with your xap file.\n Error: %1 ")
+								  .arg(startup.GetParseErrorMessage().c_str()),
+								 QMessageBox::Close);
+		}
+		else
+		{
+			QMessageBox::critical(this,
+								 QString("%1 failed")
+								  .arg(StartupPhase::GetStartupPhaseString(failedPhase).c_str()),
+								 QString("%1 failed with error: %2 ")
+								  .arg(StartupPhase::GetStartupPhaseString(failedPhase).c_str())
+								  .arg(debugstr_getRetValStr(oplkRet)),
+								 QMessageBox::Close);
+		}
 		return;
 	}
 
+	this->parser = startup.ReleaseParser();
+
 	this->ui.actionOpen_CDC->setEnabled(false);
 	this->ui.actionSelect_Interface->setEnabled(false);
 	this->ui.actionStop->setEnabled(true);
+	this->ui.actionReload->setEnabled(true);
 	this->ui.actionStart->setEnabled(false);
 	this->piVar->setEnabled(true);
 	this->piMemory->setEnabled(true);
 
 	this->sdo->setEnabled(true);
 	this->nmtCmd->setEnabled(true);
+
+	if (!this->recovery->Enable())
+	{
+		// HandleCriticalError() stops the stack on a critical error instead.
+		this->log->HandleStackLog("Automatic recovery from critical errors is not available");
+	}
+}
+
+void MainWindow::BuildProcessImageViews(ProcessImageIn *inPi, ProcessImageOut *outPi)
+{
+	// After successful allocation of processimage prepare the user interface.
+	this->piVar->SetProcessImage(inPi, outPi);
+	this->piMemory->SetProcessImage(inPi, outPi);
 }
 
 void MainWindow::on_actionStop_triggered()
 {
+	// A running recovery must not restart the stack.
+	this->recovery->Disable();
 	emit SignalStackStopped();
 	tOplkError oplkRet = OplkQtApi::StopStack();
 	if (oplkRet != kErrorOk)
@@ -348,17 +355,92 @@ void MainWindow::on_actionStop_triggered()
 		return;
 	}
 
-	this->ui.actionOpen_CDC->setEnabled(true);
-	this->ui.actionSelect_Interface->setEnabled(true);
-	this->ui.actionStart->setEnabled(true);
-	this->ui.actionStop->setEnabled(false);
+	this->SetStackStoppedState();
+}
 
-	this->sdo->setEnabled(false);
-	this->nmtCmd->setEnabled(false);
-	this->piVar->setEnabled(false);
-	this->piMemory->setEnabled(false);
+void MainWindow::on_actionReload_triggered()
+{
+	if (this->cdcDialog->exec() == QDialog::Rejected)
+	{
+		return;
+	}
+
+	if ((this->cdcDialog->GetCdcFileName().isEmpty())
+		|| (this->cdcDialog->GetXapFileName().isEmpty()))
+	{
+		QMessageBox::critical(this, QStringLiteral("CDC, Xap.xml not found"),
+							 QString(QStringLiteral("CDC file and xap.xml not found")),
+							 QMessageBox::Close);
+		return;
+	}
+
+	// Parse the new configuration while the stack keeps running with the old one.
+	ProcessImageParser *newParser = NULL;
+	try
+	{
+		newParser = ProcessImageParser::NewInstance(ProcessImageParserType::QT_XML_PARALLEL_PARSER);
+
+		std::ifstream ifsXap(this->cdcDialog->GetXapFileName().toStdString().c_str());
+		std::string xapData((std::istreambuf_iterator<char>(ifsXap)), std::istreambuf_iterator<char>());
+		newParser->Parse(xapData.c_str());
+	}
+	catch(const std::exception& ex)
+	{
+		delete newParser;
+		QMessageBox::critical(this, QStringLiteral("Xml Parsing failed!"),
+							 QString("XmlReader has found errors with your xap file.\n Error: %1 ")
+							  .arg(ex.what()),
+							 QMessageBox::Close);
+		qDebug("An Exception has occurred: %s", ex.what());
+		return;
+	}
+
+	ProcessImageIn& piIn = static_cast<ProcessImageIn&>(newParser->GetProcessImage(Direction::PI_IN));
+	ProcessImageOut& piOut = static_cast<ProcessImageOut&>(newParser->GetProcessImage(Direction::PI_OUT));
+
+	const ProcessImageDiff inDiff(this->parser->GetProcessImage(Direction::PI_IN), piIn);
+	const ProcessImageDiff outDiff(this->parser->GetProcessImage(Direction::PI_OUT), piOut);
+
+	const std::string newCdc = this->cdcDialog->GetCdcFileName().toStdString();
+	ReloadOutcome::ReloadOutcome outcome = ReloadOutcome::UNCHANGED;
+	tOplkError oplkRet = OplkQtApi::ReloadConfiguration(newCdc, piIn, piOut, outcome);
+	if (oplkRet != kErrorOk)
+	{
+		QMessageBox::critical(this, "Reload configuration failed",
+							 QString("Reload configuration failed with error: %1 ")
+							  .arg(debugstr_getRetValStr(oplkRet)),
+							 QMessageBox::Close);
+		qDebug("ReloadConfiguration retCode %x", oplkRet);
+	}
+
+	switch (outcome)
+	{
+		case ReloadOutcome::SHUT_DOWN:
+			delete newParser;
+			emit SignalStackStopped();
+			this->SetStackStoppedState();
+			return;
+		case ReloadOutcome::UNCHANGED:
+			// The views stay bound to the old ProcessImage memory.
+			if (oplkRet != kErrorOk)
+			{
+				delete newParser;
+				return;
+			}
+			break;
+		case ReloadOutcome::REALLOCATED:
+		default:
+			break;
+	}
+
+	this->cdc = newCdc;
+
+	// Only the views of the changed channels are rebuilt.
+	this->piVar->ApplyProcessImageDiff(&piIn, &piOut, inDiff, outDiff);
+	this->piMemory->ReplaceProcessImage(&piIn, &piOut);
 
 	delete this->parser;
+	this->parser = newParser;
 }
 
 void MainWindow::on_actionAbout_triggered()
@@ -378,11 +460,68 @@ void MainWindow::on_actionHelp_triggered()
 	}
 }
 
+void MainWindow::SetStackStoppedState()
+{
+	this->ui.actionOpen_CDC->setEnabled(true);
+	this->ui.actionSelect_Interface->setEnabled(true);
+	this->ui.actionStart->setEnabled(true);
+	this->ui.actionStop->setEnabled(false);
+	this->ui.actionReload->setEnabled(false);
+
+	this->sdo->setEnabled(false);
+	this->nmtCmd->setEnabled(false);
+	this->piVar->setEnabled(false);
+	this->piMemory->setEnabled(false);
+
+	delete this->parser;
+	this->parser = NULL;
+}
+
 void MainWindow::HandleCriticalError(const QString& errorMessage)
 {
+	// The error is handled by the automatic recovery.
+	if (this->recovery->IsEnabled())
+		return;
+
 	this->on_actionStop_triggered();
 	QMessageBox::warning(this, "Critical Error!",
 						QString("Critical error has occurred in the openPOWERLINK stack.\nError: %1")
 								.arg(errorMessage),
 						QMessageBox::Close);
 }
+
+void MainWindow::HandleRecoveryEvent(const RecoveryEvent event)
+{
+	static const char* const actionNames[] = {
+		"none", "reset communication", "reset node", "restart stack"
+	};
+
+	switch (event.GetType())
+	{
+		case RecoveryEventType::RECOVERY_STARTED:
+			this->log->HandleStackLog(QString("Critical error: %1. Recovering.")
+									.arg(event.GetError().GetMessage()));
+			break;
+		case RecoveryEventType::ACTION_EXECUTED:
+			this->log->HandleStackLog(QString("Recovery attempt %1: %2 (%3)")
+									.arg(event.GetAttempt())
+									.arg(actionNames[event.GetAction()])
+									.arg(debugstr_getRetValStr(event.GetActionResult())));
+			break;
+		case RecoveryEventType::RECOVERED:
+			this->log->HandleStackLog(QString("Recovered by %1 in %2 ms")
+									.arg(actionNames[event.GetAction()])
+									.arg(event.GetTimeToRecover()));
+			break;
+		case RecoveryEventType::RECOVERY_FAILED:
+			this->on_actionStop_triggered();
+			QMessageBox::warning(this, "Critical Error!",
+								QString("Critical error has occurred in the openPOWERLINK stack.\nError: %1\nRecovery failed after %2 attempts.")
+										.arg(event.GetError().GetMessage())
+										.arg(event.GetAttempt()),
+								QMessageBox::Close);
+			break;
+		default:
+			break;
+	}
+}
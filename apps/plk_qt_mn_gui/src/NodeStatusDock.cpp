@@ -46,6 +46,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 const UINT kMaxNodes = 240;
 //TODO have nodeId in common place.
 const UINT kmnNodeId = 240;
+// Node events are delivered every 20 ms or for every 64 events during boot.
+const UINT kNodeEventWindow = 20;
+const UINT kNodeEventBatchSize = 64;
 
 NodeStatusDock::NodeStatusDock(QWidget *parent) :
 	QDockWidget(parent)
@@ -73,23 +76,15 @@ NodeStatusDock::NodeStatusDock(QWidget *parent) :
 
 	int index = this->metaObject()->indexOfMethod(
 					QMetaObject::normalizedSignature(
-					"HandleNodeStateChanged(const int, tNmtState)").constData());
+					"HandleNodeEvents(const QVector<NodeEvent>)").constData());
 	Q_ASSERT(index != -1);
 	// If asserted check for the Function name
 
-	bool ret = OplkQtApi::RegisterNodeStateChangedEventHandler(*(this),
+	bool ret = OplkQtApi::RegisterNodeEventBatchHandler(*(this),
 							this->metaObject()->method(index));
 	Q_ASSERT(ret != false);
 
-	index = this->metaObject()->indexOfMethod(
-					QMetaObject::normalizedSignature(
-					"HandleNodeFound(const int)").constData());
-	Q_ASSERT(index != -1);
-	// If asserted check for the Function name
-
-	ret = OplkQtApi::RegisterNodeFoundEventHandler(*(this),
-							this->metaObject()->method(index));
-	Q_ASSERT(ret != false);
+	OplkQtApi::EnableNodeEventBatching(kNodeEventWindow, kNodeEventBatchSize);
 
 	index = this->metaObject()->indexOfMethod(
 					QMetaObject::normalizedSignature(
@@ -154,6 +149,24 @@ void NodeStatusDock::HandleNodeStateChanged(const int nodeId, tNmtState nmtState
 	}
 }
 
+void NodeStatusDock::HandleNodeEvents(const QVector<NodeEvent> events)
+{
+	// Relayout the node list only once per batch.
+	this->setUpdatesEnabled(false);
+
+	for (QVector<NodeEvent>::const_iterator it = events.begin();
+		 it != events.end(); ++it)
+	{
+		if (it->IsFound())
+			this->HandleNodeFound(it->GetNodeId());
+
+		if (it->IsStateChanged())
+			this->HandleNodeStateChanged(it->GetNodeId(), it->GetNewState());
+	}
+
+	this->setUpdatesEnabled(true);
+}
+
 void NodeStatusDock::HandleNodeFound(const int nodeId)
 {
 	// qDebug(" F %d ", nodeId);
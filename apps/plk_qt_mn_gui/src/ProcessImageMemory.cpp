@@ -138,6 +138,26 @@ void ProcessImageMemory::SetProcessImage(ProcessImageIn *inPi, const ProcessImag
 	}
 }
 
+void ProcessImageMemory::ReplaceProcessImage(ProcessImageIn *inPi, const ProcessImageOut *outPi)
+{
+	const bool inSizeChanged = (!inPi || !this->inPi
+								|| (inPi->GetSize() != this->inPi->GetSize()));
+	const bool outSizeChanged = (!outPi || !this->outPi
+								|| (outPi->GetSize() != this->outPi->GetSize()));
+
+	if (inSizeChanged || outSizeChanged)
+	{
+		this->ResetView();
+		this->SetProcessImage(inPi, outPi);
+	}
+	else
+	{
+		// Same memory layout, the table cells are reused.
+		this->inPi = inPi;
+		this->outPi = outPi;
+	}
+}
+
 /*******************************************************************************
 * Private functions
 *******************************************************************************/
@@ -42,6 +42,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <QtCore/QLocale>
 
+#include <map>
+#include <set>
+
 #include "api/OplkQtApi.h"
 
 /*******************************************************************************
@@ -155,6 +158,26 @@ void ProcessImageVariables::SetProcessImage(ProcessImageIn *inPi, const ProcessI
 	}
 }
 
+void ProcessImageVariables::ApplyProcessImageDiff(ProcessImageIn *inPi,
+										const ProcessImageOut *outPi,
+										const ProcessImageDiff& inDiff,
+										const ProcessImageDiff& outDiff)
+{
+	if (inPi && !inDiff.IsEmpty())
+	{
+		this->UpdateRows(this->inputChannels, this->ui.inputProcessImage,
+						 *inPi, inDiff, this->ui.inputCheckAll->checkState());
+	}
+	this->inPi = inPi;
+
+	if (outPi && !outDiff.IsEmpty())
+	{
+		this->UpdateRows(this->outputChannels, this->ui.outputProcessImage,
+						 *outPi, outDiff, this->ui.outputCheckAll->checkState());
+	}
+	this->outPi = outPi;
+}
+
 void ProcessImageVariables::UpdateFromInputValues()
 {
 	for (QList<ChannelWidget*>::iterator channel = this->inputChannels.begin();
@@ -213,6 +236,77 @@ void ProcessImageVariables::PrepareOutputRows()
 	this->on_outputCheckAll_stateChanged(this->ui.outputCheckAll->checkState());
 }
 
+void ProcessImageVariables::UpdateRows(QList<ChannelWidget*>& channelWidgets,
+									QVBoxLayout *layout,
+									const ProcessImage& pi,
+									const ProcessImageDiff& diff,
+									Qt::CheckState checkedState)
+{
+	std::set<std::string> staleChannels;
+	for (std::vector<Channel>::const_iterator it = diff.GetRemovedChannels().begin();
+		 it != diff.GetRemovedChannels().end(); ++it)
+	{
+		staleChannels.insert(it->GetName());
+	}
+	for (std::vector<Channel>::const_iterator it = diff.GetChangedChannels().begin();
+		 it != diff.GetChangedChannels().end(); ++it)
+	{
+		staleChannels.insert(it->GetName());
+	}
+
+	std::map<std::string, ChannelWidget*> reusableChannels;
+	for (QList<ChannelWidget*>::iterator channel = channelWidgets.begin();
+		 channel != channelWidgets.end(); ++channel)
+	{
+		if (*channel)
+		{
+			layout->removeWidget(*channel);
+			const std::string& name = (*channel)->GetChannel().GetName();
+			if (staleChannels.find(name) != staleChannels.end())
+			{
+				delete (*channel);
+			}
+			else
+			{
+				reusableChannels.insert(std::make_pair(name, *channel));
+			}
+		}
+	}
+	channelWidgets.clear();
+
+	// Keep the order of the processimage. Only new channels get a new row.
+	for (std::map<std::string, Channel>::const_iterator it = pi.cbegin();
+		 it != pi.cend(); ++it)
+	{
+		ChannelWidget *channel = NULL;
+		std::map<std::string, ChannelWidget*>::iterator reused = reusableChannels.find(it->first);
+		if (reused != reusableChannels.end())
+		{
+			channel = reused->second;
+			reusableChannels.erase(reused);
+		}
+		else
+		{
+			channel = new ChannelWidget(it->second);
+			if (checkedState != Qt::PartiallyChecked)
+			{
+				channel->SetSelectCheckBox(checkedState);
+			}
+		}
+		channelWidgets.push_back(channel);
+		layout->addWidget(channel);
+	}
+
+	// Rows which are not part of the new processimage any more.
+	for (std::map<std::string, ChannelWidget*>::iterator it = reusableChannels.begin();
+		 it != reusableChannels.end(); ++it)
+	{
+		delete it->second;
+	}
+
+	layout->update();
+}
+
 void ProcessImageVariables::on_inputCheckAll_stateChanged(int checkedState)
 {
 	if (checkedState != Qt::PartiallyChecked)
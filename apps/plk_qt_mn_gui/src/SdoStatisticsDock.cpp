@@ -0,0 +1,138 @@
+/**
+********************************************************************************
+\file   SdoStatisticsDock.cpp
+
+\brief  Implements the SDO statistics dock which lists the SDO latency and
+		abort statistics of the nodes.
+
+\author Ramakrishnan Periyakaruppan
+
+\copyright (c) 2014, Kalycito Infotech Private Limited
+					 All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the copyright holders nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/*******************************************************************************
+* INCLUDES
+*******************************************************************************/
+#include "SdoStatisticsDock.h"
+#include "api/SdoStatistics.h"
+
+const UINT kRefreshInterval = 1000;   ///< Refresh interval in milliseconds.
+const UINT kMaxListedNodes = 254;     ///< Maximum number of nodes in the table.
+const UINT kLatencyPercentile = 95;
+
+/*******************************************************************************
+* Public functions
+*******************************************************************************/
+SdoStatisticsDock::SdoStatisticsDock(QWidget *parent) :
+	QDockWidget(parent),
+	refreshTimer()
+{
+	this->ui.setupUi(this);
+	this->ui.statistics->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+
+	bool ret = connect(&(this->refreshTimer), SIGNAL(timeout()),
+				this, SLOT(UpdateStatistics()));
+	Q_ASSERT(ret != false);
+
+	this->refreshTimer.start(kRefreshInterval);
+}
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+void SdoStatisticsDock::UpdateStatistics()
+{
+	// Not refreshed while hidden or behind another tab.
+	if (this->visibleRegion().isEmpty())
+		return;
+
+	std::vector<NodeSdoStatistics> nodes;
+	if (this->ui.sortBy->currentIndex() == 0)
+	{
+		nodes = SdoStatistics::GetInstance().GetSlowestNodes(kMaxListedNodes);
+	}
+	else
+	{
+		nodes = SdoStatistics::GetInstance().GetMostAbortingNodes(kMaxListedNodes);
+	}
+
+	this->ui.statistics->setRowCount(nodes.size());
+	for (UINT row = 0; row < nodes.size(); ++row)
+	{
+		const NodeSdoStatistics& node = nodes.at(row);
+
+		// The most frequent abort code of the node.
+		UINT32 topAbortCode = 0;
+		ULONG topAbortCount = 0;
+		const std::map<UINT32, ULONG>& abortCodes = node.GetAbortCodes();
+		for (std::map<UINT32, ULONG>::const_iterator it = abortCodes.begin();
+			 it != abortCodes.end(); ++it)
+		{
+			if (it->second > topAbortCount)
+			{
+				topAbortCode = it->first;
+				topAbortCount = it->second;
+			}
+		}
+
+		QStringList columns;
+		columns << QString::number(node.GetNodeId())
+				<< QString::number(node.GetTransferCount())
+				<< QString("%1 / %2").arg(node.GetAsndTransferCount())
+									 .arg(node.GetUdpTransferCount())
+				<< QString::number(node.GetTransferredBytes())
+				<< QString::number(node.GetAverageLatency())
+				<< QString::number(node.GetLatencyPercentile(kLatencyPercentile))
+				<< QString::number(node.GetMaxLatency())
+				<< QString::number(node.GetAbortCount())
+				<< ((topAbortCount > 0)
+					? QString("0x%1").arg(topAbortCode, 8, 16, QLatin1Char('0'))
+					: QString("-"));
+
+		for (int column = 0; column < columns.size(); ++column)
+		{
+			QTableWidgetItem* item = this->ui.statistics->item(row, column);
+			if (item == NULL)
+			{
+				item = new QTableWidgetItem();
+				this->ui.statistics->setItem(row, column, item);
+			}
+			item->setText(columns.at(column));
+		}
+	}
+}
+
+void SdoStatisticsDock::on_reset_clicked()
+{
+	SdoStatistics::GetInstance().Reset();
+	this->UpdateStatistics();
+}
+
+void SdoStatisticsDock::on_sortBy_currentIndexChanged(int index)
+{
+	Q_UNUSED(index);
+	this->UpdateStatistics();
+}
@@ -39,6 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 * INCLUDES
 *******************************************************************************/
 #include <QtWidgets/QMessageBox>
+#include <QtWidgets/QFileDialog>
 #include <QtCore/QDateTime>
 
 #include <limits.h>
@@ -47,6 +48,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "SdoTransfer.h"
 #include "api/OplkQtApi.h"
+#include "api/SdoDomainTransfer.h"
 #include "oplk/debugstr.h"
 
 /*******************************************************************************
@@ -64,6 +66,7 @@ QMap<QString, QMetaType::Type> SdoTransfer::CreateDataTypeMap()
 	dataType["UNSIGNED32"]     = (QMetaType::Type)QMetaType::type("quint32");
 	dataType["SIGNED64"]       = (QMetaType::Type)QMetaType::type("qint64");
 	dataType["UNSIGNED64"]     = (QMetaType::Type)QMetaType::type("quint64");
+	dataType["DOMAIN"]         = QMetaType::QByteArray;
 	/*
 	 * TODO Implement
 	dataType["VISIBLE STRING"] = (QMetaType::Type)QMetaType::type("QString");
@@ -77,6 +80,9 @@ QMap<QString, QMetaType::Type> SdoTransfer::CreateDataTypeMap()
 *******************************************************************************/
 const QMap<QString, QMetaType::Type> SdoTransfer::dataTypeMap = SdoTransfer::CreateDataTypeMap();
 
+// Largest DOMAIN object uploaded to a file.
+static const UINT kMaxDomainUploadSize = 16 * 1024 * 1024;
+
 //TODO can have a qmap for sdoVia also
 
 /*******************************************************************************
@@ -87,6 +93,8 @@ SdoTransfer::SdoTransfer(QWidget *parent) :
 	sdoViaUdpStr("UDP"),
 	sdoViaASndStr("ASnd"),
 	sdoTransferJob(NULL),
+	domainTransfer(NULL),
+	domainTransferProgress(0),
 	sdoTransferData(0),
 	maxDataValue(0),
 	minDataValue(0),
@@ -158,6 +166,12 @@ void SdoTransfer::on_executeTransfer_clicked()
 		sdoProtocol = kSdoTypeUdp;
 	}
 
+	if (this->metaDataTypeIndex == QMetaType::QByteArray)
+	{
+		this->ExecuteDomainTransfer(nodeId, index, subIndex, sdoProtocol);
+		return;
+	}
+
 	//Choose the SDO transfer type from selection
 	tSdoAccessType sdoAccessType = kSdoAccessTypeRead;
 	if (this->ui.read->isChecked())
@@ -286,6 +300,83 @@ void SdoTransfer::HandleSdoTransferFinished(const SdoTransferResult result)
 	this->ui.groupBoxSdoTransfer->setEnabled(true);
 }
 
+void SdoTransfer::ExecuteDomainTransfer(const UINT nodeId,
+							const UINT index,
+							const UINT subIndex,
+							tSdoType sdoProtocol)
+{
+	const bool read = this->ui.read->isChecked();
+	const QString fileName = read
+			? QFileDialog::getSaveFileName(this, "Save DOMAIN object to")
+			: QFileDialog::getOpenFileName(this, "Download DOMAIN object from");
+	if (fileName.isEmpty())
+		return;
+
+	delete this->domainTransfer;
+	this->domainTransfer = new SdoDomainTransfer(nodeId,
+									index,
+									subIndex,
+									fileName,
+									read ? kSdoAccessTypeRead : kSdoAccessTypeWrite,
+									kMaxDomainUploadSize,
+									sdoProtocol,
+									this);
+
+	bool ret = connect(this->domainTransfer, SIGNAL(SignalProgress(UINT, UINT)),
+				this, SLOT(HandleDomainTransferProgress(UINT, UINT)));
+	Q_ASSERT(ret != false);
+
+	ret = connect(this->domainTransfer, SIGNAL(SignalFinished(SdoTransferResult)),
+				this, SLOT(HandleDomainTransferFinished(SdoTransferResult)));
+	Q_ASSERT(ret != false);
+
+	this->UpdateLog(QString("SDO transfer %1 DOMAIN (Node=%2, Index=0x%3, Sub index=0x%4 via=%5 File=%6)")
+					.arg(read ? "Read" : "Write")
+					.arg(QString::number(nodeId, 10))
+					.arg(QString::number(index, 16))
+					.arg(QString::number(subIndex, 16))
+					.arg(this->ui.sdoVia->currentText())
+					.arg(fileName));
+
+	this->domainTransferProgress = 0;
+	this->ui.groupBoxSdoTransfer->setEnabled(false);
+
+	tOplkError oplkRet = this->domainTransfer->Start();
+	if ((oplkRet != kErrorOk) && (oplkRet != kErrorApiTaskDeferred))
+	{
+		this->UpdateLog(QString("SDO transfer failed. Err=0x%1(%2)")
+									.arg(QString::number(oplkRet, 16))
+									.arg(debugstr_getRetValStr(oplkRet)));
+		this->ui.groupBoxSdoTransfer->setEnabled(true);
+	}
+}
+
+void SdoTransfer::HandleDomainTransferProgress(const UINT transferredBytes,
+							const UINT size)
+{
+	if (size == 0)
+		return;
+
+	const UINT progress = (UINT) (((quint64) transferredBytes * 100) / size);
+	if (progress >= (this->domainTransferProgress + 10))
+	{
+		this->domainTransferProgress = progress - (progress % 10);
+		this->UpdateLog(QString("Transferred %1 of %2 bytes (%3%)")
+						.arg(transferredBytes)
+						.arg(size)
+						.arg(this->domainTransferProgress));
+	}
+}
+
+void SdoTransfer::HandleDomainTransferFinished(const SdoTransferResult result)
+{
+	this->HandleSdoTransferFinished(result);
+
+	this->UpdateLog(QString("Transferred %1 bytes (%2 kB/s)")
+					.arg(result.GetTransferredBytes())
+					.arg(this->domainTransfer->GetThroughput() / 1024.0, 0, 'f', 1));
+}
+
 void SdoTransfer::on_dataType_currentIndexChanged(const QString &dataType)
 {
 	this->ui.sdoResultValue->clear();
@@ -354,6 +445,8 @@ void SdoTransfer::SetMinMax(QMetaType::Type datatype)
 			break;
 		case QMetaType::QChar:
 			break;
+		case QMetaType::QByteArray:
+			break;
 		default:
 			qDebug("Unhandled datatype from %s %d", __FUNCTION__, datatype);
 			break;
@@ -440,6 +533,9 @@ void SdoTransfer::SetMaskForValue()
 			this->sdoTransferData = 0;
 			break;
 		}
+		case QMetaType::QByteArray:
+			// The DOMAIN object is transferred from or to a file.
+			break;
 		default:
 			qDebug("Unhandled datatype from %s %d", __FUNCTION__, this->metaDataTypeIndex);
 			break;
@@ -510,6 +606,9 @@ void SdoTransfer::UpdateSdoTransferReturnValue()
 			this->ui.sdoResultValue->setText(QString("%1").arg(byteArray.constData()));
 			break;
 		}
+		case QMetaType::QByteArray:
+			// The DOMAIN object has been written to the file.
+			break;
 		default:
 			qDebug("Unhandled datatype from %s %d", __FUNCTION__, this->metaDataTypeIndex);
 			break;
@@ -40,6 +40,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "QtCore/QLocale"
 
 #include "api/OplkQtApi.h"
+#include "api/ObjectDictionaryCache.h"
 #include "oplk/debugstr.h"
 
 StatusBar::StatusBar(QWidget *parent) :
@@ -89,6 +90,10 @@ StatusBar::StatusBar(QWidget *parent) :
 	Q_ASSERT(ret != false);
 	// For the first time it is not receiving synctime.
 	this->HandleSyncWaitTimeChanged(OplkQtApi::GetSyncWaitTime());
+
+	// The cycle time changes only with a new configuration.
+	ObjectDictionaryCache::GetInstance().SetPolicy(0, 0x1006, 0x00,
+											ObjectCachePolicy::STATIC);
 }
 
 void StatusBar::UpdateNmtStatus(tNmtState nmtState)
@@ -120,12 +125,10 @@ void StatusBar::UpdateNmtStatus(tNmtState nmtState)
 
 void StatusBar::UpdateCycleTime()
 {
-	DWORD cycleTime;
-	UINT size = sizeof (cycleTime);
-	tOplkError oplkRet = oplk_readLocalObject(0x1006,
+	UINT32 cycleTime = 0;
+	tOplkError oplkRet = ObjectDictionaryCache::GetInstance().ReadLocal(0x1006,
 											  0x00,
-											  (void*)(&cycleTime),
-											  &size);
+											  cycleTime);
 	// TODO Assert if err
 	if (oplkRet != kErrorOk)
 		qDebug("Cycle time read error: %s", debugstr_getRetValStr(oplkRet));